@@ -0,0 +1,261 @@
+//
+//  OlapicCurationBatch.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <OlapicSDK/OlapicSDK.h>
+#import "OlapicRetryPolicy.h"
+/**
+ *  The operations a batch can run
+ */
+typedef NS_ENUM(NSInteger, OlapicCurationBatchOperation){
+    /**
+     *  Link media to streams
+     */
+    OlapicCurationBatchOperationLink = 0,
+    /**
+     *  Unlink media from streams
+     */
+    OlapicCurationBatchOperationUnlink = 1,
+    /**
+     *  Set the status of media
+     */
+    OlapicCurationBatchOperationStatus = 2
+};
+/**
+ *  The states of a batch item
+ */
+typedef NS_ENUM(NSInteger, OlapicCurationBatchItemState){
+    /**
+     *  The item wasn't sent yet, or it's waiting for a retry
+     */
+    OlapicCurationBatchItemStatePending = 0,
+    /**
+     *  The item is on a request
+     */
+    OlapicCurationBatchItemStateRunning = 1,
+    /**
+     *  The operation worked for the item
+     */
+    OlapicCurationBatchItemStateCompleted = 2,
+    /**
+     *  The operation failed for the item, and it won't be retried
+     */
+    OlapicCurationBatchItemStateFailed = 3
+};
+
+@protocol OlapicCurationBatchDelegate;
+/**
+ *  Runs a curation operation (link, unlink or status) over a large
+ *  selection of media, with a predictable latency:
+ *
+ *  - The selection is split in chunks, so no request carries thousands
+ *    of items. Links and unlinks are sent per media (the SDK links a
+ *    media to several streams), with up to chunkSize streams on each
+ *    request; statuses are sent for up to chunkSize media at a time.
+ *  - Only a few chunks run at the same time (maximumConcurrentChunks).
+ *  - The result of every item is reported as each chunk finishes, along
+ *    with the progress.
+ *  - Only the failed items are sent again: the temporary errors follow
+ *    the retryPolicy, and retryFailedItems sends the rest again.
+ *
+ *  Every item is a dictionary with the following keys:
+ *  - media: The OlapicCurationMediaEntity object
+ *  - stream: The stream (only for links and unlinks)
+ *  - state: An OlapicCurationBatchItemState number
+ *  - attempts: The number of requests the item was sent on
+ *  - error: The last error (only for the failed items)
+ *
+ *  This object should be used from the main thread, and the delegate
+ *  is always called on the main thread.
+ */
+@interface OlapicCurationBatch : NSObject{
+    /**
+     *  A delegate object for the OlapicCurationBatchDelegate methods
+     */
+    id <OlapicCurationBatchDelegate>__weak delegate;
+    /**
+     *  The operation the batch runs
+     */
+    OlapicCurationBatchOperation operation;
+    /**
+     *  The status to set (only for OlapicCurationBatchOperationStatus)
+     */
+    OlapicMediaStatus *status;
+    /**
+     *  The maximum number of items per request
+     */
+    NSUInteger chunkSize;
+    /**
+     *  The maximum number of requests running at the same time
+     */
+    NSUInteger maximumConcurrentChunks;
+    /**
+     *  The policy for the automatic retries
+     */
+    OlapicRetryPolicy *retryPolicy;
+    /**
+     *  All the items, in order
+     */
+    NSMutableArray *items;
+    /**
+     *  The chunks waiting for their turn
+     */
+    NSMutableArray *queuedChunks;
+    /**
+     *  The number of chunks on a request
+     */
+    NSUInteger runningChunks;
+    /**
+     *  The number of groups of items waiting to be retried
+     */
+    NSUInteger waitingRetries;
+    /**
+     *  The number of items that worked
+     */
+    NSUInteger completedCount;
+    /**
+     *  The number of items that failed (and won't be retried)
+     */
+    NSUInteger failedCount;
+    /**
+     *  A flag to know if the batch is running
+     */
+    BOOL running;
+    /**
+     *  A flag to know if the batch was cancelled
+     */
+    BOOL cancelled;
+}
+
+@property (nonatomic,weak) id <OlapicCurationBatchDelegate>__weak delegate;
+@property (nonatomic,readonly) OlapicCurationBatchOperation operation;
+@property (nonatomic) NSUInteger chunkSize;
+@property (nonatomic) NSUInteger maximumConcurrentChunks;
+@property (nonatomic,strong) OlapicRetryPolicy *retryPolicy;
+@property (nonatomic,strong,readonly) NSArray *items;
+/**
+ *  Class constructor for linking media to streams
+ *
+ *  @param media          An array of OlapicCurationMediaEntity objects
+ *  @param streams        The streams to link every media to
+ *  @param delegateObject An object implementing the OlapicCurationBatchDelegate protocol
+ *
+ *  @return An instance of this object (OlapicCurationBatch)
+ */
+-(id)initForLinkingMedia:(NSArray *)media toStreams:(NSArray *)streams delegate:(id<OlapicCurationBatchDelegate>)delegateObject;
+/**
+ *  Class constructor for unlinking media from streams
+ *
+ *  @param media          An array of OlapicCurationMediaEntity objects
+ *  @param streams        The streams to unlink every media from
+ *  @param delegateObject An object implementing the OlapicCurationBatchDelegate protocol
+ *
+ *  @return An instance of this object (OlapicCurationBatch)
+ */
+-(id)initForUnlinkingMedia:(NSArray *)media fromStreams:(NSArray *)streams delegate:(id<OlapicCurationBatchDelegate>)delegateObject;
+/**
+ *  Class constructor for setting the status of media
+ *
+ *  @param mediaStatus    The new status
+ *  @param media          An array of OlapicCurationMediaEntity objects
+ *  @param delegateObject An object implementing the OlapicCurationBatchDelegate protocol
+ *
+ *  @return An instance of this object (OlapicCurationBatch)
+ */
+-(id)initForSettingStatus:(OlapicMediaStatus *)mediaStatus forMedia:(NSArray *)media delegate:(id<OlapicCurationBatchDelegate>)delegateObject;
+/**
+ *  Start sending the pending items
+ */
+-(void)start;
+/**
+ *  Stop sending new chunks. The SDK can't abort the requests already
+ *  sent, so their results are still reported
+ */
+-(void)cancel;
+/**
+ *  Send the failed items again
+ */
+-(void)retryFailedItems;
+/**
+ *  Check if the batch is running
+ *
+ *  @return YES if there are items being sent or waiting to be sent
+ */
+-(BOOL)isRunning;
+/**
+ *  Get how much of the batch is finished
+ *
+ *  @return A value between 0 and 1
+ */
+-(float)progress;
+/**
+ *  Get the items that worked
+ *
+ *  @return An array of item dictionaries
+ */
+-(NSArray *)completedItems;
+/**
+ *  Get the items that failed
+ *
+ *  @return An array of item dictionaries
+ */
+-(NSArray *)failedItems;
+
+@end
+/**
+ *  The protocol to listen for the batch results
+ */
+@protocol OlapicCurationBatchDelegate <NSObject>
+@optional
+/**
+ *  A chunk finished. The items that will be retried are not included
+ *
+ *  @param batch     The batch object
+ *  @param completed The items that worked
+ *  @param failed    The items that failed
+ */
+-(void)curationBatch:(OlapicCurationBatch *)batch didCompleteItems:(NSArray *)completed failedItems:(NSArray *)failed;
+/**
+ *  The progress changed
+ *
+ *  @param batch    The batch object
+ *  @param progress A value between 0 and 1
+ */
+-(void)curationBatch:(OlapicCurationBatch *)batch didChangeProgress:(float)progress;
+/**
+ *  All the items were sent (or the batch was cancelled)
+ *
+ *  @param batch  The batch object
+ *  @param failed The items that failed
+ */
+-(void)curationBatch:(OlapicCurationBatch *)batch didFinishWithFailedItems:(NSArray *)failed;
+@end
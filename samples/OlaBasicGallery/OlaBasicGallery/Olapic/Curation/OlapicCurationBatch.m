@@ -0,0 +1,455 @@
+//
+//  OlapicCurationBatch.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+// The default number of items per request
+#define kCurationBatchChunkSize 25
+// The default number of requests running at the same time
+#define kCurationBatchConcurrentChunks 4
+// The error code of an item the API didn't complete
+#define kCurationBatchErrorNotCompleted 0
+// The error code of an item whose result doesn't have the documented format
+#define kCurationBatchErrorUnexpectedResult 1
+
+#import "OlapicCurationBatch.h"
+#import "OlapicRateLimiter.h"
+
+@interface OlapicCurationBatch()
+/**
+ *  Class constructor
+ *
+ *  @param batchOperation The operation
+ *  @param media          An array of OlapicCurationMediaEntity objects
+ *  @param streams        The streams (only for links and unlinks)
+ *  @param delegateObject An object implementing the OlapicCurationBatchDelegate protocol
+ *
+ *  @return An instance of this object (OlapicCurationBatch)
+ */
+-(id)initWithOperation:(OlapicCurationBatchOperation)batchOperation media:(NSArray *)media streams:(NSArray *)streams delegate:(id<OlapicCurationBatchDelegate>)delegateObject;
+/**
+ *  Split items in chunks and add them to the queue
+ *
+ *  @param pendingItems The items to send
+ */
+-(void)enqueueItems:(NSArray *)pendingItems;
+/**
+ *  Send the queued chunks while there's room for them
+ */
+-(void)startChunks;
+/**
+ *  Send a chunk using the SDK, when the rate limiter has a token for the
+ *  curation endpoints, so a big batch doesn't reach the server limits
+ *
+ *  @param chunk The items of the chunk
+ */
+-(void)sendChunk:(NSArray *)chunk;
+/**
+ *  Save the results of a chunk, report them and schedule the retries
+ *
+ *  @param chunk  The items of the chunk
+ *  @param result The result from the SDK (nil if the request failed)
+ *  @param error  The error, if the request failed
+ */
+-(void)finishChunk:(NSArray *)chunk withResult:(NSArray *)result error:(NSError *)error;
+/**
+ *  Inform the delegate if there's nothing else to send
+ */
+-(void)finishIfDone;
+/**
+ *  Get the items in a state
+ *
+ *  @param state The state
+ *
+ *  @return An array of item dictionaries
+ */
+-(NSArray *)itemsWithState:(OlapicCurationBatchItemState)state;
+/**
+ *  Check if the result of a request says that one of its items worked.
+ *  The status requests only call the success block when every status
+ *  changed. The links and unlinks get a list with an entry per stream,
+ *  in the order they were sent, with a 'done' flag
+ *
+ *  @param index          The item index on the chunk
+ *  @param result         The result from the SDK
+ *  @param count          The number of items on the chunk
+ *  @param batchOperation The operation of the request
+ *  @param error          Set when the item didn't work, or the result doesn't have that format
+ *
+ *  @return YES if the item worked
+ */
++(BOOL)isCompletedItemAtIndex:(NSUInteger)index inResult:(id)result count:(NSUInteger)count operation:(OlapicCurationBatchOperation)batchOperation error:(NSError **)error;
+
+@end
+
+@implementation OlapicCurationBatch
+@synthesize delegate,operation,chunkSize,maximumConcurrentChunks,retryPolicy,items;
+/**
+ *  Class constructor for linking media to streams
+ *
+ *  @param media          An array of OlapicCurationMediaEntity objects
+ *  @param streams        The streams to link every media to
+ *  @param delegateObject An object implementing the OlapicCurationBatchDelegate protocol
+ *
+ *  @return An instance of this object (OlapicCurationBatch)
+ */
+-(id)initForLinkingMedia:(NSArray *)media toStreams:(NSArray *)streams delegate:(id<OlapicCurationBatchDelegate>)delegateObject{
+    return [self initWithOperation:OlapicCurationBatchOperationLink media:media streams:streams delegate:delegateObject];
+}
+/**
+ *  Class constructor for unlinking media from streams
+ *
+ *  @param media          An array of OlapicCurationMediaEntity objects
+ *  @param streams        The streams to unlink every media from
+ *  @param delegateObject An object implementing the OlapicCurationBatchDelegate protocol
+ *
+ *  @return An instance of this object (OlapicCurationBatch)
+ */
+-(id)initForUnlinkingMedia:(NSArray *)media fromStreams:(NSArray *)streams delegate:(id<OlapicCurationBatchDelegate>)delegateObject{
+    return [self initWithOperation:OlapicCurationBatchOperationUnlink media:media streams:streams delegate:delegateObject];
+}
+/**
+ *  Class constructor for setting the status of media
+ *
+ *  @param mediaStatus    The new status
+ *  @param media          An array of OlapicCurationMediaEntity objects
+ *  @param delegateObject An object implementing the OlapicCurationBatchDelegate protocol
+ *
+ *  @return An instance of this object (OlapicCurationBatch)
+ */
+-(id)initForSettingStatus:(OlapicMediaStatus *)mediaStatus forMedia:(NSArray *)media delegate:(id<OlapicCurationBatchDelegate>)delegateObject{
+    self = [self initWithOperation:OlapicCurationBatchOperationStatus media:media streams:nil delegate:delegateObject];
+    if(self){
+        status = mediaStatus;
+    }
+    return self;
+}
+/**
+ *  Class constructor
+ *
+ *  @param batchOperation The operation
+ *  @param media          An array of OlapicCurationMediaEntity objects
+ *  @param streams        The streams (only for links and unlinks)
+ *  @param delegateObject An object implementing the OlapicCurationBatchDelegate protocol
+ *
+ *  @return An instance of this object (OlapicCurationBatch)
+ */
+-(id)initWithOperation:(OlapicCurationBatchOperation)batchOperation media:(NSArray *)media streams:(NSArray *)streams delegate:(id<OlapicCurationBatchDelegate>)delegateObject{
+    self = [super init];
+    if(self){
+        operation = batchOperation;
+        delegate = delegateObject;
+        chunkSize = kCurationBatchChunkSize;
+        maximumConcurrentChunks = kCurationBatchConcurrentChunks;
+        retryPolicy = [OlapicRetryPolicy defaultPolicy];
+        items = [[NSMutableArray alloc] init];
+        queuedChunks = [[NSMutableArray alloc] init];
+        runningChunks = 0;
+        waitingRetries = 0;
+        completedCount = 0;
+        failedCount = 0;
+        running = NO;
+        cancelled = NO;
+        // The items of the same media go together, so they can share a request
+        for(int m = 0; m < [media count]; m++){
+            NSUInteger streamCount = operation == OlapicCurationBatchOperationStatus ? 1 : [streams count];
+            for(int s = 0; s < streamCount; s++){
+                NSMutableDictionary *item = [[NSMutableDictionary alloc] init];
+                [item setObject:[media objectAtIndex:m] forKey:@"media"];
+                if(operation != OlapicCurationBatchOperationStatus){
+                    [item setObject:[streams objectAtIndex:s] forKey:@"stream"];
+                }
+                [item setObject:@(OlapicCurationBatchItemStatePending) forKey:@"state"];
+                [item setObject:@0 forKey:@"attempts"];
+                [items addObject:item];
+            }
+        }
+    }
+    return self;
+}
+/**
+ *  Start sending the pending items
+ */
+-(void)start{
+    if(running) return;
+    running = YES;
+    cancelled = NO;
+    [self enqueueItems:[self itemsWithState:OlapicCurationBatchItemStatePending]];
+    [self startChunks];
+}
+/**
+ *  Stop sending new chunks. The SDK can't abort the requests already
+ *  sent, so their results are still reported
+ */
+-(void)cancel{
+    if(!running) return;
+    cancelled = YES;
+    // The queued items stay pending, so start sends them later
+    [queuedChunks removeAllObjects];
+    [self finishIfDone];
+}
+/**
+ *  Send the failed items again
+ */
+-(void)retryFailedItems{
+    NSArray *failed = [self itemsWithState:OlapicCurationBatchItemStateFailed];
+    if([failed count] == 0) return;
+    for(int i = 0; i < [failed count]; i++){
+        NSMutableDictionary *item = [failed objectAtIndex:i];
+        [item setObject:@(OlapicCurationBatchItemStatePending) forKey:@"state"];
+        [item setObject:@0 forKey:@"attempts"];
+        [item removeObjectForKey:@"error"];
+    }
+    failedCount -= [failed count];
+    if([delegate respondsToSelector:@selector(curationBatch:didChangeProgress:)]){
+        [delegate curationBatch:self didChangeProgress:[self progress]];
+    }
+    if(!running){
+        [self start];
+        return;
+    }
+    cancelled = NO;
+    [self enqueueItems:failed];
+    [self startChunks];
+}
+/**
+ *  Check if the batch is running
+ *
+ *  @return YES if there are items being sent or waiting to be sent
+ */
+-(BOOL)isRunning{
+    return running;
+}
+/**
+ *  Get how much of the batch is finished
+ *
+ *  @return A value between 0 and 1
+ */
+-(float)progress{
+    if([items count] == 0) return 1;
+    return (float)(completedCount + failedCount) / (float)[items count];
+}
+/**
+ *  Get the items that worked
+ *
+ *  @return An array of item dictionaries
+ */
+-(NSArray *)completedItems{
+    return [self itemsWithState:OlapicCurationBatchItemStateCompleted];
+}
+/**
+ *  Get the items that failed
+ *
+ *  @return An array of item dictionaries
+ */
+-(NSArray *)failedItems{
+    return [self itemsWithState:OlapicCurationBatchItemStateFailed];
+}
+
+#pragma mark - Chunks
+/**
+ *  Split items in chunks and add them to the queue
+ *
+ *  @param pendingItems The items to send
+ */
+-(void)enqueueItems:(NSArray *)pendingItems{
+    NSMutableArray *chunk = nil;
+    for(int i = 0; i < [pendingItems count]; i++){
+        NSDictionary *item = [pendingItems objectAtIndex:i];
+        // A link or an unlink request is for a single media
+        BOOL otherMedia = chunk && operation != OlapicCurationBatchOperationStatus && [[chunk firstObject] objectForKey:@"media"] != [item objectForKey:@"media"];
+        if(!chunk || [chunk count] >= MAX(1, chunkSize) || otherMedia){
+            chunk = [[NSMutableArray alloc] init];
+            [queuedChunks addObject:chunk];
+        }
+        [chunk addObject:item];
+    }
+}
+/**
+ *  Send the queued chunks while there's room for them
+ */
+-(void)startChunks{
+    while(!cancelled && runningChunks < MAX(1, maximumConcurrentChunks) && [queuedChunks count] > 0){
+        NSArray *chunk = [queuedChunks firstObject];
+        [queuedChunks removeObjectAtIndex:0];
+        runningChunks++;
+        [self sendChunk:chunk];
+    }
+    [self finishIfDone];
+}
+/**
+ *  Send a chunk using the SDK, when the rate limiter has a token for the
+ *  curation endpoints, so a big batch doesn't reach the server limits
+ *
+ *  @param chunk The items of the chunk
+ */
+-(void)sendChunk:(NSArray *)chunk{
+    for(int i = 0; i < [chunk count]; i++){
+        NSMutableDictionary *item = [chunk objectAtIndex:i];
+        [item setObject:@(OlapicCurationBatchItemStateRunning) forKey:@"state"];
+        [item setObject:@([[item objectForKey:@"attempts"] unsignedIntegerValue] + 1) forKey:@"attempts"];
+    }
+    void (^success)(NSArray *) = ^(NSArray *result){
+        [self finishChunk:chunk withResult:result error:nil];
+    };
+    void (^failure)(NSError *) = ^(NSError *error){
+        [self finishChunk:chunk withResult:nil error:error];
+    };
+    [[OlapicRateLimiter sharedRateLimiter] scheduleRequestForEndpointClass:@"curation" priority:OlapicRequestPriorityNormal usingBlock:^{
+        OlapicMediaHandler *handler = [[OlapicSDK sharedOlapicSDK] media];
+        OlapicCurationMediaEntity *media = [[chunk firstObject] objectForKey:@"media"];
+        switch(operation){
+            case OlapicCurationBatchOperationLink:
+                [handler linkMedia:media toStreams:[chunk valueForKey:@"stream"] onSuccess:success onFailure:failure];
+                break;
+            case OlapicCurationBatchOperationUnlink:
+                [handler unlinkMedia:media toStreams:[chunk valueForKey:@"stream"] onSuccess:success onFailure:failure];
+                break;
+            case OlapicCurationBatchOperationStatus:
+                [handler setStatus:status forMedia:[chunk valueForKey:@"media"] onSuccess:success onFailure:failure];
+                break;
+        }
+    }];
+}
+/**
+ *  Save the results of a chunk, report them and schedule the retries
+ *
+ *  @param chunk  The items of the chunk
+ *  @param result The result from the SDK (nil if the request failed)
+ *  @param error  The error, if the request failed
+ */
+-(void)finishChunk:(NSArray *)chunk withResult:(NSArray *)result error:(NSError *)error{
+    runningChunks--;
+    NSMutableArray *completed = [[NSMutableArray alloc] init];
+    NSMutableArray *failed = [[NSMutableArray alloc] init];
+    NSMutableArray *retries = [[NSMutableArray alloc] init];
+    NSTimeInterval retryDelay = 0;
+    for(int i = 0; i < [chunk count]; i++){
+        NSMutableDictionary *item = [chunk objectAtIndex:i];
+        NSError *resultError = nil;
+        if(!error && [OlapicCurationBatch isCompletedItemAtIndex:i inResult:result count:[chunk count] operation:operation error:&resultError]){
+            [item setObject:@(OlapicCurationBatchItemStateCompleted) forKey:@"state"];
+            [item removeObjectForKey:@"error"];
+            [completed addObject:item];
+            completedCount++;
+            continue;
+        }
+        NSUInteger attempts = [[item objectForKey:@"attempts"] unsignedIntegerValue];
+        [item setObject:(error ? error : resultError) forKey:@"error"];
+        // The items the API rejected on a request that worked are retried
+        // while there are attempts left, as the error doesn't say more. A
+        // result with another format fails, as sending it again won't help
+        BOOL retry = !cancelled && (error ? [retryPolicy shouldRetryError:error afterAttempt:attempts] : [resultError code] == kCurationBatchErrorNotCompleted && attempts < [retryPolicy maximumAttempts]);
+        if(retry){
+            [item setObject:@(OlapicCurationBatchItemStatePending) forKey:@"state"];
+            [retries addObject:item];
+            retryDelay = MAX(retryDelay, [retryPolicy delayAfterAttempt:attempts forError:error]);
+        }else{
+            [item setObject:@(OlapicCurationBatchItemStateFailed) forKey:@"state"];
+            [failed addObject:item];
+            failedCount++;
+        }
+    }
+    if(([completed count] > 0 || [failed count] > 0) && [delegate respondsToSelector:@selector(curationBatch:didCompleteItems:failedItems:)]){
+        [delegate curationBatch:self didCompleteItems:completed failedItems:failed];
+    }
+    if([delegate respondsToSelector:@selector(curationBatch:didChangeProgress:)]){
+        [delegate curationBatch:self didChangeProgress:[self progress]];
+    }
+    if([retries count] > 0){
+        waitingRetries++;
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(retryDelay * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+            waitingRetries--;
+            // If the batch was cancelled meanwhile, the items stay pending
+            if(!cancelled){
+                [self enqueueItems:retries];
+            }
+            [self startChunks];
+        });
+    }
+    [self startChunks];
+}
+/**
+ *  Inform the delegate if there's nothing else to send
+ */
+-(void)finishIfDone{
+    if(!running || runningChunks > 0 || waitingRetries > 0 || [queuedChunks count] > 0) return;
+    running = NO;
+    if([delegate respondsToSelector:@selector(curationBatch:didFinishWithFailedItems:)]){
+        [delegate curationBatch:self didFinishWithFailedItems:[self failedItems]];
+    }
+}
+/**
+ *  Get the items in a state
+ *
+ *  @param state The state
+ *
+ *  @return An array of item dictionaries
+ */
+-(NSArray *)itemsWithState:(OlapicCurationBatchItemState)state{
+    NSMutableArray *result = [[NSMutableArray alloc] init];
+    for(int i = 0; i < [items count]; i++){
+        NSDictionary *item = [items objectAtIndex:i];
+        if([[item objectForKey:@"state"] integerValue] == state){
+            [result addObject:item];
+        }
+    }
+    return result;
+}
+/**
+ *  Check if the result of a request says that one of its items worked.
+ *  The status requests only call the success block when every status
+ *  changed. The links and unlinks get a list with an entry per stream,
+ *  in the order they were sent, with a 'done' flag
+ *
+ *  @param index          The item index on the chunk
+ *  @param result         The result from the SDK
+ *  @param count          The number of items on the chunk
+ *  @param batchOperation The operation of the request
+ *  @param error          Set when the item didn't work, or the result doesn't have that format
+ *
+ *  @return YES if the item worked
+ */
++(BOOL)isCompletedItemAtIndex:(NSUInteger)index inResult:(id)result count:(NSUInteger)count operation:(OlapicCurationBatchOperation)batchOperation error:(NSError **)error{
+    if(batchOperation == OlapicCurationBatchOperationStatus) return YES;
+    id entry = [result isKindOfClass:[NSArray class]] && [result count] == count ? [result objectAtIndex:index] : nil;
+    id done = [entry isKindOfClass:[NSDictionary class]] ? [entry objectForKey:@"done"] : nil;
+    if(![done isKindOfClass:[NSNumber class]]){
+        if(error) *error = [NSError errorWithDomain:@"OlapicCurationBatch" code:kCurationBatchErrorUnexpectedResult userInfo:@{NSLocalizedDescriptionKey: @"The API result doesn't have the expected format"}];
+        return NO;
+    }
+    if(![done boolValue]){
+        if(error) *error = [NSError errorWithDomain:@"OlapicCurationBatch" code:kCurationBatchErrorNotCompleted userInfo:@{NSLocalizedDescriptionKey: @"The API didn't complete the operation for the item"}];
+        return NO;
+    }
+    return YES;
+}
+
+@end
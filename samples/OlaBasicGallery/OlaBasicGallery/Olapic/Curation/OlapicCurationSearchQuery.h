@@ -0,0 +1,141 @@
+//
+//  OlapicCurationSearchQuery.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <OlapicSDK/OlapicCurationMediaList.h>
+/**
+ *  The text and the filters of a curation search, as a value object.
+ *
+ *  Two queries that would bring the same results (the same text with
+ *  different case or spaces, the same sources in another order) have
+ *  the same key, so the key can be used to cache the results.
+ */
+@interface OlapicCurationSearchQuery : NSObject<NSCopying>{
+    /**
+     *  The text to search (it can have # and @)
+     */
+    NSString *text;
+    /**
+     *  The default status filter
+     */
+    OlapicCurationMediaListStatusFilterType status;
+    /**
+     *  The favorites filter
+     */
+    OlapicCurationMediaListFavoritesFilterType favorited;
+    /**
+     *  The media sources, or nil for all of them
+     */
+    NSArray *sources;
+    /**
+     *  The start date filter, or nil
+     */
+    NSString *dateFrom;
+    /**
+     *  The end date filter, or nil
+     */
+    NSString *dateTo;
+}
+
+@property (nonatomic,strong) NSString *text;
+@property (nonatomic) OlapicCurationMediaListStatusFilterType status;
+@property (nonatomic) OlapicCurationMediaListFavoritesFilterType favorited;
+@property (nonatomic,strong) NSArray *sources;
+@property (nonatomic,strong) NSString *dateFrom;
+@property (nonatomic,strong) NSString *dateTo;
+/**
+ *  Class constructor
+ *
+ *  @param searchText The text to search
+ *
+ *  @return An instance of this object (OlapicCurationSearchQuery)
+ */
+-(id)initWithText:(NSString *)searchText;
+/**
+ *  Get the text without extra spaces and in lowercase
+ *
+ *  @return The normalized text
+ */
+-(NSString *)normalizedText;
+/**
+ *  Get the words of the normalized text
+ *
+ *  @return An array of strings
+ */
+-(NSArray *)terms;
+/**
+ *  Get a key that identifies the query and its filters
+ *
+ *  @return The key
+ */
+-(NSString *)key;
+/**
+ *  Check if the query only has filters (no text)
+ *
+ *  @return YES if the normalized text is empty
+ */
+-(BOOL)isEmpty;
+/**
+ *  Check if the query has a filter that's not the default one
+ *
+ *  @return YES if the status, favorites, sources or dates filter something
+ */
+-(BOOL)hasFilters;
+/**
+ *  Check if the results of this query are a subset of the results of
+ *  another one: the same filters, and a text that includes all the
+ *  words of the other one (like when the user keeps typing, or types
+ *  a text after choosing only filters)
+ *
+ *  @param query The broader query
+ *
+ *  @return YES if this query narrows the other one
+ */
+-(BOOL)narrowsQuery:(OlapicCurationSearchQuery *)query;
+/**
+ *  Check if a media matches the text, looking at the caption and the uploader
+ *
+ *  @param media The media entity
+ *
+ *  @return YES if all the words of the text are on the media
+ */
+-(BOOL)matchesMedia:(OlapicMediaEntity *)media;
+/**
+ *  Create a curation list for the query
+ *
+ *  @param delegateObject The delegate for the list
+ *
+ *  @return The list, ready to start fetching
+ */
+-(OlapicCurationMediaList *)listWithDelegate:(id<OlapicMediaListDelegate>)delegateObject;
+
+@end
@@ -0,0 +1,191 @@
+//
+//  OlapicCurationSearchQuery.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "OlapicCurationSearchQuery.h"
+#import <OlapicSDK/OlapicSDK.h>
+
+@interface OlapicCurationSearchQuery()
+/**
+ *  Get the filters part of the key
+ *
+ *  @return A string with all the filters
+ */
+-(NSString *)filtersKey;
+
+@end
+
+@implementation OlapicCurationSearchQuery
+@synthesize text,status,favorited,sources,dateFrom,dateTo;
+/**
+ *  Class constructor
+ *
+ *  @param searchText The text to search
+ *
+ *  @return An instance of this object (OlapicCurationSearchQuery)
+ */
+-(id)initWithText:(NSString *)searchText{
+    self = [super init];
+    if(self){
+        text = searchText ? searchText : @"";
+        status = OlapicCurationMediaListStatusFilterTypeAll;
+        favorited = OlapicCurationMediaListFavoritesFilterTypeNone;
+    }
+    return self;
+}
+/**
+ *  Get the text without extra spaces and in lowercase
+ *
+ *  @return The normalized text
+ */
+-(NSString *)normalizedText{
+    return [[self terms] componentsJoinedByString:@" "];
+}
+/**
+ *  Get the words of the normalized text
+ *
+ *  @return An array of strings
+ */
+-(NSArray *)terms{
+    NSArray *words = [[text lowercaseString] componentsSeparatedByCharactersInSet:[NSCharacterSet whitespaceAndNewlineCharacterSet]];
+    NSMutableArray *terms = [[NSMutableArray alloc] init];
+    for(int i = 0; i < [words count]; i++){
+        NSString *word = [words objectAtIndex:i];
+        if([word length] > 0) [terms addObject:word];
+    }
+    return terms;
+}
+/**
+ *  Get a key that identifies the query and its filters
+ *
+ *  @return The key
+ */
+-(NSString *)key{
+    return [NSString stringWithFormat:@"%@|%@",[self normalizedText],[self filtersKey]];
+}
+/**
+ *  Get the filters part of the key
+ *
+ *  @return A string with all the filters
+ */
+-(NSString *)filtersKey{
+    NSArray *sortedSources = sources ? [sources sortedArrayUsingSelector:@selector(compare:)] : @[];
+    return [NSString stringWithFormat:@"%ld|%ld|%@|%@|%@",(long)status,(long)favorited,[sortedSources componentsJoinedByString:@","],dateFrom ? dateFrom : @"",dateTo ? dateTo : @""];
+}
+/**
+ *  Check if the query only has filters (no text)
+ *
+ *  @return YES if the normalized text is empty
+ */
+-(BOOL)isEmpty{
+    return [[self terms] count] == 0;
+}
+/**
+ *  Check if the query has a filter that's not the default one
+ *
+ *  @return YES if the status, favorites, sources or dates filter something
+ */
+-(BOOL)hasFilters{
+    return status != OlapicCurationMediaListStatusFilterTypeAll || favorited != OlapicCurationMediaListFavoritesFilterTypeNone || [sources count] > 0 || [dateFrom length] > 0 || [dateTo length] > 0;
+}
+/**
+ *  Check if the results of this query are a subset of the results of
+ *  another one: the same filters, and a text that includes all the
+ *  words of the other one (like when the user keeps typing, or types
+ *  a text after choosing only filters)
+ *
+ *  @param query The broader query
+ *
+ *  @return YES if this query narrows the other one
+ */
+-(BOOL)narrowsQuery:(OlapicCurationSearchQuery *)query{
+    if(!query) return NO;
+    if(![[self filtersKey] isEqualToString:[query filtersKey]]) return NO;
+    NSString *normalized = [self normalizedText];
+    if([normalized isEqualToString:[query normalizedText]]) return NO;
+    NSArray *broaderTerms = [query terms];
+    for(int i = 0; i < [broaderTerms count]; i++){
+        if([normalized rangeOfString:[broaderTerms objectAtIndex:i]].location == NSNotFound) return NO;
+    }
+    return YES;
+}
+/**
+ *  Check if a media matches the text, looking at the caption and the uploader
+ *
+ *  @param media The media entity
+ *
+ *  @return YES if all the words of the text are on the media
+ */
+-(BOOL)matchesMedia:(OlapicMediaEntity *)media{
+    NSMutableString *content = [[NSMutableString alloc] init];
+    id caption = [media get:@"caption"];
+    if([caption isKindOfClass:[NSString class]]) [content appendFormat:@"%@ ",caption];
+    if(media.uploader){
+        id name = [media.uploader get:@"name"];
+        id username = [media.uploader get:@"username"];
+        if([name isKindOfClass:[NSString class]]) [content appendFormat:@"%@ ",name];
+        if([username isKindOfClass:[NSString class]]) [content appendFormat:@"@%@ ",username];
+    }
+    NSString *lowercaseContent = [content lowercaseString];
+    NSArray *terms = [self terms];
+    for(int i = 0; i < [terms count]; i++){
+        if([lowercaseContent rangeOfString:[terms objectAtIndex:i]].location == NSNotFound) return NO;
+    }
+    return YES;
+}
+/**
+ *  Create a curation list for the query
+ *
+ *  @param delegateObject The delegate for the list
+ *
+ *  @return The list, ready to start fetching
+ */
+-(OlapicCurationMediaList *)listWithDelegate:(id<OlapicMediaListDelegate>)delegateObject{
+    return [[OlapicCurationMediaList alloc] initWithSearch:[self normalizedText] delegate:delegateObject status:status favorited:favorited sources:sources dateFrom:dateFrom dateTo:dateTo];
+}
+/**
+ *  Copy the query
+ *
+ *  @param zone The memory zone
+ *
+ *  @return A new query with the same values
+ */
+-(id)copyWithZone:(NSZone *)zone{
+    OlapicCurationSearchQuery *copy = [[OlapicCurationSearchQuery allocWithZone:zone] initWithText:text];
+    copy.status = status;
+    copy.favorited = favorited;
+    copy.sources = sources;
+    copy.dateFrom = dateFrom;
+    copy.dateTo = dateTo;
+    return copy;
+}
+
+@end
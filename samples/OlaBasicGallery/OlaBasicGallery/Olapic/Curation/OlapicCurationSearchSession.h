@@ -0,0 +1,164 @@
+//
+//  OlapicCurationSearchSession.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <OlapicSDK/OlapicCurationMediaList.h>
+#import "OlapicCurationSearchQuery.h"
+
+@protocol OlapicCurationSearchSessionDelegate;
+/**
+ *  Runs the curation searches for a search box, so typing doesn't
+ *  create a request for every keystroke:
+ *
+ *  - The input is debounced: the search only starts when the user
+ *    stops typing for a moment.
+ *  - A new search replaces the one in progress. The SDK can't cancel
+ *    a list request, so the old list is detached from its delegate,
+ *    released, and its results are ignored.
+ *  - The results are cached by the query key, so repeating a query (or
+ *    going back to it with backspace) doesn't hit the network.
+ *  - When the user keeps typing, the cached results of the broader
+ *    query are filtered locally and sent right away as provisional
+ *    results, while the real search runs.
+ *
+ *  A query with only filters is searched too. A query without text
+ *  nor filters has no results, and doesn't hit the network.
+ */
+@interface OlapicCurationSearchSession : NSObject<OlapicMediaListDelegate>{
+    /**
+     *  A delegate object for the OlapicCurationSearchSessionDelegate methods
+     */
+    id <OlapicCurationSearchSessionDelegate>__weak delegate;
+    /**
+     *  How long to wait after the last input before searching (in seconds)
+     */
+    NSTimeInterval debounceInterval;
+    /**
+     *  The maximum number of queries on the cache
+     */
+    NSUInteger cacheLimit;
+    /**
+     *  The query of the current search
+     */
+    OlapicCurationSearchQuery *currentQuery;
+    /**
+     *  The list running the current search
+     */
+    OlapicCurationMediaList *currentList;
+    /**
+     *  The timer for the debounce
+     */
+    NSTimer *debounceTimer;
+    /**
+     *  The cached results, by query key. Each one is a dictionary with the
+     *  query, the media and the list (so more pages can be loaded)
+     */
+    NSMutableDictionary *results;
+    /**
+     *  The cached keys, from the least to the most recently used
+     */
+    NSMutableArray *recentKeys;
+}
+
+@property (nonatomic,weak) id <OlapicCurationSearchSessionDelegate>__weak delegate;
+@property (nonatomic) NSTimeInterval debounceInterval;
+@property (nonatomic) NSUInteger cacheLimit;
+@property (nonatomic,strong,readonly) OlapicCurationSearchQuery *currentQuery;
+/**
+ *  Class constructor
+ *
+ *  @param delegateObject An object implementing the OlapicCurationSearchSessionDelegate protocol
+ *
+ *  @return An instance of this object (OlapicCurationSearchSession)
+ */
+-(id)initWithDelegate:(id<OlapicCurationSearchSessionDelegate>)delegateObject;
+/**
+ *  The user changed the text or the filters. The cached results are sent
+ *  right away, and the search starts after the debounce interval
+ *
+ *  @param query The new query
+ */
+-(void)searchQuery:(OlapicCurationSearchQuery *)query;
+/**
+ *  Search a query right now, without waiting for the debounce (for
+ *  example, when the user taps the search button)
+ *
+ *  @param query The query
+ */
+-(void)searchQueryNow:(OlapicCurationSearchQuery *)query;
+/**
+ *  Load the next page of the current search
+ *
+ *  @return NO if there are no more pages or a page is loading
+ */
+-(BOOL)loadMoreResults;
+/**
+ *  Stop the current search and the debounce
+ */
+-(void)cancel;
+/**
+ *  Remove all the cached results (for example, after curating media,
+ *  since the results can change)
+ */
+-(void)clearCache;
+
+@end
+/**
+ *  The protocol to listen for the search results
+ */
+@protocol OlapicCurationSearchSessionDelegate <NSObject>
+@optional
+/**
+ *  There are results for a query
+ *
+ *  @param session The session object
+ *  @param media   All the media found so far, an array of OlapicMediaEntity objects
+ *  @param query   The query
+ *  @param final   NO if the results were filtered locally from a broader query, and the real search is still running
+ */
+-(void)searchSession:(OlapicCurationSearchSession *)session didFindMedia:(NSArray *)media forQuery:(OlapicCurationSearchQuery *)query final:(BOOL)final;
+/**
+ *  The search started a request to the API
+ *
+ *  @param session The session object
+ *  @param query   The query
+ */
+-(void)searchSession:(OlapicCurationSearchSession *)session didStartSearchingQuery:(OlapicCurationSearchQuery *)query;
+/**
+ *  The search failed
+ *
+ *  @param session The session object
+ *  @param error   The error it found
+ *  @param query   The query
+ */
+-(void)searchSession:(OlapicCurationSearchSession *)session didReceiveAnError:(NSError *)error forQuery:(OlapicCurationSearchQuery *)query;
+@end
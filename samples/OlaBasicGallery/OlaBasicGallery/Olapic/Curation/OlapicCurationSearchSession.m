@@ -0,0 +1,360 @@
+//
+//  OlapicCurationSearchSession.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+// The default time to wait after the last input (in seconds)
+#define kSearchSessionDebounceInterval 0.3
+// The default number of queries on the cache
+#define kSearchSessionCacheLimit 32
+
+#import "OlapicCurationSearchSession.h"
+#import <OlapicSDK/OlapicSDK.h>
+
+@interface OlapicCurationSearchSession()
+/**
+ *  The debounce timer fired, so it's time to search
+ *
+ *  @param timer The timer object
+ */
+-(void)debounceTimerFired:(NSTimer *)timer;
+/**
+ *  Stop the timer and forget the list of the current search
+ */
+-(void)stopCurrentSearch;
+/**
+ *  Start the API request for a query
+ *
+ *  @param query The query
+ */
+-(void)startSearchForQuery:(OlapicCurationSearchQuery *)query;
+/**
+ *  Find the cached results of the query, or filter the ones of a
+ *  broader query, and send them to the delegate
+ *
+ *  @param query The query
+ *
+ *  @return YES if the cache had the complete results (so there's no need to search)
+ */
+-(BOOL)sendCachedResultsForQuery:(OlapicCurationSearchQuery *)query;
+/**
+ *  Save the results of a query, removing the oldest ones if the
+ *  cache is full
+ *
+ *  @param entry The results dictionary
+ *  @param key   The query key
+ */
+-(void)cacheResults:(NSDictionary *)entry forKey:(NSString *)key;
+/**
+ *  Mark a cached query as the most recently used
+ *
+ *  @param key The query key
+ */
+-(void)touchKey:(NSString *)key;
+/**
+ *  Check if a query can be searched: it needs a text or a filter
+ *
+ *  @param query The query
+ *
+ *  @return NO if there's nothing to search
+ */
+-(BOOL)canSearchQuery:(OlapicCurationSearchQuery *)query;
+
+@end
+/**
+ *  The target of the debounce timer. The timer retains its target, so
+ *  it keeps a weak reference to the session instead, and the session
+ *  can be released (and stop the timer) while the timer is scheduled
+ */
+@interface OlapicCurationSearchSessionTimerTarget : NSObject
+/**
+ *  The session that gets the timer
+ */
+@property (nonatomic,weak) OlapicCurationSearchSession *session;
+
+@end
+
+@implementation OlapicCurationSearchSessionTimerTarget
+@synthesize session;
+/**
+ *  Send the timer to the session, if it's still alive
+ *
+ *  @param timer The timer object
+ */
+-(void)timerFired:(NSTimer *)timer{
+    OlapicCurationSearchSession *strongSession = session;
+    if(strongSession){
+        [strongSession debounceTimerFired:timer];
+    }else{
+        [timer invalidate];
+    }
+}
+
+@end
+
+@implementation OlapicCurationSearchSession
+@synthesize delegate,debounceInterval,cacheLimit,currentQuery;
+/**
+ *  Class constructor
+ *
+ *  @param delegateObject An object implementing the OlapicCurationSearchSessionDelegate protocol
+ *
+ *  @return An instance of this object (OlapicCurationSearchSession)
+ */
+-(id)initWithDelegate:(id<OlapicCurationSearchSessionDelegate>)delegateObject{
+    self = [super init];
+    if(self){
+        delegate = delegateObject;
+        debounceInterval = kSearchSessionDebounceInterval;
+        cacheLimit = kSearchSessionCacheLimit;
+        results = [[NSMutableDictionary alloc] init];
+        recentKeys = [[NSMutableArray alloc] init];
+    }
+    return self;
+}
+/**
+ *  The user changed the text or the filters. The cached results are sent
+ *  right away, and the search starts after the debounce interval
+ *
+ *  @param query The new query
+ */
+-(void)searchQuery:(OlapicCurationSearchQuery *)query{
+    if(currentQuery && [[currentQuery key] isEqualToString:[query key]]) return;
+    [self stopCurrentSearch];
+    currentQuery = [query copy];
+    if([self sendCachedResultsForQuery:currentQuery]) return;
+    OlapicCurationSearchSessionTimerTarget *target = [[OlapicCurationSearchSessionTimerTarget alloc] init];
+    target.session = self;
+    debounceTimer = [NSTimer scheduledTimerWithTimeInterval:debounceInterval target:target selector:@selector(timerFired:) userInfo:nil repeats:NO];
+}
+/**
+ *  Search a query right now, without waiting for the debounce (for
+ *  example, when the user taps the search button)
+ *
+ *  @param query The query
+ */
+-(void)searchQueryNow:(OlapicCurationSearchQuery *)query{
+    if(currentQuery && [[currentQuery key] isEqualToString:[query key]] && !debounceTimer) return;
+    [self stopCurrentSearch];
+    currentQuery = [query copy];
+    if([self sendCachedResultsForQuery:currentQuery]) return;
+    [self startSearchForQuery:currentQuery];
+}
+/**
+ *  Load the next page of the current search
+ *
+ *  @return NO if there are no more pages or a page is loading
+ */
+-(BOOL)loadMoreResults{
+    if(!currentQuery || debounceTimer) return NO;
+    NSDictionary *entry = [results objectForKey:[currentQuery key]];
+    OlapicCurationMediaList *list = [entry objectForKey:@"list"];
+    if(!list || [list fetching] || ![list canLoadNextPage]) return NO;
+    // The list is attached again, in case it came from the cache
+    currentList = list;
+    currentList.delegate = self;
+    [currentList loadNextPage];
+    return YES;
+}
+/**
+ *  Stop the current search and the debounce
+ */
+-(void)cancel{
+    [self stopCurrentSearch];
+    currentQuery = nil;
+}
+/**
+ *  Remove all the cached results (for example, after curating media,
+ *  since the results can change)
+ */
+-(void)clearCache{
+    [results removeAllObjects];
+    [recentKeys removeAllObjects];
+}
+/**
+ *  The debounce timer fired, so it's time to search
+ *
+ *  @param timer The timer object
+ */
+-(void)debounceTimerFired:(NSTimer *)timer{
+    debounceTimer = nil;
+    if(currentQuery) [self startSearchForQuery:currentQuery];
+}
+/**
+ *  Stop the timer and forget the list of the current search
+ */
+-(void)stopCurrentSearch{
+    [debounceTimer invalidate];
+    debounceTimer = nil;
+    if(currentList){
+        // There's no way to cancel the request, but without a delegate its results are dropped
+        currentList.delegate = nil;
+        currentList = nil;
+    }
+}
+/**
+ *  Start the API request for a query
+ *
+ *  @param query The query
+ */
+-(void)startSearchForQuery:(OlapicCurationSearchQuery *)query{
+    if(![self canSearchQuery:query]){
+        if([delegate respondsToSelector:@selector(searchSession:didFindMedia:forQuery:final:)]){
+            [delegate searchSession:self didFindMedia:@[] forQuery:query final:YES];
+        }
+        return;
+    }
+    currentList = [query listWithDelegate:self];
+    if([delegate respondsToSelector:@selector(searchSession:didStartSearchingQuery:)]){
+        [delegate searchSession:self didStartSearchingQuery:query];
+    }
+    [currentList startFetching];
+}
+/**
+ *  Find the cached results of the query, or filter the ones of a
+ *  broader query, and send them to the delegate
+ *
+ *  @param query The query
+ *
+ *  @return YES if the cache had the complete results (so there's no need to search)
+ */
+-(BOOL)sendCachedResultsForQuery:(OlapicCurationSearchQuery *)query{
+    BOOL respondsToResults = [delegate respondsToSelector:@selector(searchSession:didFindMedia:forQuery:final:)];
+    if(![self canSearchQuery:query]){
+        if(respondsToResults) [delegate searchSession:self didFindMedia:@[] forQuery:query final:YES];
+        return YES;
+    }
+    NSString *key = [query key];
+    NSDictionary *entry = [results objectForKey:key];
+    if(entry){
+        [self touchKey:key];
+        if(respondsToResults) [delegate searchSession:self didFindMedia:[entry objectForKey:@"media"] forQuery:query final:YES];
+        return YES;
+    }
+    // Look for the most specific broader query (the longest text), from the most recent
+    NSDictionary *broaderEntry = nil;
+    NSInteger broaderLength = -1;
+    for(NSInteger i = [recentKeys count] - 1; i >= 0; i--){
+        NSDictionary *candidate = [results objectForKey:[recentKeys objectAtIndex:i]];
+        OlapicCurationSearchQuery *candidateQuery = [candidate objectForKey:@"query"];
+        if([query narrowsQuery:candidateQuery] && (NSInteger)[[candidateQuery normalizedText] length] > broaderLength){
+            broaderEntry = candidate;
+            broaderLength = [[candidateQuery normalizedText] length];
+        }
+    }
+    if(broaderEntry && respondsToResults){
+        NSArray *broaderMedia = [broaderEntry objectForKey:@"media"];
+        NSMutableArray *filtered = [[NSMutableArray alloc] init];
+        for(int i = 0; i < [broaderMedia count]; i++){
+            OlapicMediaEntity *media = [broaderMedia objectAtIndex:i];
+            if([query matchesMedia:media]) [filtered addObject:media];
+        }
+        [delegate searchSession:self didFindMedia:filtered forQuery:query final:NO];
+    }
+    return NO;
+}
+/**
+ *  Save the results of a query, removing the oldest ones if the
+ *  cache is full
+ *
+ *  @param entry The results dictionary
+ *  @param key   The query key
+ */
+-(void)cacheResults:(NSDictionary *)entry forKey:(NSString *)key{
+    [results setObject:entry forKey:key];
+    [self touchKey:key];
+    while([recentKeys count] > cacheLimit){
+        NSString *oldest = [recentKeys objectAtIndex:0];
+        OlapicCurationMediaList *list = [[results objectForKey:oldest] objectForKey:@"list"];
+        if(list != currentList) list.delegate = nil;
+        [results removeObjectForKey:oldest];
+        [recentKeys removeObjectAtIndex:0];
+    }
+}
+/**
+ *  Mark a cached query as the most recently used
+ *
+ *  @param key The query key
+ */
+-(void)touchKey:(NSString *)key{
+    [recentKeys removeObject:key];
+    [recentKeys addObject:key];
+}
+/**
+ *  Check if a query can be searched: it needs a text or a filter (a
+ *  search with only filters lists all the media that match them)
+ *
+ *  @param query The query
+ *
+ *  @return NO if there's nothing to search
+ */
+-(BOOL)canSearchQuery:(OlapicCurationSearchQuery *)query{
+    return ![query isEmpty] || [query hasFilters];
+}
+
+#pragma mark - List Delegate
+/**
+ *  The list of the current search downloaded a page
+ *
+ *  @param mediaList The media list object
+ *  @param media     An array of media objects
+ *  @param links     The links to the API from where this media objects were downloaded
+ */
+-(void)OlapicMediaList:(OlapicMediaList *)mediaList didLoadMedia:(NSArray *)media withLinks:(NSDictionary *)links{
+    if(mediaList != currentList || !currentQuery) return;
+    NSString *key = [currentQuery key];
+    NSArray *previous = [[results objectForKey:key] objectForKey:@"media"];
+    NSArray *allMedia = previous ? [previous arrayByAddingObjectsFromArray:media] : media;
+    [self cacheResults:@{@"query": currentQuery, @"media": allMedia, @"list": mediaList} forKey:key];
+    if([delegate respondsToSelector:@selector(searchSession:didFindMedia:forQuery:final:)]){
+        [delegate searchSession:self didFindMedia:allMedia forQuery:currentQuery final:YES];
+    }
+}
+/**
+ *  The list of the current search found an error
+ *
+ *  @param mediaList The media list object
+ *  @param error     The error it found
+ */
+-(void)OlapicMediaList:(OlapicMediaList *)mediaList didReceiveAnError:(NSError *)error{
+    if(mediaList != currentList || !currentQuery) return;
+    if([delegate respondsToSelector:@selector(searchSession:didReceiveAnError:forQuery:)]){
+        [delegate searchSession:self didReceiveAnError:error forQuery:currentQuery];
+    }
+}
+/**
+ *  Stop the timer and detach the list
+ */
+-(void)dealloc{
+    [debounceTimer invalidate];
+    currentList.delegate = nil;
+}
+
+@end
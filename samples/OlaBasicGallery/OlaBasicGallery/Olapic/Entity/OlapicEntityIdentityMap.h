@@ -0,0 +1,116 @@
+//
+//  OlapicEntityIdentityMap.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+
+@class OlapicEntity;
+/**
+ *  Makes sure that the same API resource is represented by a single
+ *  object, no matter how many responses include it.
+ *
+ *  - Entities are registered by type (their class) and ID; resolving an
+ *    entity that is already registered returns the registered instance,
+ *    updated with the newer data.
+ *  - Embedded resources (the '_embedded' dictionaries inside an entity data,
+ *    like the uploader, streams or categories) are shared by name and ID, so
+ *    a page where all the media comes from the same stream holds a single
+ *    copy of that stream.
+ *
+ *  The map doesn't keep the objects alive: once nothing else uses an
+ *  entity, it's removed from the map. It can be used from any thread, so
+ *  the responses can be resolved where they are processed.
+ */
+@interface OlapicEntityIdentityMap : NSObject{
+    /**
+     *  The registered entities, by type and ID
+     */
+    NSMapTable *entities;
+    /**
+     *  The shared embedded resources dictionaries, by name and ID
+     */
+    NSMapTable *embedded;
+}
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared map
+ */
++(instancetype)sharedIdentityMap;
+/**
+ *  Get the registered instance for an entity. If there's one, it's
+ *  updated with the data of the given entity; if there isn't, the
+ *  given entity is registered and returned. In both cases, its embedded
+ *  resources are shared.
+ *
+ *  @param entity The entity from an API response
+ *
+ *  @return The instance that should be used from now on
+ */
+-(id)resolveEntity:(OlapicEntity *)entity;
+/**
+ *  Resolve a list of entities
+ *
+ *  @param list A list of OlapicEntity objects
+ *
+ *  @return A list with the instances that should be used from now on, in the same order
+ */
+-(NSArray *)resolveEntities:(NSArray *)list;
+/**
+ *  Get the registered instance for a type and ID
+ *
+ *  @param type     The entity class
+ *  @param entityID The entity ID
+ *
+ *  @return The entity or nil
+ */
+-(id)entityOfType:(Class)type withID:(NSString *)entityID;
+/**
+ *  Replace the embedded resources of an entity with the shared ones
+ *
+ *  @param entity The entity
+ */
+-(void)shareEmbeddedResourcesOfEntity:(OlapicEntity *)entity;
+/**
+ *  Remove everything from the map
+ */
+-(void)clear;
+/**
+ *  Get the key used to register an entity
+ *
+ *  @param type     The entity class
+ *  @param entityID The entity ID
+ *
+ *  @return The key or nil, if there's no ID
+ */
++(NSString *)keyForType:(Class)type withID:(id)entityID;
+
+@end
@@ -0,0 +1,218 @@
+//
+//  OlapicEntityIdentityMap.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "OlapicEntityIdentityMap.h"
+#import <OlapicSDK/OlapicSDK.h>
+
+@interface OlapicEntityIdentityMap()
+/**
+ *  Get the shared dictionary for an embedded resource, updating
+ *  it with the given values
+ *
+ *  @param resource The embedded resource from the API response
+ *  @param name     The name of the embedded resource ('uploader', 'streams:all', etc.)
+ *
+ *  @return The shared dictionary
+ */
+-(id)sharedResource:(NSDictionary *)resource named:(NSString *)name;
+
+@end
+
+@implementation OlapicEntityIdentityMap
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared map
+ */
++(instancetype)sharedIdentityMap{
+    static OlapicEntityIdentityMap *sharedMap = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedMap = [[OlapicEntityIdentityMap alloc] init];
+    });
+    return sharedMap;
+}
+/**
+ *  Class constructor
+ *
+ *  @return An instance of this object (OlapicEntityIdentityMap)
+ */
+-(id)init{
+    self = [super init];
+    if(self){
+        entities = [NSMapTable strongToWeakObjectsMapTable];
+        embedded = [NSMapTable strongToWeakObjectsMapTable];
+    }
+    return self;
+}
+/**
+ *  Get the registered instance for an entity. If there's one, it's
+ *  updated with the data of the given entity; if there isn't, the
+ *  given entity is registered and returned. In both cases, its embedded
+ *  resources are shared.
+ *
+ *  @param entity The entity from an API response
+ *
+ *  @return The instance that should be used from now on
+ */
+-(id)resolveEntity:(OlapicEntity *)entity{
+    @synchronized(self){
+        if(!entity) return nil;
+        [self shareEmbeddedResourcesOfEntity:entity];
+        if([entity isKindOfClass:[OlapicMediaEntity class]] && [(OlapicMediaEntity *)entity uploader]){
+            OlapicMediaEntity *media = (OlapicMediaEntity *)entity;
+            media.uploader = [self resolveEntity:media.uploader];
+        }
+        NSString *key = [OlapicEntityIdentityMap keyForType:[entity class] withID:[entity get:@"id"]];
+        if(!key) return entity;
+        OlapicEntity *existing = [entities objectForKey:key];
+        if(!existing){
+            [entities setObject:entity forKey:key];
+            return entity;
+        }
+        if(existing != entity && ![[existing data] isEqualToDictionary:[entity data]]){
+            // Refresh the registered instance, so everyone using it gets the new data
+            NSMutableDictionary *merged = [[NSMutableDictionary alloc] initWithDictionary:[existing data]];
+            [merged addEntriesFromDictionary:[entity data]];
+            existing.data = merged;
+            if([existing isKindOfClass:[OlapicMediaEntity class]]){
+                OlapicMediaEntity *existingMedia = (OlapicMediaEntity *)existing;
+                OlapicMediaEntity *media = (OlapicMediaEntity *)entity;
+                if(media.uploader) existingMedia.uploader = media.uploader;
+                if(media.originalSize.width > 0) existingMedia.originalSize = media.originalSize;
+            }
+        }
+        return existing;
+    }
+}
+/**
+ *  Resolve a list of entities
+ *
+ *  @param list A list of OlapicEntity objects
+ *
+ *  @return A list with the instances that should be used from now on, in the same order
+ */
+-(NSArray *)resolveEntities:(NSArray *)list{
+    @synchronized(self){
+        NSMutableArray *resolved = [[NSMutableArray alloc] initWithCapacity:[list count]];
+        for(int i = 0; i < [list count]; i++){
+            [resolved addObject:[self resolveEntity:[list objectAtIndex:i]]];
+        }
+        return resolved;
+    }
+}
+/**
+ *  Get the registered instance for a type and ID
+ *
+ *  @param type     The entity class
+ *  @param entityID The entity ID
+ *
+ *  @return The entity or nil
+ */
+-(id)entityOfType:(Class)type withID:(NSString *)entityID{
+    @synchronized(self){
+        NSString *key = [OlapicEntityIdentityMap keyForType:type withID:entityID];
+        return key ? [entities objectForKey:key] : nil;
+    }
+}
+/**
+ *  Replace the embedded resources of an entity with the shared ones
+ *
+ *  @param entity The entity
+ */
+-(void)shareEmbeddedResourcesOfEntity:(OlapicEntity *)entity{
+    id resources = [[entity data] objectForKey:@"_embedded"];
+    if(![resources isKindOfClass:[NSDictionary class]]) return;
+    NSMutableDictionary *shared = [[NSMutableDictionary alloc] initWithCapacity:[resources count]];
+    for(NSString *name in resources){
+        id value = [resources objectForKey:name];
+        if([value isKindOfClass:[NSDictionary class]]){
+            value = [self sharedResource:value named:name];
+        }else if([value isKindOfClass:[NSArray class]]){
+            NSMutableArray *items = [[NSMutableArray alloc] initWithCapacity:[value count]];
+            for(id item in value){
+                [items addObject:([item isKindOfClass:[NSDictionary class]] ? [self sharedResource:item named:name] : item)];
+            }
+            value = items;
+        }
+        [shared setObject:value forKey:name];
+    }
+    if(![[entity data] isKindOfClass:[NSMutableDictionary class]]){
+        entity.data = [[NSMutableDictionary alloc] initWithDictionary:[entity data]];
+    }
+    [[entity data] setObject:shared forKey:@"_embedded"];
+}
+/**
+ *  Get the shared dictionary for an embedded resource, updating
+ *  it with the given values
+ *
+ *  @param resource The embedded resource from the API response
+ *  @param name     The name of the embedded resource ('uploader', 'streams:all', etc.)
+ *
+ *  @return The shared dictionary
+ */
+-(id)sharedResource:(NSDictionary *)resource named:(NSString *)name{
+    id resourceID = [resource objectForKey:@"id"];
+    if(!resourceID || resourceID == (id)[NSNull null]) return resource;
+    NSString *key = [NSString stringWithFormat:@"%@/%@",name,resourceID];
+    NSMutableDictionary *existing = [embedded objectForKey:key];
+    if(!existing){
+        existing = [[NSMutableDictionary alloc] initWithDictionary:resource];
+        [embedded setObject:existing forKey:key];
+    }else if(existing != resource && ![existing isEqualToDictionary:resource]){
+        [existing addEntriesFromDictionary:resource];
+    }
+    return existing;
+}
+/**
+ *  Remove everything from the map
+ */
+-(void)clear{
+    @synchronized(self){
+        [entities removeAllObjects];
+        [embedded removeAllObjects];
+    }
+}
+/**
+ *  Get the key used to register an entity
+ *
+ *  @param type     The entity class
+ *  @param entityID The entity ID
+ *
+ *  @return The key or nil, if there's no ID
+ */
++(NSString *)keyForType:(Class)type withID:(id)entityID{
+    if(!entityID || entityID == (id)[NSNull null]) return nil;
+    return [NSString stringWithFormat:@"%@/%@",NSStringFromClass(type),entityID];
+}
+
+@end
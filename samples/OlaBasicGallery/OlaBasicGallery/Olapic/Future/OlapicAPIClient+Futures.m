@@ -0,0 +1,104 @@
+//
+//  OlapicAPIClient+Futures.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "OlapicAPIClient+Futures.h"
+
+@implementation OlapicAPIClient (Futures)
+/**
+ *  Send a request through the client
+ *
+ *  @param URL      The request URL (nil if the SDK doesn't expose it)
+ *  @param endpoint The endpoint name for the circuit (nil to get it from the URL)
+ *  @param priority The priority while waiting for the rate limiter
+ *  @param request  The block that sends the request. It's called once per attempt
+ *
+ *  @return A future for the response
+ */
+-(OlapicFuture *)futureForURL:(NSString *)URL endpoint:(NSString *)endpoint priority:(OlapicRequestPriority)priority withBlock:(OlapicAPIClientRequestBlock)request{
+    return [OlapicFuture futureWithBlock:^(OlapicFuture *future){
+        NSString *identifier = [self performRequestForURL:URL endpoint:endpoint priority:priority withBlock:request policy:nil completionQueue:nil onSuccess:[future fulfillBlock] onFailure:[future rejectBlock]];
+        // The attempts that are waiting (for their turn, a retry or the connection) are not sent
+        [future onCancel:^{
+            [self cancelRequest:identifier];
+        }];
+    }];
+}
+/**
+ *  Make a GET request to the API
+ *
+ *  @param URL        The request URL
+ *  @param parameters The request parameters (it can be nil)
+ *
+ *  @return A future for the response object
+ */
+-(OlapicFuture *)futureGet:(NSString *)URL parameters:(NSDictionary *)parameters{
+    return [OlapicFuture futureWithBlock:^(OlapicFuture *future){
+        NSString *identifier = [self get:URL parameters:parameters onSuccess:[future fulfillBlock] onFailure:[future rejectBlock]];
+        [future onCancel:^{
+            [self cancelRequest:identifier];
+        }];
+    }];
+}
+/**
+ *  Download the raw data of a URL
+ *
+ *  @param URL        The request URL
+ *  @param parameters The request parameters (it can be nil)
+ *
+ *  @return A future for the NSData object
+ */
+-(OlapicFuture *)futureGetData:(NSString *)URL parameters:(NSDictionary *)parameters{
+    return [OlapicFuture futureWithBlock:^(OlapicFuture *future){
+        NSString *identifier = [self getData:URL parameters:parameters onSuccess:[future fulfillBlock] onFailure:[future rejectBlock]];
+        [future onCancel:^{
+            [self cancelRequest:identifier];
+        }];
+    }];
+}
+/**
+ *  Get a list of media from an API URL
+ *
+ *  @param URL        The API URL
+ *  @param parameters Extra parameters for the request (it can be nil)
+ *
+ *  @return A future for the response dictionary
+ */
+-(OlapicFuture *)futureMediaFromURL:(NSString *)URL parameters:(NSDictionary *)parameters{
+    return [OlapicFuture futureWithBlock:^(OlapicFuture *future){
+        NSString *identifier = [self getMediaFromURL:URL parameters:parameters onSuccess:[future fulfillBlock] onFailure:[future rejectBlock]];
+        [future onCancel:^{
+            [self cancelRequest:identifier];
+        }];
+    }];
+}
+
+@end
@@ -0,0 +1,265 @@
+//
+//  OlapicFuture.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+/**
+ *  The domain for the errors generated by the futures
+ */
+extern NSString *const OlapicFutureErrorDomain;
+/**
+ *  The error codes of the futures
+ */
+typedef NS_ENUM(NSInteger, OlapicFutureErrorCode){
+    /**
+     *  The future was cancelled
+     */
+    OlapicFutureErrorCancelled = 1,
+    /**
+     *  The future didn't finish before its timeout
+     */
+    OlapicFutureErrorTimeout = 2,
+    /**
+     *  All the futures given to 'any' failed. The 'errors' key of the
+     *  user info has their errors, in order
+     */
+    OlapicFutureErrorAllFailed = 3,
+    /**
+     *  'race' was given no futures, so nothing could settle it
+     */
+    OlapicFutureErrorNoFutures = 4
+};
+/**
+ *  The states of a future
+ */
+typedef NS_ENUM(NSInteger, OlapicFutureState){
+    /**
+     *  The work is not finished yet
+     */
+    OlapicFutureStatePending = 0,
+    /**
+     *  The work finished with a value
+     */
+    OlapicFutureStateFulfilled = 1,
+    /**
+     *  The work failed (or it was cancelled, or it timed out)
+     */
+    OlapicFutureStateRejected = 2
+};
+/**
+ *  The result of a work that finishes later (usually, a request), so the
+ *  steps of a screen can be composed instead of nesting the callbacks:
+ *
+ *  - 'then', 'map' and 'recover' chain the steps that depend on each other.
+ *  - 'all', 'any' and 'race' wait for steps that run at the same time.
+ *  - 'cancel' goes backwards: cancelling a chained future cancels the step
+ *    it's waiting for, and the combinators cancel the futures that are not
+ *    needed anymore. The work registers what to do with 'onCancel:'.
+ *  - 'timeout:' rejects a future (and cancels its work) if it takes too long.
+ *
+ *  A future settles only once; the values or errors that arrive after
+ *  that are ignored. The callbacks are called on the callbackQueue (the
+ *  main queue by default), and the methods can be called from any thread.
+ */
+@interface OlapicFuture : NSObject{
+    /**
+     *  The current state
+     */
+    OlapicFutureState state;
+    /**
+     *  The value, once fulfilled
+     */
+    id value;
+    /**
+     *  The error, once rejected
+     */
+    NSError *error;
+    /**
+     *  A flag to know if the future was cancelled
+     */
+    BOOL cancelled;
+    /**
+     *  The blocks waiting for the future to settle
+     */
+    NSMutableArray *callbacks;
+    /**
+     *  The blocks that cancel the work, if the future is cancelled
+     */
+    NSMutableArray *cancelHandlers;
+    /**
+     *  The queue where the callbacks are called
+     */
+    dispatch_queue_t callbackQueue;
+}
+
+@property (nonatomic,readonly) OlapicFutureState state;
+@property (nonatomic,strong,readonly) id value;
+@property (nonatomic,strong,readonly) NSError *error;
+@property (nonatomic,readonly,getter=isCancelled) BOOL cancelled;
+@property (nonatomic,strong) dispatch_queue_t callbackQueue;
+/**
+ *  Create a future and start its work
+ *
+ *  @param block The block that starts the work. It gets the future, to fulfill it or reject it when the work finishes
+ *
+ *  @return The future object
+ */
++(instancetype)futureWithBlock:(void (^)(OlapicFuture *future))block;
+/**
+ *  Create a future that is already fulfilled
+ *
+ *  @param futureValue The value
+ *
+ *  @return The future object
+ */
++(instancetype)futureWithValue:(id)futureValue;
+/**
+ *  Create a future that is already rejected
+ *
+ *  @param futureError The error
+ *
+ *  @return The future object
+ */
++(instancetype)futureWithError:(NSError *)futureError;
+/**
+ *  Get a future that is fulfilled with the values of all the futures (in
+ *  the same order, with NSNull for nil), or rejected with the first error.
+ *  When one fails, the rest are cancelled
+ *
+ *  @param futures An array of OlapicFuture objects
+ *
+ *  @return The future object
+ */
++(OlapicFuture *)all:(NSArray *)futures;
+/**
+ *  Get a future that is fulfilled with the first value of the futures,
+ *  or rejected when all of them fail. When one works, the rest are cancelled
+ *
+ *  @param futures An array of OlapicFuture objects
+ *
+ *  @return The future object
+ */
++(OlapicFuture *)any:(NSArray *)futures;
+/**
+ *  Get a future that settles like the first of the futures that settles
+ *  (fulfilled or rejected). The rest are cancelled. Without futures, it's
+ *  rejected right away
+ *
+ *  @param futures An array of OlapicFuture objects
+ *
+ *  @return The future object
+ */
++(OlapicFuture *)race:(NSArray *)futures;
+/**
+ *  Fulfill the future with a value
+ *
+ *  @param futureValue The value
+ *
+ *  @return NO if the future was already settled
+ */
+-(BOOL)fulfillWithValue:(id)futureValue;
+/**
+ *  Reject the future with an error
+ *
+ *  @param futureError The error
+ *
+ *  @return NO if the future was already settled
+ */
+-(BOOL)rejectWithError:(NSError *)futureError;
+/**
+ *  Get a block that fulfills the future, to use it as a success callback
+ *
+ *  @return The block
+ */
+-(void (^)(id futureValue))fulfillBlock;
+/**
+ *  Get a block that rejects the future, to use it as a failure callback
+ *
+ *  @return The block
+ */
+-(void (^)(NSError *futureError))rejectBlock;
+/**
+ *  Cancel the future: it's rejected with a cancellation error, and
+ *  the cancel handlers are called
+ */
+-(void)cancel;
+/**
+ *  Add a block that cancels the work of the future. If the future was
+ *  already cancelled, it's called right away
+ *
+ *  @param handler The block
+ */
+-(void)onCancel:(void (^)(void))handler;
+/**
+ *  Add the callbacks for when the future settles
+ *
+ *  @param success A callback with the value
+ *  @param failure A callback with the error
+ *
+ *  @return The same future, so more calls can be chained
+ */
+-(OlapicFuture *)onSuccess:(void (^)(id futureValue))success onFailure:(void (^)(NSError *futureError))failure;
+/**
+ *  Chain a step that needs the value of this future
+ *
+ *  @param block The block that starts the next step with the value, and returns its future (nil is a nil value)
+ *
+ *  @return A future for the result of the next step
+ */
+-(OlapicFuture *)then:(OlapicFuture *(^)(id futureValue))block;
+/**
+ *  Chain a transformation of the value of this future
+ *
+ *  @param block The block that returns the new value
+ *
+ *  @return A future for the new value
+ */
+-(OlapicFuture *)map:(id (^)(id futureValue))block;
+/**
+ *  Chain a step that replaces an error of this future (the
+ *  cancellations are not recovered)
+ *
+ *  @param block The block that returns the future to use instead
+ *
+ *  @return A future for the value of this future, or the one of the recovery
+ */
+-(OlapicFuture *)recover:(OlapicFuture *(^)(NSError *futureError))block;
+/**
+ *  Get a future that is rejected if this one doesn't settle in time. When
+ *  that happens, this future is cancelled
+ *
+ *  @param seconds The time limit
+ *
+ *  @return A future that settles like this one, or with a timeout error
+ */
+-(OlapicFuture *)timeout:(NSTimeInterval)seconds;
+
+@end
@@ -0,0 +1,506 @@
+//
+//  OlapicFuture.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "OlapicFuture.h"
+
+NSString *const OlapicFutureErrorDomain = @"OlapicFutureErrorDomain";
+
+@interface OlapicFuture()
+/**
+ *  Call a block when the future settles (right away, if it already did).
+ *  It's called on the callback queue
+ *
+ *  @param block The block
+ */
+-(void)whenSettled:(void (^)(void))block;
+/**
+ *  Settle the future like another one
+ *
+ *  @param future The settled future
+ */
+-(void)settleWithFuture:(OlapicFuture *)future;
+/**
+ *  Change the state, if it's pending, and call the waiting blocks
+ *
+ *  @param newState    The new state
+ *  @param futureValue The value (for the fulfilled state)
+ *  @param futureError The error (for the rejected state)
+ *  @param cancel      If it's a cancellation, so the cancel handlers are called
+ *
+ *  @return NO if the future was already settled
+ */
+-(BOOL)settleWithState:(OlapicFutureState)newState value:(id)futureValue error:(NSError *)futureError cancel:(BOOL)cancel;
+/**
+ *  Create a future that calls the callbacks on the same queue as this one
+ *
+ *  @return The future object
+ */
+-(OlapicFuture *)derivedFuture;
+
+@end
+
+@implementation OlapicFuture
+@synthesize state,value,error,cancelled,callbackQueue;
+/**
+ *  Class constructor
+ *
+ *  @return An instance of this object (OlapicFuture)
+ */
+-(id)init{
+    self = [super init];
+    if(self){
+        state = OlapicFutureStatePending;
+        cancelled = NO;
+        callbacks = [[NSMutableArray alloc] init];
+        cancelHandlers = [[NSMutableArray alloc] init];
+        callbackQueue = dispatch_get_main_queue();
+    }
+    return self;
+}
+/**
+ *  Create a future and start its work
+ *
+ *  @param block The block that starts the work. It gets the future, to fulfill it or reject it when the work finishes
+ *
+ *  @return The future object
+ */
++(instancetype)futureWithBlock:(void (^)(OlapicFuture *future))block{
+    OlapicFuture *future = [[self alloc] init];
+    if(block) block(future);
+    return future;
+}
+/**
+ *  Create a future that is already fulfilled
+ *
+ *  @param futureValue The value
+ *
+ *  @return The future object
+ */
++(instancetype)futureWithValue:(id)futureValue{
+    OlapicFuture *future = [[self alloc] init];
+    [future fulfillWithValue:futureValue];
+    return future;
+}
+/**
+ *  Create a future that is already rejected
+ *
+ *  @param futureError The error
+ *
+ *  @return The future object
+ */
++(instancetype)futureWithError:(NSError *)futureError{
+    OlapicFuture *future = [[self alloc] init];
+    [future rejectWithError:futureError];
+    return future;
+}
+/**
+ *  Get a future that is fulfilled with the values of all the futures (in
+ *  the same order, with NSNull for nil), or rejected with the first error.
+ *  When one fails, the rest are cancelled
+ *
+ *  @param futures An array of OlapicFuture objects
+ *
+ *  @return The future object
+ */
++(OlapicFuture *)all:(NSArray *)futures{
+    OlapicFuture *result = [[OlapicFuture alloc] init];
+    if([futures count] == 0){
+        [result fulfillWithValue:@[]];
+        return result;
+    }
+    NSMutableArray *values = [[NSMutableArray alloc] initWithCapacity:[futures count]];
+    for(int i = 0; i < [futures count]; i++){
+        [values addObject:[NSNull null]];
+    }
+    __block NSUInteger remaining = [futures count];
+    [result onCancel:^{
+        [futures makeObjectsPerformSelector:@selector(cancel)];
+    }];
+    for(int i = 0; i < [futures count]; i++){
+        OlapicFuture *future = [futures objectAtIndex:i];
+        [future whenSettled:^{
+            if([future state] == OlapicFutureStateRejected){
+                if([result rejectWithError:[future error]]){
+                    [futures makeObjectsPerformSelector:@selector(cancel)];
+                }
+                return;
+            }
+            BOOL done = NO;
+            @synchronized(values){
+                if([future value]) [values replaceObjectAtIndex:i withObject:[future value]];
+                remaining--;
+                done = (remaining == 0);
+            }
+            if(done) [result fulfillWithValue:[values copy]];
+        }];
+    }
+    return result;
+}
+/**
+ *  Get a future that is fulfilled with the first value of the futures,
+ *  or rejected when all of them fail. When one works, the rest are cancelled
+ *
+ *  @param futures An array of OlapicFuture objects
+ *
+ *  @return The future object
+ */
++(OlapicFuture *)any:(NSArray *)futures{
+    OlapicFuture *result = [[OlapicFuture alloc] init];
+    if([futures count] == 0){
+        [result rejectWithError:[NSError errorWithDomain:OlapicFutureErrorDomain code:OlapicFutureErrorAllFailed userInfo:@{NSLocalizedDescriptionKey: @"There were no futures", @"errors": @[]}]];
+        return result;
+    }
+    NSMutableArray *errors = [[NSMutableArray alloc] initWithCapacity:[futures count]];
+    for(int i = 0; i < [futures count]; i++){
+        [errors addObject:[NSNull null]];
+    }
+    __block NSUInteger remaining = [futures count];
+    [result onCancel:^{
+        [futures makeObjectsPerformSelector:@selector(cancel)];
+    }];
+    for(int i = 0; i < [futures count]; i++){
+        OlapicFuture *future = [futures objectAtIndex:i];
+        [future whenSettled:^{
+            if([future state] == OlapicFutureStateFulfilled){
+                if([result fulfillWithValue:[future value]]){
+                    [futures makeObjectsPerformSelector:@selector(cancel)];
+                }
+                return;
+            }
+            BOOL done = NO;
+            @synchronized(errors){
+                if([future error]) [errors replaceObjectAtIndex:i withObject:[future error]];
+                remaining--;
+                done = (remaining == 0);
+            }
+            if(done){
+                [result rejectWithError:[NSError errorWithDomain:OlapicFutureErrorDomain code:OlapicFutureErrorAllFailed userInfo:@{NSLocalizedDescriptionKey: @"All the futures failed", @"errors": [errors copy]}]];
+            }
+        }];
+    }
+    return result;
+}
+/**
+ *  Get a future that settles like the first of the futures that settles
+ *  (fulfilled or rejected). The rest are cancelled. Without futures, it's
+ *  rejected right away
+ *
+ *  @param futures An array of OlapicFuture objects
+ *
+ *  @return The future object
+ */
++(OlapicFuture *)race:(NSArray *)futures{
+    OlapicFuture *result = [[OlapicFuture alloc] init];
+    if([futures count] == 0){
+        // It would never settle otherwise
+        [result rejectWithError:[NSError errorWithDomain:OlapicFutureErrorDomain code:OlapicFutureErrorNoFutures userInfo:@{NSLocalizedDescriptionKey: @"There were no futures"}]];
+        return result;
+    }
+    [result onCancel:^{
+        [futures makeObjectsPerformSelector:@selector(cancel)];
+    }];
+    for(int i = 0; i < [futures count]; i++){
+        OlapicFuture *future = [futures objectAtIndex:i];
+        [future whenSettled:^{
+            BOOL won = [future state] == OlapicFutureStateFulfilled ? [result fulfillWithValue:[future value]] : [result rejectWithError:[future error]];
+            if(won){
+                [futures makeObjectsPerformSelector:@selector(cancel)];
+            }
+        }];
+    }
+    return result;
+}
+/**
+ *  Fulfill the future with a value
+ *
+ *  @param futureValue The value
+ *
+ *  @return NO if the future was already settled
+ */
+-(BOOL)fulfillWithValue:(id)futureValue{
+    return [self settleWithState:OlapicFutureStateFulfilled value:futureValue error:nil cancel:NO];
+}
+/**
+ *  Reject the future with an error
+ *
+ *  @param futureError The error
+ *
+ *  @return NO if the future was already settled
+ */
+-(BOOL)rejectWithError:(NSError *)futureError{
+    return [self settleWithState:OlapicFutureStateRejected value:nil error:futureError cancel:NO];
+}
+/**
+ *  Get a block that fulfills the future, to use it as a success callback
+ *
+ *  @return The block
+ */
+-(void (^)(id futureValue))fulfillBlock{
+    return ^(id futureValue){
+        [self fulfillWithValue:futureValue];
+    };
+}
+/**
+ *  Get a block that rejects the future, to use it as a failure callback
+ *
+ *  @return The block
+ */
+-(void (^)(NSError *futureError))rejectBlock{
+    return ^(NSError *futureError){
+        [self rejectWithError:futureError];
+    };
+}
+/**
+ *  Cancel the future: it's rejected with a cancellation error, and
+ *  the cancel handlers are called
+ */
+-(void)cancel{
+    NSError *cancelError = [NSError errorWithDomain:OlapicFutureErrorDomain code:OlapicFutureErrorCancelled userInfo:@{NSLocalizedDescriptionKey: @"The future was cancelled"}];
+    [self settleWithState:OlapicFutureStateRejected value:nil error:cancelError cancel:YES];
+}
+/**
+ *  Add a block that cancels the work of the future. If the future was
+ *  already cancelled, it's called right away
+ *
+ *  @param handler The block
+ */
+-(void)onCancel:(void (^)(void))handler{
+    if(!handler) return;
+    BOOL callNow = NO;
+    @synchronized(self){
+        if(cancelled){
+            callNow = YES;
+        }else if(state == OlapicFutureStatePending){
+            [cancelHandlers addObject:[handler copy]];
+        }
+    }
+    if(callNow) handler();
+}
+/**
+ *  Add the callbacks for when the future settles
+ *
+ *  @param success A callback with the value
+ *  @param failure A callback with the error
+ *
+ *  @return The same future, so more calls can be chained
+ */
+-(OlapicFuture *)onSuccess:(void (^)(id futureValue))success onFailure:(void (^)(NSError *futureError))failure{
+    [self whenSettled:^{
+        if(state == OlapicFutureStateFulfilled){
+            if(success) success(value);
+        }else if(failure){
+            failure(error);
+        }
+    }];
+    return self;
+}
+/**
+ *  Chain a step that needs the value of this future
+ *
+ *  @param block The block that starts the next step with the value, and returns its future (nil is a nil value)
+ *
+ *  @return A future for the result of the next step
+ */
+-(OlapicFuture *)then:(OlapicFuture *(^)(id futureValue))block{
+    OlapicFuture *next = [self derivedFuture];
+    [next onCancel:^{
+        [self cancel];
+    }];
+    [self whenSettled:^{
+        if(state == OlapicFutureStateRejected){
+            [next rejectWithError:error];
+            return;
+        }
+        OlapicFuture *step = block ? block(value) : nil;
+        if(!step){
+            [next fulfillWithValue:nil];
+            return;
+        }
+        [next onCancel:^{
+            [step cancel];
+        }];
+        [step whenSettled:^{
+            [next settleWithFuture:step];
+        }];
+    }];
+    return next;
+}
+/**
+ *  Chain a transformation of the value of this future
+ *
+ *  @param block The block that returns the new value
+ *
+ *  @return A future for the new value
+ */
+-(OlapicFuture *)map:(id (^)(id futureValue))block{
+    return [self then:^OlapicFuture *(id futureValue){
+        return [OlapicFuture futureWithValue:(block ? block(futureValue) : futureValue)];
+    }];
+}
+/**
+ *  Chain a step that replaces an error of this future (the
+ *  cancellations are not recovered)
+ *
+ *  @param block The block that returns the future to use instead
+ *
+ *  @return A future for the value of this future, or the one of the recovery
+ */
+-(OlapicFuture *)recover:(OlapicFuture *(^)(NSError *futureError))block{
+    OlapicFuture *next = [self derivedFuture];
+    [next onCancel:^{
+        [self cancel];
+    }];
+    [self whenSettled:^{
+        if(state == OlapicFutureStateFulfilled || cancelled || !block){
+            [next settleWithFuture:self];
+            return;
+        }
+        OlapicFuture *step = block(error);
+        if(!step){
+            [next rejectWithError:error];
+            return;
+        }
+        [next onCancel:^{
+            [step cancel];
+        }];
+        [step whenSettled:^{
+            [next settleWithFuture:step];
+        }];
+    }];
+    return next;
+}
+/**
+ *  Get a future that is rejected if this one doesn't settle in time. When
+ *  that happens, this future is cancelled
+ *
+ *  @param seconds The time limit
+ *
+ *  @return A future that settles like this one, or with a timeout error
+ */
+-(OlapicFuture *)timeout:(NSTimeInterval)seconds{
+    OlapicFuture *next = [self derivedFuture];
+    [next onCancel:^{
+        [self cancel];
+    }];
+    [self whenSettled:^{
+        [next settleWithFuture:self];
+    }];
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(seconds * NSEC_PER_SEC)), callbackQueue, ^{
+        NSError *timeoutError = [NSError errorWithDomain:OlapicFutureErrorDomain code:OlapicFutureErrorTimeout userInfo:@{NSLocalizedDescriptionKey: [NSString stringWithFormat:@"The future didn't finish in %.1f seconds", seconds]}];
+        if([next rejectWithError:timeoutError]){
+            [self cancel];
+        }
+    });
+    return next;
+}
+/**
+ *  Call a block when the future settles (right away, if it already did).
+ *  It's called on the callback queue
+ *
+ *  @param block The block
+ */
+-(void)whenSettled:(void (^)(void))block{
+    @synchronized(self){
+        if(state == OlapicFutureStatePending){
+            [callbacks addObject:[block copy]];
+            return;
+        }
+    }
+    dispatch_async(callbackQueue, block);
+}
+/**
+ *  Settle the future like another one
+ *
+ *  @param future The settled future
+ */
+-(void)settleWithFuture:(OlapicFuture *)future{
+    if([future state] == OlapicFutureStateFulfilled){
+        [self fulfillWithValue:[future value]];
+    }else{
+        [self rejectWithError:[future error]];
+    }
+}
+/**
+ *  Change the state, if it's pending, and call the waiting blocks
+ *
+ *  @param newState    The new state
+ *  @param futureValue The value (for the fulfilled state)
+ *  @param futureError The error (for the rejected state)
+ *  @param cancel      If it's a cancellation, so the cancel handlers are called
+ *
+ *  @return NO if the future was already settled
+ */
+-(BOOL)settleWithState:(OlapicFutureState)newState value:(id)futureValue error:(NSError *)futureError cancel:(BOOL)cancel{
+    NSArray *waiting;
+    NSArray *handlers;
+    @synchronized(self){
+        if(state != OlapicFutureStatePending) return NO;
+        state = newState;
+        value = futureValue;
+        error = futureError;
+        cancelled = cancel;
+        waiting = [callbacks copy];
+        handlers = cancel ? [cancelHandlers copy] : nil;
+        // Nothing is waiting anymore, so the blocks (and what they retain) are released
+        [callbacks removeAllObjects];
+        [cancelHandlers removeAllObjects];
+    }
+    for(int i = 0; i < [handlers count]; i++){
+        void (^handler)(void) = [handlers objectAtIndex:i];
+        handler();
+    }
+    for(int i = 0; i < [waiting count]; i++){
+        dispatch_async(callbackQueue, [waiting objectAtIndex:i]);
+    }
+    return YES;
+}
+/**
+ *  Create a future that calls the callbacks on the same queue as this one
+ *
+ *  @return The future object
+ */
+-(OlapicFuture *)derivedFuture{
+    OlapicFuture *future = [[OlapicFuture alloc] init];
+    future.callbackQueue = callbackQueue;
+    return future;
+}
+/**
+ *  Get a description with the state
+ *
+ *  @return The description
+ */
+-(NSString *)description{
+    NSString *stateName = state == OlapicFutureStatePending ? @"pending" : (state == OlapicFutureStateFulfilled ? @"fulfilled" : (cancelled ? @"cancelled" : @"rejected"));
+    return [NSString stringWithFormat:@"<%@: %@>", NSStringFromClass([self class]), stateName];
+}
+
+@end
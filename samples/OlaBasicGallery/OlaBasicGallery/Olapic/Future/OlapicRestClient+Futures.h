@@ -0,0 +1,65 @@
+//
+//  OlapicRestClient+Futures.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <OlapicSDK/OlapicSDK.h>
+#import "OlapicFuture.h"
+/**
+ *  Future versions of the GET requests, so they can be chained and
+ *  combined with OlapicFuture. They are sent through OlapicAPIClient,
+ *  so they get its retries, rate limiting and circuit breakers.
+ *
+ *  Cancelling one of these futures rejects it right away, and the client
+ *  doesn't retry nor hold its request anymore. An attempt the SDK already
+ *  sent can't be aborted, so its response is ignored when it arrives.
+ */
+@interface OlapicRestClient (Futures)
+/**
+ *  Make a GET request to the API
+ *
+ *  @param URL        The request URL
+ *  @param parameters The request parameters (it can be nil)
+ *
+ *  @return A future for the response object
+ */
+-(OlapicFuture *)futureGet:(NSString *)URL parameters:(NSDictionary *)parameters;
+/**
+ *  Make a GET request and get the raw response
+ *
+ *  @param URL        The request URL
+ *  @param parameters The request parameters (it can be nil)
+ *
+ *  @return A future for the NSData object
+ */
+-(OlapicFuture *)futureGetData:(NSString *)URL parameters:(NSDictionary *)parameters;
+
+@end
@@ -0,0 +1,64 @@
+//
+//  OlapicRestClient+Futures.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "OlapicRestClient+Futures.h"
+#import "OlapicAPIClient+Futures.h"
+
+@implementation OlapicRestClient (Futures)
+/**
+ *  Make a GET request to the API
+ *
+ *  @param URL        The request URL
+ *  @param parameters The request parameters (it can be nil)
+ *
+ *  @return A future for the response object
+ */
+-(OlapicFuture *)futureGet:(NSString *)URL parameters:(NSDictionary *)parameters{
+    return [[OlapicAPIClient sharedClient] futureForURL:URL endpoint:nil priority:OlapicRequestPriorityNormal withBlock:^(void (^success)(id response), void (^failure)(NSError *error)){
+        [self get:URL parameters:parameters onSuccess:success onFailure:failure];
+    }];
+}
+/**
+ *  Make a GET request and get the raw response
+ *
+ *  @param URL        The request URL
+ *  @param parameters The request parameters (it can be nil)
+ *
+ *  @return A future for the NSData object
+ */
+-(OlapicFuture *)futureGetData:(NSString *)URL parameters:(NSDictionary *)parameters{
+    return [[OlapicAPIClient sharedClient] futureForURL:URL endpoint:nil priority:OlapicRequestPriorityNormal withBlock:^(void (^success)(id response), void (^failure)(NSError *error)){
+        [self getData:URL parameters:parameters onSuccess:success onFailure:failure];
+    }];
+}
+
+@end
@@ -0,0 +1,247 @@
+//
+//  OlapicGridView.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+
+@class OlapicGridView;
+/**
+ *  The protocol for the object that gives the grid its content
+ */
+@protocol OlapicGridViewDataSource <NSObject>
+@required
+/**
+ *  Get the number of items on the grid
+ *
+ *  @param gridView The grid view object
+ *
+ *  @return The number of items
+ */
+-(NSUInteger)numberOfItemsInGridView:(OlapicGridView *)gridView;
+/**
+ *  Get the cell for an item. The data source should try to reuse
+ *  a cell using dequeueReusableCell before creating a new one
+ *
+ *  @param gridView The grid view object
+ *  @param index    The item index
+ *
+ *  @return The cell view
+ */
+-(UIView *)gridView:(OlapicGridView *)gridView cellForItemAtIndex:(NSUInteger)index;
+@optional
+/**
+ *  The items are close to the visible area, so it's a good
+ *  moment to start downloading their content
+ *
+ *  @param gridView The grid view object
+ *  @param indexes  The items indexes
+ */
+-(void)gridView:(OlapicGridView *)gridView prefetchItemsAtIndexes:(NSIndexSet *)indexes;
+/**
+ *  The items that were prefetched are not close to the visible
+ *  area anymore
+ *
+ *  @param gridView The grid view object
+ *  @param indexes  The items indexes
+ */
+-(void)gridView:(OlapicGridView *)gridView cancelPrefetchingItemsAtIndexes:(NSIndexSet *)indexes;
+
+@end
+/**
+ *  The protocol for the object that gets informed of the grid events
+ */
+@protocol OlapicGridViewDelegate <UIScrollViewDelegate>
+@optional
+/**
+ *  A cell left the visible area and it's going to be reused
+ *
+ *  @param gridView The grid view object
+ *  @param cell     The cell view
+ *  @param index    The index of the item the cell was showing
+ */
+-(void)gridView:(OlapicGridView *)gridView didEndDisplayingCell:(UIView *)cell forItemAtIndex:(NSUInteger)index;
+/**
+ *  The visible area is close to the end of the content
+ *
+ *  @param gridView The grid view object
+ */
+-(void)gridViewDidReachTheEnd:(OlapicGridView *)gridView;
+
+@end
+/**
+ *  A scroll view that shows items on a grid, keeping alive only the
+ *  cells for the visible items (plus a small buffer), and reusing the
+ *  cells that leave the screen.
+ *
+ *  All the items have the same size, so the position of any item is
+ *  calculated without looking at the rest. If a cell implements
+ *  prepareForReuse, it's called when the cell leaves the screen.
+ */
+@interface OlapicGridView : UIScrollView{
+    /**
+     *  The object that gives the grid its content
+     */
+    id<OlapicGridViewDataSource> __weak dataSource;
+    /**
+     *  The size of each cell
+     */
+    CGSize itemSize;
+    /**
+     *  The minimum space between the cells
+     */
+    CGFloat minimumSpacing;
+    /**
+     *  The number of rows, before and after the visible ones, for
+     *  which the cells are kept alive
+     */
+    NSUInteger bufferRows;
+    /**
+     *  The number of rows, after the buffer, that are prefetched
+     */
+    NSUInteger prefetchRows;
+    /**
+     *  The maximum number of cells waiting to be reused
+     */
+    NSUInteger maximumReusableCells;
+    /**
+     *  The number of items, as the data source reported it on the last reload
+     */
+    NSUInteger itemCount;
+    /**
+     *  The number of columns for the current width
+     */
+    NSUInteger columns;
+    /**
+     *  The space between the cells for the current width
+     */
+    CGFloat spacing;
+    /**
+     *  The width used to calculate the columns and the spacing
+     */
+    CGFloat layoutWidth;
+    /**
+     *  The cells on the screen, by item index
+     */
+    NSMutableDictionary *visibleCells;
+    /**
+     *  The cells that left the screen, waiting to be reused
+     */
+    NSMutableArray *reusableCells;
+    /**
+     *  The indexes that were sent to prefetch
+     */
+    NSMutableIndexSet *prefetchedIndexes;
+    /**
+     *  A flag to only inform the delegate once that the end was reached,
+     *  until the number of items changes
+     */
+    BOOL reportedEnd;
+}
+
+@property (nonatomic,weak) id<OlapicGridViewDataSource> __weak dataSource;
+@property (nonatomic,assign) id<OlapicGridViewDelegate> delegate;
+@property (nonatomic) CGSize itemSize;
+@property (nonatomic) CGFloat minimumSpacing;
+@property (nonatomic) NSUInteger bufferRows;
+@property (nonatomic) NSUInteger prefetchRows;
+@property (nonatomic) NSUInteger maximumReusableCells;
+@property (nonatomic,readonly) NSUInteger columns;
+/**
+ *  Forget all the cells and ask the data source for the
+ *  content again
+ */
+-(void)reloadData;
+/**
+ *  Add items to the grid. The cells on the screen are kept (and moved,
+ *  if the items were added before them), so only the new items are
+ *  asked to the data source
+ *
+ *  @param indexes The indexes of the new items, on the new content
+ */
+-(void)insertItemsAtIndexes:(NSIndexSet *)indexes;
+/**
+ *  Remove items from the grid, keeping the cells of the rest
+ *
+ *  @param indexes The indexes of the removed items, on the previous content
+ */
+-(void)deleteItemsAtIndexes:(NSIndexSet *)indexes;
+/**
+ *  Apply a batch of changes, like the ones an OlapicMediaListDiff
+ *  reports. The data source should already return the new content.
+ *  The cells of the items that stay are moved to their new positions
+ *  instead of being reloaded; only the deleted and reloaded ones are
+ *  recycled, and the data source is only asked for the new items
+ *
+ *  @param deletes The indexes of the removed items, on the previous content
+ *  @param inserts The indexes of the added items, on the new content
+ *  @param moves   An array of pairs (arrays with two numbers): the previous and the new index of an item that moved
+ *  @param reloads The indexes, on the new content, of the items whose cells should be asked again
+ */
+-(void)updateWithDeletedIndexes:(NSIndexSet *)deletes insertedIndexes:(NSIndexSet *)inserts movedIndexes:(NSArray *)moves reloadedIndexes:(NSIndexSet *)reloads;
+/**
+ *  Get a cell that left the screen, so it can be reused
+ *
+ *  @return The cell or nil if there's none
+ */
+-(id)dequeueReusableCell;
+/**
+ *  Get the cell for an item, if it's on the screen
+ *
+ *  @param index The item index
+ *
+ *  @return The cell or nil if the item is not on the screen
+ */
+-(UIView *)cellForItemAtIndex:(NSUInteger)index;
+/**
+ *  Get the cells on the screen
+ *
+ *  @return An array of views
+ */
+-(NSArray *)visibleCells;
+/**
+ *  Get the frame of an item. It works for any index, no matter
+ *  if it's on the screen or not
+ *
+ *  @param index The item index
+ *
+ *  @return The frame, on the grid coordinates
+ */
+-(CGRect)frameForItemAtIndex:(NSUInteger)index;
+/**
+ *  Get the indexes of the items inside a rect
+ *
+ *  @param rect A rect on the grid coordinates
+ *
+ *  @return The range of indexes
+ */
+-(NSRange)rangeOfItemsInRect:(CGRect)rect;
+
+@end
@@ -0,0 +1,385 @@
+//
+//  OlapicGridView.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "OlapicGridView.h"
+
+@interface OlapicGridView()
+/**
+ *  Calculate the number of columns and the spacing for a width
+ *
+ *  @param width The width to use as reference
+ */
+-(void)updateColumnsForWidth:(CGFloat)width;
+/**
+ *  Update the scroll content size using the number of items
+ */
+-(void)updateContentSize;
+/**
+ *  Remove a cell from the screen and save it to be reused
+ *
+ *  @param cell  The cell view
+ *  @param index The index of the item the cell was showing
+ */
+-(void)recycleCell:(UIView *)cell forItemAtIndex:(NSUInteger)index;
+/**
+ *  Inform the data source about the items that entered or left the
+ *  prefetch area
+ *
+ *  @param wanted The indexes that should be prefetched now
+ */
+-(void)updatePrefetchedIndexes:(NSIndexSet *)wanted;
+
+@end
+
+@implementation OlapicGridView
+@synthesize dataSource,itemSize,minimumSpacing,bufferRows,prefetchRows,maximumReusableCells,columns;
+@dynamic delegate;
+/**
+ *  Class constructor
+ *
+ *  @param frame The view frame
+ *
+ *  @return An instance of this object (OlapicGridView)
+ */
+-(id)initWithFrame:(CGRect)frame{
+    self = [super initWithFrame:frame];
+    if(self){
+        itemSize = CGSizeMake(74, 74);
+        minimumSpacing = 4;
+        bufferRows = 1;
+        prefetchRows = 3;
+        maximumReusableCells = 16;
+        itemCount = 0;
+        columns = 1;
+        spacing = 0;
+        layoutWidth = 0;
+        visibleCells = [[NSMutableDictionary alloc] init];
+        reusableCells = [[NSMutableArray alloc] init];
+        prefetchedIndexes = [[NSMutableIndexSet alloc] init];
+        reportedEnd = NO;
+    }
+    return self;
+}
+/**
+ *  Forget all the cells and ask the data source for the
+ *  content again
+ */
+-(void)reloadData{
+    NSArray *indexes = [visibleCells allKeys];
+    for(int i = 0; i < [indexes count]; i++){
+        NSNumber *index = [indexes objectAtIndex:i];
+        [self recycleCell:[visibleCells objectForKey:index] forItemAtIndex:[index unsignedIntegerValue]];
+    }
+    [self updatePrefetchedIndexes:[NSIndexSet indexSet]];
+    itemCount = dataSource ? [dataSource numberOfItemsInGridView:self] : 0;
+    reportedEnd = NO;
+    [self updateColumnsForWidth:self.bounds.size.width];
+    [self updateContentSize];
+    [self setNeedsLayout];
+}
+/**
+ *  Add items to the grid. The cells on the screen are kept (and moved,
+ *  if the items were added before them), so only the new items are
+ *  asked to the data source
+ *
+ *  @param indexes The indexes of the new items, on the new content
+ */
+-(void)insertItemsAtIndexes:(NSIndexSet *)indexes{
+    [self updateWithDeletedIndexes:nil insertedIndexes:indexes movedIndexes:nil reloadedIndexes:nil];
+}
+/**
+ *  Remove items from the grid, keeping the cells of the rest
+ *
+ *  @param indexes The indexes of the removed items, on the previous content
+ */
+-(void)deleteItemsAtIndexes:(NSIndexSet *)indexes{
+    [self updateWithDeletedIndexes:indexes insertedIndexes:nil movedIndexes:nil reloadedIndexes:nil];
+}
+/**
+ *  Apply a batch of changes, like the ones an OlapicMediaListDiff
+ *  reports. The data source should already return the new content.
+ *  The cells of the items that stay are moved to their new positions
+ *  instead of being reloaded; only the deleted and reloaded ones are
+ *  recycled, and the data source is only asked for the new items
+ *
+ *  @param deletes The indexes of the removed items, on the previous content
+ *  @param inserts The indexes of the added items, on the new content
+ *  @param moves   An array of pairs (arrays with two numbers): the previous and the new index of an item that moved
+ *  @param reloads The indexes, on the new content, of the items whose cells should be asked again
+ */
+-(void)updateWithDeletedIndexes:(NSIndexSet *)deletes insertedIndexes:(NSIndexSet *)inserts movedIndexes:(NSArray *)moves reloadedIndexes:(NSIndexSet *)reloads{
+    NSUInteger previousCount = itemCount;
+    NSUInteger newCount = dataSource ? [dataSource numberOfItemsInGridView:self] : 0;
+    // The new index of every previous item: the moved ones say where they
+    // go, and the rest keep their order on the positions that are left
+    NSUInteger *newIndexes = malloc(sizeof(NSUInteger) * (previousCount + 1));
+    BOOL *taken = calloc(newCount + 1, sizeof(BOOL));
+    for(NSUInteger i = 0; i < previousCount; i++){
+        newIndexes[i] = [deletes containsIndex:i] ? NSNotFound : NSUIntegerMax;
+    }
+    [inserts enumerateIndexesUsingBlock:^(NSUInteger idx, BOOL *stop){
+        if(idx < newCount) taken[idx] = YES;
+    }];
+    for(int i = 0; i < [moves count]; i++){
+        NSUInteger from = [[[moves objectAtIndex:i] objectAtIndex:0] unsignedIntegerValue];
+        NSUInteger to = [[[moves objectAtIndex:i] objectAtIndex:1] unsignedIntegerValue];
+        if(from < previousCount && to < newCount){
+            newIndexes[from] = to;
+            taken[to] = YES;
+        }
+    }
+    NSUInteger position = 0;
+    for(NSUInteger i = 0; i < previousCount; i++){
+        if(newIndexes[i] != NSUIntegerMax) continue;
+        while(position < newCount && taken[position]) position++;
+        newIndexes[i] = (position < newCount) ? position++ : NSNotFound;
+    }
+    free(taken);
+    // Move the cells that stay, recycle the rest
+    NSDictionary *previousCells = visibleCells;
+    NSMutableDictionary *recycled = [[NSMutableDictionary alloc] init];
+    visibleCells = [[NSMutableDictionary alloc] initWithCapacity:[previousCells count]];
+    [previousCells enumerateKeysAndObjectsUsingBlock:^(NSNumber *index, UIView *cell, BOOL *stop){
+        NSUInteger oldIndex = [index unsignedIntegerValue];
+        NSUInteger newIndex = (oldIndex < previousCount) ? newIndexes[oldIndex] : NSNotFound;
+        if(newIndex == NSNotFound || [reloads containsIndex:newIndex]){
+            [recycled setObject:cell forKey:index];
+        }else{
+            [visibleCells setObject:cell forKey:@(newIndex)];
+        }
+    }];
+    [recycled enumerateKeysAndObjectsUsingBlock:^(NSNumber *index, UIView *cell, BOOL *stop){
+        [self recycleCell:cell forItemAtIndex:[index unsignedIntegerValue]];
+    }];
+    // The prefetched items are still being downloaded, they only change their index
+    NSMutableIndexSet *prefetched = [[NSMutableIndexSet alloc] init];
+    [prefetchedIndexes enumerateIndexesUsingBlock:^(NSUInteger idx, BOOL *stop){
+        if(idx < previousCount && newIndexes[idx] != NSNotFound){
+            [prefetched addIndex:newIndexes[idx]];
+        }
+    }];
+    prefetchedIndexes = prefetched;
+    free(newIndexes);
+    itemCount = newCount;
+    if(itemCount != previousCount){
+        reportedEnd = NO;
+    }
+    [self updateColumnsForWidth:self.bounds.size.width];
+    [self updateContentSize];
+    [visibleCells enumerateKeysAndObjectsUsingBlock:^(NSNumber *index, UIView *cell, BOOL *stop){
+        cell.frame = [self frameForItemAtIndex:[index unsignedIntegerValue]];
+    }];
+    [self setNeedsLayout];
+}
+/**
+ *  Get a cell that left the screen, so it can be reused
+ *
+ *  @return The cell or nil if there's none
+ */
+-(id)dequeueReusableCell{
+    UIView *cell = [reusableCells lastObject];
+    if(cell){
+        [reusableCells removeLastObject];
+        cell.hidden = NO;
+    }
+    return cell;
+}
+/**
+ *  Get the cell for an item, if it's on the screen
+ *
+ *  @param index The item index
+ *
+ *  @return The cell or nil if the item is not on the screen
+ */
+-(UIView *)cellForItemAtIndex:(NSUInteger)index{
+    return [visibleCells objectForKey:@(index)];
+}
+/**
+ *  Get the cells on the screen
+ *
+ *  @return An array of views
+ */
+-(NSArray *)visibleCells{
+    return [visibleCells allValues];
+}
+/**
+ *  Get the frame of an item. It works for any index, no matter
+ *  if it's on the screen or not
+ *
+ *  @param index The item index
+ *
+ *  @return The frame, on the grid coordinates
+ */
+-(CGRect)frameForItemAtIndex:(NSUInteger)index{
+    NSUInteger row = index / columns;
+    NSUInteger column = index % columns;
+    CGFloat x = spacing + (column * (itemSize.width + spacing));
+    CGFloat y = spacing + (row * (itemSize.height + spacing));
+    return CGRectMake(x, y, itemSize.width, itemSize.height);
+}
+/**
+ *  Get the indexes of the items inside a rect
+ *
+ *  @param rect A rect on the grid coordinates
+ *
+ *  @return The range of indexes
+ */
+-(NSRange)rangeOfItemsInRect:(CGRect)rect{
+    if(itemCount == 0) return NSMakeRange(0, 0);
+    CGFloat rowHeight = itemSize.height + spacing;
+    NSInteger firstRow = MAX(0, (NSInteger)floor((CGRectGetMinY(rect) - spacing) / rowHeight));
+    NSInteger lastRow = MAX(0, (NSInteger)floor((CGRectGetMaxY(rect) - spacing) / rowHeight));
+    NSUInteger first = MIN(itemCount, (NSUInteger)firstRow * columns);
+    NSUInteger last = MIN(itemCount, (NSUInteger)(lastRow + 1) * columns);
+    return NSMakeRange(first, last - first);
+}
+/**
+ *  Calculate the number of columns and the spacing for a width
+ *
+ *  @param width The width to use as reference
+ */
+-(void)updateColumnsForWidth:(CGFloat)width{
+    layoutWidth = width;
+    columns = MAX(1, (NSUInteger)floor((width - minimumSpacing) / (itemSize.width + minimumSpacing)));
+    // All the remaining space is used as separation, like the gallery always did
+    spacing = MAX(0, floor((width - (columns * itemSize.width)) / (columns + 1)));
+}
+/**
+ *  Update the scroll content size using the number of items
+ */
+-(void)updateContentSize{
+    NSUInteger rows = (itemCount + columns - 1) / columns;
+    CGFloat height = (rows * (itemSize.height + spacing)) + spacing;
+    self.contentSize = CGSizeMake(layoutWidth, MAX(height, self.bounds.size.height - self.contentInset.top - self.contentInset.bottom));
+}
+/**
+ *  Remove a cell from the screen and save it to be reused
+ *
+ *  @param cell  The cell view
+ *  @param index The index of the item the cell was showing
+ */
+-(void)recycleCell:(UIView *)cell forItemAtIndex:(NSUInteger)index{
+    // After a batch update, another cell can be using that index already
+    if([visibleCells objectForKey:@(index)] == cell){
+        [visibleCells removeObjectForKey:@(index)];
+    }
+    if([cell respondsToSelector:@selector(prepareForReuse)]){
+        [cell performSelector:@selector(prepareForReuse)];
+    }
+    if([self.delegate respondsToSelector:@selector(gridView:didEndDisplayingCell:forItemAtIndex:)]){
+        [self.delegate gridView:self didEndDisplayingCell:cell forItemAtIndex:index];
+    }
+    if([reusableCells count] < maximumReusableCells){
+        // Hiding it is cheaper than removing it and adding it again
+        cell.hidden = YES;
+        [reusableCells addObject:cell];
+    }else{
+        [cell removeFromSuperview];
+    }
+}
+/**
+ *  Inform the data source about the items that entered or left the
+ *  prefetch area
+ *
+ *  @param wanted The indexes that should be prefetched now
+ */
+-(void)updatePrefetchedIndexes:(NSIndexSet *)wanted{
+    NSMutableIndexSet *added = [[NSMutableIndexSet alloc] initWithIndexSet:wanted];
+    [added removeIndexes:prefetchedIndexes];
+    NSMutableIndexSet *removed = [[NSMutableIndexSet alloc] initWithIndexSet:prefetchedIndexes];
+    [removed removeIndexes:wanted];
+    // The ones that are on the screen now are loaded by their cells
+    [visibleCells enumerateKeysAndObjectsUsingBlock:^(NSNumber *index, UIView *cell, BOOL *stop){
+        [removed removeIndex:[index unsignedIntegerValue]];
+    }];
+    prefetchedIndexes = [[NSMutableIndexSet alloc] initWithIndexSet:wanted];
+    if([removed count] > 0 && [dataSource respondsToSelector:@selector(gridView:cancelPrefetchingItemsAtIndexes:)]){
+        [dataSource gridView:self cancelPrefetchingItemsAtIndexes:removed];
+    }
+    if([added count] > 0 && [dataSource respondsToSelector:@selector(gridView:prefetchItemsAtIndexes:)]){
+        [dataSource gridView:self prefetchItemsAtIndexes:added];
+    }
+}
+#pragma mark - Default cycle
+/**
+ *  Called on every scroll and every size change: only the cells
+ *  around the visible area are kept, the rest are recycled
+ */
+-(void)layoutSubviews{
+    [super layoutSubviews];
+    if(!dataSource) return;
+    // A new width (a rotation, for example) only moves the cells that are alive
+    if(self.bounds.size.width != layoutWidth){
+        [self updateColumnsForWidth:self.bounds.size.width];
+        [self updateContentSize];
+        [visibleCells enumerateKeysAndObjectsUsingBlock:^(NSNumber *index, UIView *cell, BOOL *stop){
+            cell.frame = [self frameForItemAtIndex:[index unsignedIntegerValue]];
+        }];
+    }
+    CGFloat rowHeight = itemSize.height + spacing;
+    CGRect aliveRect = CGRectInset(self.bounds, 0, -(bufferRows * rowHeight));
+    NSRange alive = [self rangeOfItemsInRect:aliveRect];
+    // Recycle the cells that left the area
+    NSArray *indexes = [visibleCells allKeys];
+    for(int i = 0; i < [indexes count]; i++){
+        NSNumber *index = [indexes objectAtIndex:i];
+        if(!NSLocationInRange([index unsignedIntegerValue], alive)){
+            [self recycleCell:[visibleCells objectForKey:index] forItemAtIndex:[index unsignedIntegerValue]];
+        }
+    }
+    // Add the cells that entered it
+    for(NSUInteger i = alive.location; i < NSMaxRange(alive); i++){
+        if([visibleCells objectForKey:@(i)]) continue;
+        UIView *cell = [dataSource gridView:self cellForItemAtIndex:i];
+        if(!cell) continue;
+        cell.frame = [self frameForItemAtIndex:i];
+        if(cell.superview != self){
+            [self addSubview:cell];
+        }
+        [visibleCells setObject:cell forKey:@(i)];
+    }
+    // Prefetch the rows after the buffer
+    CGRect prefetchRect = CGRectInset(aliveRect, 0, -(prefetchRows * rowHeight));
+    NSRange prefetch = [self rangeOfItemsInRect:prefetchRect];
+    NSMutableIndexSet *wanted = [[NSMutableIndexSet alloc] initWithIndexesInRange:prefetch];
+    [wanted removeIndexesInRange:alive];
+    [self updatePrefetchedIndexes:wanted];
+    // Let the delegate know it's time to load more content
+    if(!reportedEnd && itemCount > 0 && NSMaxRange(prefetch) >= itemCount){
+        reportedEnd = YES;
+        if([self.delegate respondsToSelector:@selector(gridViewDidReachTheEnd:)]){
+            [self.delegate gridViewDidReachTheEnd:self];
+        }
+    }
+}
+
+@end
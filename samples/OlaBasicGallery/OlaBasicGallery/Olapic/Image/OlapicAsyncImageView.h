@@ -81,6 +81,15 @@
      *  for the 'Zoom screen'
      */
     UIImage *fullImage;
+    /**
+     *  The size of the image on fullImage. Until the first
+     *  size is downloaded, it's OlapicMediaImageSizeThumbnail
+     */
+    OlapicMediaImageSize fullImageSize;
+    /**
+     *  The token of the thumbnail download, so it can be cancelled
+     */
+    NSString *loadToken;
 }
 
 @property (nonatomic,strong) OlapicMediaEntity *media;
@@ -92,6 +101,7 @@
 @property (nonatomic,strong) void (^callback)(OlapicAsyncImageView  *image);
 @property (nonatomic,strong) UIImage *thumbImage;
 @property (nonatomic,strong) UIImage *fullImage;
+@property (nonatomic,readonly) OlapicMediaImageSize fullImageSize;
 /**
  *  Class constructor
  *
@@ -102,16 +112,67 @@
  *  @return An instance of this object (OlapicAsyncImageView)
  */
 -(id)initWithMedia:(OlapicMediaEntity *)med callback:(void (^)(OlapicAsyncImageView *image))call andFrame:(CGRect)rect;
+/**
+ *  Create an independent copy of another image view: same media, same
+ *  thumbnail and full image, but no callback. It's meant for the screens
+ *  that need to keep the images while the original view is reused
+ *
+ *  @param other The image view to copy
+ *
+ *  @return An instance of this object (OlapicAsyncImageView)
+ */
+-(id)initWithAsyncImage:(OlapicAsyncImageView *)other;
 /**
  *  Tell the object to start downloading the thumbnail
  */
 -(void)download;
+/**
+ *  Cancel the thumbnail download, if it's still in progress
+ */
+-(void)cancelDownload;
+/**
+ *  Check if the thumbnail download is in progress
+ *
+ *  @return YES if it's downloading
+ */
+-(BOOL)isDownloading;
+/**
+ *  Cancel the download and remove the images, so the object can be
+ *  used for another media
+ */
+-(void)prepareForReuse;
 /**
  *  Download the original image from the media object
  *
  *  @param call A callback action to be called when the image is ready (it will be accessible via the ivar fullImage).
  */
 -(void)downloadFullImageAndDo:(void (^)(OlapicAsyncImageView *image))call;
+/**
+ *  Download a bigger version of the image from the media object. If the
+ *  current fullImage is already of that size (or bigger), the callback is
+ *  called right away, and if a smaller size arrives after a bigger one, it's
+ *  ignored.
+ *
+ *  @param size The size to download (OlapicMediaImageSizeMobile, OlapicMediaImageSizeNormal or OlapicMediaImageSizeOriginal)
+ *  @param call A callback action to be called when the image is ready (it will be accessible via the ivar fullImage).
+ */
+-(void)downloadFullImageWithSize:(OlapicMediaImageSize)size andDo:(void (^)(OlapicAsyncImageView *image))call;
+/**
+ *  Download a bigger version of the image from the media object, and
+ *  be informed if the download fails
+ *
+ *  @param size    The size to download (OlapicMediaImageSizeMobile, OlapicMediaImageSizeNormal or OlapicMediaImageSizeOriginal)
+ *  @param call    A callback action to be called when the image is ready (it will be accessible via the ivar fullImage).
+ *  @param failure A callback action to be called if the image couldn't be downloaded
+ */
+-(void)downloadFullImageWithSize:(OlapicMediaImageSize)size andDo:(void (^)(OlapicAsyncImageView *image))call onFailure:(void (^)(NSError *error))failure;
+/**
+ *  Get the best image available for this media: the full image, if
+ *  one was already downloaded, or the thumbnail
+ *
+ *  @return The image or nil if nothing was downloaded yet
+ */
+-(UIImage *)bestImage;
 /**
  *  Resize and crop an image proportionally
  *
@@ -122,5 +183,14 @@
  *  @return The resized & cropped image
  */
 +(UIImage *)resizeImage:(UIImage *)rimage to:(CGSize)size detectingRetina:(BOOL)retina;
+/**
+ *  Get the key used to save a resized thumbnail on the image cache
+ *
+ *  @param URL  The thumbnail URL
+ *  @param size The size of the resized image
+ *
+ *  @return The key
+ */
++(NSString *)cacheKeyForURL:(NSString *)URL resizedTo:(CGSize)size;
 
 @end
\ No newline at end of file
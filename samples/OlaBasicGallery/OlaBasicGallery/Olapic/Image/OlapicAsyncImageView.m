@@ -31,6 +31,7 @@
 //  THE SOFTWARE.
 
 #import "OlapicAsyncImageView.h"
+#import "OlapicImageLoader.h"
 
 @interface OlapicAsyncImageView()
 /**
@@ -50,7 +51,7 @@
 @end
 
 @implementation OlapicAsyncImageView
-@synthesize media,image,loader,border,button,overlay,callback,fullImage,thumbImage;
+@synthesize media,image,loader,border,button,overlay,callback,fullImage,thumbImage,fullImageSize;
 /**
  *  Class constructor
  *
@@ -66,6 +67,7 @@
         self.backgroundColor = [UIColor clearColor];
         media = med;
         callback = call;
+        fullImageSize = OlapicMediaImageSizeThumbnail;
         
         image = [[UIImageView alloc] initWithFrame:CGRectZero];
         image.backgroundColor = [UIColor clearColor];
@@ -94,21 +96,85 @@
     }
     return self;
 }
+/**
+ *  Create an independent copy of another image view: same media, same
+ *  thumbnail and full image, but no callback. It's meant for the screens
+ *  that need to keep the images while the original view is reused
+ *
+ *  @param other The image view to copy
+ *
+ *  @return An instance of this object (OlapicAsyncImageView)
+ */
+-(id)initWithAsyncImage:(OlapicAsyncImageView *)other{
+    self = [self initWithMedia:other.media callback:nil andFrame:other.frame];
+    if(self){
+        thumbImage = other.thumbImage;
+        fullImage = other.fullImage;
+        fullImageSize = other.fullImageSize;
+        image.image = other.image.image;
+    }
+    return self;
+}
 /**
  *  Tell the object to start downloading the thumbnail
  */
 -(void)download{
+    [self cancelDownload];
     [loader startAnimating];
-    [[[OlapicSDK sharedOlapicSDK] media] loadImageWithSize:OlapicMediaImageSizeThumbnail fromMedia:media onSuccess:^(NSData *mediaData, UIImage *mediaImage){
+    self.backgroundColor = [UIColor clearColor];
+    // The loader calls the success callback right away if the
+    // thumbnail is already on the cache
+    loadToken = [[OlapicImageLoader sharedImageLoader] loadImageWithSize:OlapicMediaImageSizeThumbnail fromMedia:media onSuccess:^(UIImage *mediaImage){
+        loadToken = nil;
         thumbImage = mediaImage;
-        image.image = [OlapicAsyncImageView resizeImage:mediaImage to:CGSizeMake(self.frame.size.width,self.frame.size.height) detectingRetina:YES];
+        // The resized version is shared too, so views of the same size
+        // (like the map annotations) don't resize it again
+        CGSize size = CGSizeMake(self.frame.size.width,self.frame.size.height);
+        NSString *resizedKey = [OlapicAsyncImageView cacheKeyForURL:[media getMediaURLForImageSize:OlapicMediaImageSizeThumbnail] resizedTo:size];
+        UIImage *resized = [[OlapicImageCache sharedImageCache] imageForKey:resizedKey];
+        if(!resized){
+            resized = [OlapicAsyncImageView resizeImage:mediaImage to:size detectingRetina:YES];
+            [[OlapicImageCache sharedImageCache] setImage:resized forKey:resizedKey];
+        }
+        image.image = resized;
         [loader stopAnimating];
         [self adjustSize];
     } onFailure:^(NSError *error){
+        loadToken = nil;
         [loader stopAnimating];
         self.backgroundColor = [UIColor redColor];
     }];
 }
+/**
+ *  Cancel the thumbnail download, if it's still in progress
+ */
+-(void)cancelDownload{
+    if(!loadToken) return;
+    [[OlapicImageLoader sharedImageLoader] cancelLoad:loadToken];
+    loadToken = nil;
+    [loader stopAnimating];
+}
+/**
+ *  Check if the thumbnail download is in progress
+ *
+ *  @return YES if it's downloading
+ */
+-(BOOL)isDownloading{
+    return loadToken != nil;
+}
+/**
+ *  Cancel the download and remove the images, so the object can be
+ *  used for another media
+ */
+-(void)prepareForReuse{
+    [self cancelDownload];
+    image.image = nil;
+    thumbImage = nil;
+    fullImage = nil;
+    fullImageSize = OlapicMediaImageSizeThumbnail;
+    overlay.alpha = 0;
+    self.backgroundColor = [UIColor clearColor];
+}
 /**
  *  This method is called every time the size of the view changes, and it
  *  adjust the size and position of the elements accordingly
@@ -140,14 +206,53 @@
  *  @param call A callback action to be called when the image is ready (it will be accessible via the ivar fullImage).
  */
 -(void)downloadFullImageAndDo:(void (^)(OlapicAsyncImageView *image))call{
-    OlapicSDK *olapic = [OlapicSDK sharedOlapicSDK];
-    [[olapic media] loadImageWithSize:OlapicMediaImageSizeOriginal fromMedia:media onSuccess:^(NSData *mediaData, UIImage *mediaImage){
-        fullImage = mediaImage;
+    [self downloadFullImageWithSize:OlapicMediaImageSizeOriginal andDo:call];
+}
+/**
+ *  Download a bigger version of the image from the media object. If the
+ *  current fullImage is already of that size (or bigger), the callback is
+ *  called right away, and if a smaller size arrives after a bigger one, it's
+ *  ignored.
+ *
+ *  @param size The size to download (OlapicMediaImageSizeMobile, OlapicMediaImageSizeNormal or OlapicMediaImageSizeOriginal)
+ *  @param call A callback action to be called when the image is ready (it will be accessible via the ivar fullImage).
+ */
+-(void)downloadFullImageWithSize:(OlapicMediaImageSize)size andDo:(void (^)(OlapicAsyncImageView *image))call{
+    [self downloadFullImageWithSize:size andDo:call onFailure:nil];
+}
+/**
+ *  Download a bigger version of the image from the media object, and
+ *  be informed if the download fails
+ *
+ *  @param size    The size to download (OlapicMediaImageSizeMobile, OlapicMediaImageSizeNormal or OlapicMediaImageSizeOriginal)
+ *  @param call    A callback action to be called when the image is ready (it will be accessible via the ivar fullImage).
+ *  @param failure A callback action to be called if the image couldn't be downloaded
+ */
+-(void)downloadFullImageWithSize:(OlapicMediaImageSize)size andDo:(void (^)(OlapicAsyncImageView *image))call onFailure:(void (^)(NSError *error))failure{
+    if(fullImage && fullImageSize >= size){
+        if(call) call(self);
+        return;
+    }
+    // The loader sends it through the API client, like the thumbnails
+    [[OlapicImageLoader sharedImageLoader] loadImageWithSize:size fromMedia:media onSuccess:^(UIImage *mediaImage){
+        if(!fullImage || size > fullImageSize){
+            fullImage = mediaImage;
+            fullImageSize = size;
+        }
         if(call) call(self);
     } onFailure:^(NSError *error){
-    
+        if(failure) failure(error);
     }];
 }
+/**
+ *  Get the best image available for this media: the full image, if
+ *  one was already downloaded, or the thumbnail
+ *
+ *  @return The image or nil if nothing was downloaded yet
+ */
+-(UIImage *)bestImage{
+    return fullImage ? fullImage : thumbImage;
+}
 /**
  *  Resize and crop an image proportionally
  *
@@ -177,6 +282,18 @@
     UIGraphicsEndImageContext();
     return result;
 }
+/**
+ *  Get the key used to save a resized thumbnail on the image cache
+ *
+ *  @param URL  The thumbnail URL
+ *  @param size The size of the resized image
+ *
+ *  @return The key
+ */
++(NSString *)cacheKeyForURL:(NSString *)URL resizedTo:(CGSize)size{
+    if(!URL) return nil;
+    return [NSString stringWithFormat:@"%@#%.0fx%.0f@%.0f",URL,size.width,size.height,[UIScreen mainScreen].scale];
+}
 #pragma mark - Default cycle
 /**
  *  Overwrite the default UIView setFrame method in
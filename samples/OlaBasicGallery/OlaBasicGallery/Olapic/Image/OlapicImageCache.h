@@ -0,0 +1,122 @@
+//
+//  OlapicImageCache.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import "OlapicMemoryGovernor.h"
+/**
+ *  A memory cache for decoded images, with a limit on the number of bytes
+ *  the bitmaps can use. The shared instance is managed by the memory
+ *  governor, which empties it first when the app receives a memory warning.
+ */
+@interface OlapicImageCache : NSObject <NSCacheDelegate,OlapicMemoryConsumer>{
+    /**
+     *  The real cache, where the cost of each image is its bitmap size
+     */
+    NSCache *images;
+    /**
+     *  The number of bytes the images on the cache are using
+     */
+    unsigned long long totalCost;
+    /**
+     *  The keys of the images, from the least to the most recently used
+     */
+    NSMutableOrderedSet *recentKeys;
+    /**
+     *  The cost of the image of each key
+     */
+    NSMutableDictionary *costs;
+    /**
+     *  The key of each image, to know which one is evicted
+     */
+    NSMapTable *keysForImages;
+}
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared cache
+ */
++(instancetype)sharedImageCache;
+/**
+ *  Class constructor
+ *
+ *  @param limit The maximum number of bytes the decoded images can use
+ *
+ *  @return An instance of this object (OlapicImageCache)
+ */
+-(id)initWithCostLimit:(NSUInteger)limit;
+/**
+ *  Get an image from the cache
+ *
+ *  @param key The image key (usually, its URL)
+ *
+ *  @return The image or nil if it's not on the cache
+ */
+-(UIImage *)imageForKey:(NSString *)key;
+/**
+ *  Save an image on the cache
+ *
+ *  @param image The decoded image
+ *  @param key   The image key (usually, its URL)
+ */
+-(void)setImage:(UIImage *)image forKey:(NSString *)key;
+/**
+ *  Remove an image from the cache
+ *
+ *  @param key The image key
+ */
+-(void)removeImageForKey:(NSString *)key;
+/**
+ *  Remove all the images from the cache
+ */
+-(void)removeAllImages;
+/**
+ *  Change the maximum number of bytes the decoded images can use
+ *
+ *  @param limit The new limit
+ */
+-(void)setCostLimit:(NSUInteger)limit;
+/**
+ *  Get the maximum number of bytes the decoded images can use
+ *
+ *  @return The limit
+ */
+-(NSUInteger)costLimit;
+/**
+ *  Calculate how many bytes a decoded image uses
+ *
+ *  @param image The image
+ *
+ *  @return The number of bytes
+ */
++(NSUInteger)costForImage:(UIImage *)image;
+
+@end
@@ -0,0 +1,234 @@
+//
+//  OlapicImageCache.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+// The default limit for the decoded images (32MB)
+#define kImageCacheDefaultCostLimit (32 * 1024 * 1024)
+
+#import "OlapicImageCache.h"
+
+@implementation OlapicImageCache
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared cache
+ */
++(instancetype)sharedImageCache{
+    static OlapicImageCache *sharedCache = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedCache = [[OlapicImageCache alloc] initWithCostLimit:kImageCacheDefaultCostLimit];
+        [[OlapicMemoryGovernor sharedGovernor] addConsumer:sharedCache withName:@"images" level:OlapicMemoryPurgeLevelImages budget:kImageCacheDefaultCostLimit];
+    });
+    return sharedCache;
+}
+/**
+ *  Class constructor
+ *
+ *  @param limit The maximum number of bytes the decoded images can use
+ *
+ *  @return An instance of this object (OlapicImageCache)
+ */
+-(id)initWithCostLimit:(NSUInteger)limit{
+    self = [super init];
+    if(self){
+        images = [[NSCache alloc] init];
+        [images setName:@"OlapicImageCache"];
+        [images setTotalCostLimit:limit];
+        [images setDelegate:self];
+        totalCost = 0;
+        recentKeys = [[NSMutableOrderedSet alloc] init];
+        costs = [[NSMutableDictionary alloc] init];
+        keysForImages = [NSMapTable mapTableWithKeyOptions:(NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality) valueOptions:NSPointerFunctionsStrongMemory];
+    }
+    return self;
+}
+/**
+ *  Get an image from the cache
+ *
+ *  @param key The image key (usually, its URL)
+ *
+ *  @return The image or nil if it's not on the cache
+ */
+-(UIImage *)imageForKey:(NSString *)key{
+    if(!key) return nil;
+    UIImage *image = [images objectForKey:key];
+    if(image){
+        @synchronized(self){
+            // Used now, so it's the last one to be purged
+            if([recentKeys containsObject:key]){
+                [recentKeys removeObject:key];
+                [recentKeys addObject:key];
+            }
+        }
+    }
+    return image;
+}
+/**
+ *  Save an image on the cache
+ *
+ *  @param image The decoded image
+ *  @param key   The image key (usually, its URL)
+ */
+-(void)setImage:(UIImage *)image forKey:(NSString *)key{
+    if(!image || !key) return;
+    NSUInteger cost = [OlapicImageCache costForImage:image];
+    // The previous image for the key leaves through the delegate, so it's not counted twice
+    [images removeObjectForKey:key];
+    @synchronized(self){
+        totalCost += cost;
+        [recentKeys removeObject:key];
+        [recentKeys addObject:key];
+        [costs setObject:@(cost) forKey:key];
+        [keysForImages setObject:key forKey:image];
+    }
+    // The cache is never called with the lock held, as it calls the delegate with its own lock
+    [images setObject:image forKey:key cost:cost];
+}
+/**
+ *  Remove an image from the cache
+ *
+ *  @param key The image key
+ */
+-(void)removeImageForKey:(NSString *)key{
+    if(!key) return;
+    [images removeObjectForKey:key];
+}
+/**
+ *  Remove all the images from the cache
+ */
+-(void)removeAllImages{
+    [images removeAllObjects];
+    @synchronized(self){
+        totalCost = 0;
+        [recentKeys removeAllObjects];
+        [costs removeAllObjects];
+        [keysForImages removeAllObjects];
+    }
+}
+/**
+ *  Change the maximum number of bytes the decoded images can use
+ *
+ *  @param limit The new limit
+ */
+-(void)setCostLimit:(NSUInteger)limit{
+    [images setTotalCostLimit:limit];
+}
+/**
+ *  Get the maximum number of bytes the decoded images can use
+ *
+ *  @return The limit
+ */
+-(NSUInteger)costLimit{
+    return [images totalCostLimit];
+}
+/**
+ *  Calculate how many bytes a decoded image uses
+ *
+ *  @param image The image
+ *
+ *  @return The number of bytes
+ */
++(NSUInteger)costForImage:(UIImage *)image{
+    CGImageRef cgImage = image.CGImage;
+    if(!cgImage) return (NSUInteger)(image.size.width * image.scale * image.size.height * image.scale * 4);
+    return CGImageGetBytesPerRow(cgImage) * CGImageGetHeight(cgImage);
+}
+
+#pragma mark - Memory consumer
+/**
+ *  Get the number of bytes the images on the cache are using
+ *
+ *  @return The number of bytes
+ */
+-(unsigned long long)memoryUsage{
+    @synchronized(self){
+        return totalCost;
+    }
+}
+/**
+ *  Free the bitmaps, removing the images used the longest time ago
+ *  until the cache is under the size
+ *
+ *  @param size The number of bytes it can keep
+ */
+-(void)purgeMemoryToSize:(unsigned long long)size{
+    NSMutableArray *purged = [[NSMutableArray alloc] init];
+    @synchronized(self){
+        unsigned long long remaining = totalCost;
+        for(NSString *key in recentKeys){
+            if(remaining <= size) break;
+            [purged addObject:key];
+            remaining -= MIN(remaining, [[costs objectForKey:key] unsignedLongLongValue]);
+        }
+    }
+    // The delegate updates the cost of each image that leaves
+    for(int i = 0; i < [purged count]; i++){
+        [images removeObjectForKey:[purged objectAtIndex:i]];
+    }
+    @synchronized(self){
+        // Keys whose image was already evicted by the cache itself
+        for(int i = 0; i < [purged count]; i++){
+            [recentKeys removeObject:[purged objectAtIndex:i]];
+            [costs removeObjectForKey:[purged objectAtIndex:i]];
+        }
+    }
+}
+/**
+ *  Apply the budget as the cache limit
+ *
+ *  @param budget The number of bytes the decoded images can use
+ */
+-(void)setMemoryBudget:(unsigned long long)budget{
+    [self setCostLimit:(NSUInteger)budget];
+}
+
+#pragma mark - Cache delegate
+/**
+ *  An image is leaving the cache (evicted or removed)
+ *
+ *  @param cache The cache
+ *  @param obj   The image
+ */
+-(void)cache:(NSCache *)cache willEvictObject:(id)obj{
+    NSUInteger cost = [OlapicImageCache costForImage:obj];
+    @synchronized(self){
+        totalCost -= MIN(totalCost, (unsigned long long)cost);
+        NSString *key = [keysForImages objectForKey:obj];
+        if(key){
+            [keysForImages removeObjectForKey:obj];
+            [recentKeys removeObject:key];
+            [costs removeObjectForKey:key];
+        }
+    }
+}
+
+@end
@@ -0,0 +1,158 @@
+//
+//  OlapicImageLoader.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <OlapicSDK/OlapicSDK.h>
+#import "OlapicImageCache.h"
+#import "OlapicHTTPSession.h"
+#import "OlapicAPIClient.h"
+/**
+ *  Downloads and decodes the media images for the UI, with support
+ *  for cancellation and prefetching:
+ *
+ *  - The images are decoded on a background queue and saved on an
+ *    OlapicImageCache, so the main thread only has to show them.
+ *  - Requests for the same URL are merged into a single download.
+ *  - Every load returns a token that can be used to cancel it; the download
+ *    is only cancelled when nothing else is waiting for it.
+ *  - Prefetched images are downloaded and cached without callbacks, and
+ *    they can be cancelled when they are not needed anymore.
+ *  - The downloads go through OlapicAPIClient, so they are rate limited,
+ *    retried after temporary errors and held while the device is offline.
+ *    The images of a host share a circuit breaker, and the prefetches
+ *    wait behind the images that are on the screen.
+ *
+ *  This object should be used from the main thread, and the
+ *  callbacks are always called on the main thread.
+ */
+@interface OlapicImageLoader : NSObject{
+    /**
+     *  The session used for the downloads
+     */
+    NSURLSession *session;
+    /**
+     *  The cache for the decoded images
+     */
+    OlapicImageCache *cache;
+    /**
+     *  The downloads in progress, by URL. Each one is a dictionary
+     *  with the task (once it's sent), the handlers, the prefetch flag
+     *  and the cancelled flag
+     */
+    NSMutableDictionary *operations;
+    /**
+     *  The URL for each active token
+     */
+    NSMutableDictionary *tokens;
+}
+
+@property (nonatomic,strong,readonly) NSURLSession *session;
+@property (nonatomic,strong,readonly) OlapicImageCache *cache;
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared loader
+ */
++(instancetype)sharedImageLoader;
+/**
+ *  Class constructor
+ *
+ *  @param configuration The configuration for the downloads session
+ *  @param imageCache    The cache for the decoded images
+ *
+ *  @return An instance of this object (OlapicImageLoader)
+ */
+-(id)initWithSessionConfiguration:(NSURLSessionConfiguration *)configuration andCache:(OlapicImageCache *)imageCache;
+/**
+ *  Class constructor, to share a session with other components
+ *
+ *  @param urlSession The session for the downloads
+ *  @param imageCache The cache for the decoded images
+ *
+ *  @return An instance of this object (OlapicImageLoader)
+ */
+-(id)initWithSession:(NSURLSession *)urlSession andCache:(OlapicImageCache *)imageCache;
+/**
+ *  Load an image from a URL
+ *
+ *  @param URL     The image URL
+ *  @param success A callback for when the image is ready
+ *  @param failure A callback for when the image can't be loaded
+ *
+ *  @return A token to cancel the load, or nil if the image was on the cache (and the success callback was already called)
+ */
+-(NSString *)loadImageFromURL:(NSString *)URL onSuccess:(void (^)(UIImage *image))success onFailure:(void (^)(NSError *error))failure;
+/**
+ *  Load one of the images of a media object
+ *
+ *  @param size    The image size
+ *  @param media   The media object
+ *  @param success A callback for when the image is ready
+ *  @param failure A callback for when the image can't be loaded
+ *
+ *  @return A token to cancel the load, or nil if the image was on the cache (and the success callback was already called)
+ */
+-(NSString *)loadImageWithSize:(OlapicMediaImageSize)size fromMedia:(OlapicMediaEntity *)media onSuccess:(void (^)(UIImage *image))success onFailure:(void (^)(NSError *error))failure;
+/**
+ *  Cancel a load. The callbacks won't be called, and if nothing
+ *  else is waiting for the image, the download is cancelled
+ *
+ *  @param token The token returned by the load
+ */
+-(void)cancelLoad:(NSString *)token;
+/**
+ *  Start downloading the images of a list of media, so they are
+ *  on the cache before they are needed
+ *
+ *  @param size  The image size
+ *  @param media An array of OlapicMediaEntity objects
+ */
+-(void)prefetchImagesWithSize:(OlapicMediaImageSize)size forMedia:(NSArray *)media;
+/**
+ *  Cancel the prefetch of the images of a list of media. The downloads
+ *  that are also waited by a load continue
+ *
+ *  @param size  The image size
+ *  @param media An array of OlapicMediaEntity objects
+ */
+-(void)cancelPrefetchingImagesWithSize:(OlapicMediaImageSize)size forMedia:(NSArray *)media;
+/**
+ *  Decode an image on the current thread, so it doesn't have to be
+ *  decoded on the main thread when it's shown
+ *
+ *  @param data The image data
+ *
+ *  @return The decoded image or nil if the data is not a valid image
+ */
++(UIImage *)decodedImageWithData:(NSData *)data;
+
+@end
@@ -0,0 +1,345 @@
+//
+//  OlapicImageLoader.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "OlapicImageLoader.h"
+
+@interface OlapicImageLoader()
+/**
+ *  Get the operation for a URL, creating it (and starting the
+ *  download) if there isn't one
+ *
+ *  @param URL      The image URL
+ *  @param priority The download priority, if it has to be created
+ *
+ *  @return The operation dictionary
+ */
+-(NSMutableDictionary *)operationForURL:(NSString *)URL priority:(OlapicRequestPriority)priority;
+/**
+ *  Call the handlers of an operation and remove it
+ *
+ *  @param URL   The image URL
+ *  @param image The decoded image or nil if there was an error
+ *  @param error The error, if there was one
+ */
+-(void)finishOperationForURL:(NSString *)URL withImage:(UIImage *)image error:(NSError *)error;
+/**
+ *  Cancel the download of an operation if nothing is waiting for it
+ *
+ *  @param URL The image URL
+ */
+-(void)cancelOperationIfUnusedForURL:(NSString *)URL;
+/**
+ *  Get the endpoint for the circuit breaker of an image: all the images
+ *  of a host share it
+ *
+ *  @param URL The image URL
+ *
+ *  @return The endpoint name
+ */
++(NSString *)endpointForImageURL:(NSString *)URL;
+
+@end
+
+@implementation OlapicImageLoader
+@synthesize session,cache;
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared loader
+ */
++(instancetype)sharedImageLoader{
+    static OlapicImageLoader *sharedLoader = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        // The images use the same connections as the rest of the app
+        sharedLoader = [[OlapicImageLoader alloc] initWithSession:[[OlapicHTTPSession sharedHTTPSession] session] andCache:[OlapicImageCache sharedImageCache]];
+    });
+    return sharedLoader;
+}
+/**
+ *  Class constructor
+ *
+ *  @param configuration The configuration for the downloads session
+ *  @param imageCache    The cache for the decoded images
+ *
+ *  @return An instance of this object (OlapicImageLoader)
+ */
+-(id)initWithSessionConfiguration:(NSURLSessionConfiguration *)configuration andCache:(OlapicImageCache *)imageCache{
+    return [self initWithSession:[NSURLSession sessionWithConfiguration:configuration] andCache:imageCache];
+}
+/**
+ *  Class constructor, to share a session with other components
+ *
+ *  @param urlSession The session for the downloads
+ *  @param imageCache The cache for the decoded images
+ *
+ *  @return An instance of this object (OlapicImageLoader)
+ */
+-(id)initWithSession:(NSURLSession *)urlSession andCache:(OlapicImageCache *)imageCache{
+    self = [super init];
+    if(self){
+        session = urlSession;
+        cache = imageCache;
+        operations = [[NSMutableDictionary alloc] init];
+        tokens = [[NSMutableDictionary alloc] init];
+    }
+    return self;
+}
+/**
+ *  Load an image from a URL
+ *
+ *  @param URL     The image URL
+ *  @param success A callback for when the image is ready
+ *  @param failure A callback for when the image can't be loaded
+ *
+ *  @return A token to cancel the load, or nil if the image was on the cache (and the success callback was already called)
+ */
+-(NSString *)loadImageFromURL:(NSString *)URL onSuccess:(void (^)(UIImage *image))success onFailure:(void (^)(NSError *error))failure{
+    if(!URL){
+        if(failure) failure([NSError errorWithDomain:@"OlapicImageLoader" code:0 userInfo:@{NSLocalizedDescriptionKey: @"There's no URL for the image"}]);
+        return nil;
+    }
+    UIImage *cached = [cache imageForKey:URL];
+    if(cached){
+        if(success) success(cached);
+        return nil;
+    }
+    NSString *token = [[NSUUID UUID] UUIDString];
+    NSMutableDictionary *handler = [[NSMutableDictionary alloc] init];
+    [handler setObject:token forKey:@"token"];
+    if(success) [handler setObject:[success copy] forKey:@"success"];
+    if(failure) [handler setObject:[failure copy] forKey:@"failure"];
+    // The loads are for the images on the screen, so they go before the prefetches
+    [[[self operationForURL:URL priority:OlapicRequestPriorityNormal] objectForKey:@"handlers"] addObject:handler];
+    [tokens setObject:URL forKey:token];
+    return token;
+}
+/**
+ *  Load one of the images of a media object
+ *
+ *  @param size    The image size
+ *  @param media   The media object
+ *  @param success A callback for when the image is ready
+ *  @param failure A callback for when the image can't be loaded
+ *
+ *  @return A token to cancel the load, or nil if the image was on the cache (and the success callback was already called)
+ */
+-(NSString *)loadImageWithSize:(OlapicMediaImageSize)size fromMedia:(OlapicMediaEntity *)media onSuccess:(void (^)(UIImage *image))success onFailure:(void (^)(NSError *error))failure{
+    return [self loadImageFromURL:[media getMediaURLForImageSize:size] onSuccess:success onFailure:failure];
+}
+/**
+ *  Cancel a load. The callbacks won't be called, and if nothing
+ *  else is waiting for the image, the download is cancelled
+ *
+ *  @param token The token returned by the load
+ */
+-(void)cancelLoad:(NSString *)token{
+    if(!token) return;
+    NSString *URL = [tokens objectForKey:token];
+    if(!URL) return;
+    [tokens removeObjectForKey:token];
+    NSMutableArray *handlers = [[operations objectForKey:URL] objectForKey:@"handlers"];
+    for(int i = 0; i < [handlers count]; i++){
+        if([[[handlers objectAtIndex:i] objectForKey:@"token"] isEqualToString:token]){
+            [handlers removeObjectAtIndex:i];
+            break;
+        }
+    }
+    [self cancelOperationIfUnusedForURL:URL];
+}
+/**
+ *  Start downloading the images of a list of media, so they are
+ *  on the cache before they are needed
+ *
+ *  @param size  The image size
+ *  @param media An array of OlapicMediaEntity objects
+ */
+-(void)prefetchImagesWithSize:(OlapicMediaImageSize)size forMedia:(NSArray *)media{
+    for(int i = 0; i < [media count]; i++){
+        NSString *URL = [[media objectAtIndex:i] getMediaURLForImageSize:size];
+        if(!URL || [cache imageForKey:URL]) continue;
+        [[self operationForURL:URL priority:OlapicRequestPriorityLow] setObject:@YES forKey:@"prefetch"];
+    }
+}
+/**
+ *  Cancel the prefetch of the images of a list of media. The downloads
+ *  that are also waited by a load continue
+ *
+ *  @param size  The image size
+ *  @param media An array of OlapicMediaEntity objects
+ */
+-(void)cancelPrefetchingImagesWithSize:(OlapicMediaImageSize)size forMedia:(NSArray *)media{
+    for(int i = 0; i < [media count]; i++){
+        NSString *URL = [[media objectAtIndex:i] getMediaURLForImageSize:size];
+        NSMutableDictionary *operation = URL ? [operations objectForKey:URL] : nil;
+        if(!operation) continue;
+        [operation setObject:@NO forKey:@"prefetch"];
+        [self cancelOperationIfUnusedForURL:URL];
+    }
+}
+/**
+ *  Get the operation for a URL, creating it (and starting the
+ *  download) if there isn't one
+ *
+ *  @param URL      The image URL
+ *  @param priority The download priority, if it has to be created
+ *
+ *  @return The operation dictionary
+ */
+-(NSMutableDictionary *)operationForURL:(NSString *)URL priority:(OlapicRequestPriority)priority{
+    NSMutableDictionary *operation = [operations objectForKey:URL];
+    if(operation) return operation;
+    operation = [[NSMutableDictionary alloc] init];
+    [operation setObject:[[NSMutableArray alloc] init] forKey:@"handlers"];
+    [operation setObject:@NO forKey:@"prefetch"];
+    [operation setObject:@NO forKey:@"cancelled"];
+    [operations setObject:operation forKey:URL];
+    [[OlapicAPIClient sharedClient] performRequestForURL:URL endpoint:[OlapicImageLoader endpointForImageURL:URL] priority:priority withBlock:^(void (^attemptSuccess)(id response), void (^attemptFailure)(NSError *error)){
+        // It was cancelled while it waited for its turn
+        if([[operation objectForKey:@"cancelled"] boolValue]){
+            attemptFailure([NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorCancelled userInfo:nil]);
+            return;
+        }
+        NSDate *start = [NSDate date];
+        NSURLSessionDataTask *task = [session dataTaskWithURL:[NSURL URLWithString:URL] completionHandler:^(NSData *data, NSURLResponse *response, NSError *error){
+            // The downloads are timed here when the session doesn't report its own metrics
+            // (before iOS 10, or with a session that doesn't use the shared metrics)
+            if(!error && [data length] > 0 && (!NSClassFromString(@"NSURLSessionTaskMetrics") || ![[session delegate] isKindOfClass:[OlapicNetworkMetrics class]])){
+                [[[OlapicHTTPSession sharedHTTPSession] metrics] recordTransferOfBytes:[data length] duration:-[start timeIntervalSinceNow]];
+            }
+            // The client expects the attempts to finish on the main thread
+            dispatch_async(dispatch_get_main_queue(), ^{
+                NSError *attemptError = error;
+                if(!attemptError && [response isKindOfClass:[NSHTTPURLResponse class]] && [(NSHTTPURLResponse *)response statusCode] >= 400){
+                    // The response goes with the error, so the retries can read its status and headers
+                    attemptError = [NSError errorWithDomain:@"OlapicImageLoader" code:2 userInfo:@{NSLocalizedDescriptionKey: @"The image couldn't be downloaded", @"response": response}];
+                }
+                if(attemptError){
+                    attemptFailure(attemptError);
+                }else{
+                    attemptSuccess(data);
+                }
+            });
+        }];
+        [operation setObject:task forKey:@"task"];
+        [task resume];
+    } policy:nil completionQueue:dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0) onSuccess:^(NSData *data){
+        // The callbacks come on a background queue, so the decoding
+        // doesn't happen on the main thread
+        UIImage *image = [OlapicImageLoader decodedImageWithData:data];
+        NSError *loadError = image ? nil : [NSError errorWithDomain:@"OlapicImageLoader" code:1 userInfo:@{NSLocalizedDescriptionKey: @"The response is not a valid image"}];
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [self finishOperationForURL:URL withImage:image error:loadError];
+        });
+    } onFailure:^(NSError *error){
+        // A cancelled download was already removed, and there could be
+        // a new one for the same URL
+        if([[error domain] isEqualToString:NSURLErrorDomain] && [error code] == NSURLErrorCancelled) return;
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [self finishOperationForURL:URL withImage:nil error:error];
+        });
+    }];
+    return operation;
+}
+/**
+ *  Call the handlers of an operation and remove it
+ *
+ *  @param URL   The image URL
+ *  @param image The decoded image or nil if there was an error
+ *  @param error The error, if there was one
+ */
+-(void)finishOperationForURL:(NSString *)URL withImage:(UIImage *)image error:(NSError *)error{
+    NSMutableDictionary *operation = [operations objectForKey:URL];
+    if(!operation) return;
+    [operations removeObjectForKey:URL];
+    if(image){
+        [cache setImage:image forKey:URL];
+    }
+    NSArray *handlers = [operation objectForKey:@"handlers"];
+    for(int i = 0; i < [handlers count]; i++){
+        NSDictionary *handler = [handlers objectAtIndex:i];
+        [tokens removeObjectForKey:[handler objectForKey:@"token"]];
+        if(image){
+            void (^success)(UIImage *image) = [handler objectForKey:@"success"];
+            if(success) success(image);
+        }else{
+            void (^failure)(NSError *error) = [handler objectForKey:@"failure"];
+            if(failure) failure(error);
+        }
+    }
+}
+/**
+ *  Cancel the download of an operation if nothing is waiting for it
+ *
+ *  @param URL The image URL
+ */
+-(void)cancelOperationIfUnusedForURL:(NSString *)URL{
+    NSMutableDictionary *operation = [operations objectForKey:URL];
+    if(!operation) return;
+    if([[operation objectForKey:@"handlers"] count] > 0 || [[operation objectForKey:@"prefetch"] boolValue]) return;
+    // If it's still waiting for its turn, it's not sent
+    [operation setObject:@YES forKey:@"cancelled"];
+    [[operation objectForKey:@"task"] cancel];
+    [operations removeObjectForKey:URL];
+}
+/**
+ *  Get the endpoint for the circuit breaker of an image: all the images
+ *  of a host share it
+ *
+ *  @param URL The image URL
+ *
+ *  @return The endpoint name
+ */
++(NSString *)endpointForImageURL:(NSString *)URL{
+    NSString *host = [[NSURL URLWithString:URL] host];
+    return [NSString stringWithFormat:@"%@/images", host ? host : @""];
+}
+/**
+ *  Decode an image on the current thread, so it doesn't have to be
+ *  decoded on the main thread when it's shown
+ *
+ *  @param data The image data
+ *
+ *  @return The decoded image or nil if the data is not a valid image
+ */
++(UIImage *)decodedImageWithData:(NSData *)data{
+    if(!data) return nil;
+    UIImage *image = [UIImage imageWithData:data];
+    if(!image) return nil;
+    UIGraphicsBeginImageContextWithOptions(image.size, NO, image.scale);
+    [image drawAtPoint:CGPointZero];
+    UIImage *decoded = UIGraphicsGetImageFromCurrentImageContext();
+    UIGraphicsEndImageContext();
+    return decoded ? decoded : image;
+}
+
+@end
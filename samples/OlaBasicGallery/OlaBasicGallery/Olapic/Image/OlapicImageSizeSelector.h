@@ -0,0 +1,145 @@
+//
+//  OlapicImageSizeSelector.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <OlapicSDK/OlapicSDK.h>
+#import "OlapicNetworkMetrics.h"
+#import "OlapicReachability.h"
+/**
+ *  Chooses the image size of a media automatically, instead of
+ *  hardcoding one:
+ *
+ *  - It picks the smallest size that covers the pixels of the view (at
+ *    the screen scale). The square size is never picked, as it's cropped.
+ *  - The media original dimensions are the real limit: no size is
+ *    bigger than them, so a small original is never asked in a bigger
+ *    size. The dimensions of the other sizes are the ones measured on
+ *    the images already downloaded (the API doesn't say them), starting
+ *    with the usual values until an image of each size is seen.
+ *  - When the measured download speed is low, the sizes bigger than
+ *    the mobile one are replaced by the mobile one. On a cellular
+ *    connection the same happens while the speed is not known yet.
+ *
+ *  The speed comes from the shared session metrics, and the last
+ *  choice is included on the metrics snapshot, for tuning.
+ */
+@interface OlapicImageSizeSelector : NSObject<OlapicNetworkMetricsSource>{
+    /**
+     *  The download speed (bytes per second) under which the
+     *  images are limited to the mobile size
+     */
+    double lowThroughput;
+    /**
+     *  The last size chosen
+     */
+    OlapicMediaImageSize lastSize;
+    /**
+     *  The pixels needed for the last choice
+     */
+    CGSize lastPixelSize;
+    /**
+     *  The number of times the size was limited because of the speed
+     */
+    NSUInteger steppedDown;
+    /**
+     *  The longest side, in pixels, of the images downloaded for each size
+     */
+    NSMutableDictionary *measuredDimensions;
+    /**
+     *  The object that says the connection type
+     */
+    OlapicReachability *reachability;
+}
+
+@property (nonatomic) double lowThroughput;
+@property (nonatomic,readonly) OlapicMediaImageSize lastSize;
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared selector
+ */
++(instancetype)sharedSelector;
+/**
+ *  Get the longest side, in pixels, of an image size of a media
+ *
+ *  @param size  The image size
+ *  @param media The media object (it can be nil)
+ *
+ *  @return The number of pixels (CGFLOAT_MAX for the original, if the media doesn't say its dimensions)
+ */
+-(CGFloat)pixelDimensionForSize:(OlapicMediaImageSize)size ofMedia:(OlapicMediaEntity *)media;
+/**
+ *  Save the real dimensions of an image that was downloaded, so the
+ *  next choices use them
+ *
+ *  @param image The image
+ *  @param size  The size it was downloaded with
+ */
+-(void)recordImage:(UIImage *)image withSize:(OlapicMediaImageSize)size;
+/**
+ *  Choose the size for a number of pixels
+ *
+ *  @param pixels The size, in pixels, the image will use on the screen
+ *  @param media  The media object (it can be nil)
+ *
+ *  @return The image size
+ */
+-(OlapicMediaImageSize)sizeForPixelSize:(CGSize)pixels ofMedia:(OlapicMediaEntity *)media;
+/**
+ *  Choose the size for a view
+ *
+ *  @param points The view size, in points
+ *  @param media  The media object (it can be nil)
+ *
+ *  @return The image size
+ */
+-(OlapicMediaImageSize)sizeForViewSize:(CGSize)points ofMedia:(OlapicMediaEntity *)media;
+/**
+ *  Get the current download speed estimate
+ *
+ *  @return The speed in bytes per second (0 if it's not known yet)
+ */
+-(double)throughput;
+/**
+ *  Load the image of a media with the size chosen for a view, using
+ *  the shared image loader
+ *
+ *  @param points  The view size, in points
+ *  @param media   The media object
+ *  @param success A callback for when the image is ready
+ *  @param failure A callback for when the image can't be loaded
+ *
+ *  @return A token to cancel the load, or nil if the image was on the cache
+ */
+-(NSString *)loadImageFittingSize:(CGSize)points fromMedia:(OlapicMediaEntity *)media onSuccess:(void (^)(UIImage *image, OlapicMediaImageSize size))success onFailure:(void (^)(NSError *error))failure;
+
+@end
@@ -0,0 +1,254 @@
+//
+//  OlapicImageSizeSelector.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+// The longest side of each size, in pixels, until an image of that size is measured (the API doesn't say it)
+#define kImageSizeThumbnailPixels 150
+#define kImageSizeMobilePixels 480
+#define kImageSizeNormalPixels 640
+// The speed under which the images are limited to the mobile size (128KB/s)
+#define kImageSizeLowThroughput (128 * 1024)
+
+#import "OlapicImageSizeSelector.h"
+#import "OlapicHTTPSession.h"
+#import "OlapicImageLoader.h"
+
+@interface OlapicImageSizeSelector()
+/**
+ *  Get the longest side, in pixels, of an image size, without the
+ *  limit of the original dimensions
+ *
+ *  @param size The image size
+ *
+ *  @return The number of pixels (CGFLOAT_MAX for the original)
+ */
+-(CGFloat)dimensionForSize:(OlapicMediaImageSize)size;
+/**
+ *  Get the longest side, in pixels, of the original image of a media
+ *
+ *  @param media The media object
+ *
+ *  @return The number of pixels, or 0 if the media doesn't say it
+ */
++(CGFloat)originalDimensionOfMedia:(OlapicMediaEntity *)media;
+
+@end
+
+@implementation OlapicImageSizeSelector
+@synthesize lowThroughput,lastSize;
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared selector
+ */
++(instancetype)sharedSelector{
+    static OlapicImageSizeSelector *sharedSelector = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedSelector = [[OlapicImageSizeSelector alloc] init];
+        [[[OlapicHTTPSession sharedHTTPSession] metrics] addSource:sharedSelector withName:@"imageSize"];
+    });
+    return sharedSelector;
+}
+/**
+ *  Class constructor
+ *
+ *  @return An instance of this object (OlapicImageSizeSelector)
+ */
+-(id)init{
+    self = [super init];
+    if(self){
+        lowThroughput = kImageSizeLowThroughput;
+        lastSize = OlapicMediaImageSizeThumbnail;
+        lastPixelSize = CGSizeZero;
+        steppedDown = 0;
+        measuredDimensions = [[NSMutableDictionary alloc] init];
+        reachability = [OlapicReachability sharedReachability];
+    }
+    return self;
+}
+/**
+ *  Get the longest side, in pixels, of an image size of a media
+ *
+ *  @param size  The image size
+ *  @param media The media object (it can be nil)
+ *
+ *  @return The number of pixels (CGFLOAT_MAX for the original, if the media doesn't say its dimensions)
+ */
+-(CGFloat)pixelDimensionForSize:(OlapicMediaImageSize)size ofMedia:(OlapicMediaEntity *)media{
+    CGFloat original = [OlapicImageSizeSelector originalDimensionOfMedia:media];
+    CGFloat dimension = [self dimensionForSize:size];
+    // The sizes are reductions of the original, never bigger than it
+    return original > 0 ? MIN(dimension, original) : dimension;
+}
+/**
+ *  Get the longest side, in pixels, of an image size, without the
+ *  limit of the original dimensions
+ *
+ *  @param size The image size
+ *
+ *  @return The number of pixels (CGFLOAT_MAX for the original)
+ */
+-(CGFloat)dimensionForSize:(OlapicMediaImageSize)size{
+    if(size == OlapicMediaImageSizeOriginal) return CGFLOAT_MAX;
+    if(size == OlapicMediaImageSizeSquare) size = OlapicMediaImageSizeThumbnail;
+    @synchronized(measuredDimensions){
+        NSNumber *measured = [measuredDimensions objectForKey:@(size)];
+        if(measured) return [measured doubleValue];
+    }
+    switch(size){
+        case OlapicMediaImageSizeMobile:
+            return kImageSizeMobilePixels;
+        case OlapicMediaImageSizeNormal:
+            return kImageSizeNormalPixels;
+        default:
+            return kImageSizeThumbnailPixels;
+    }
+}
+/**
+ *  Get the longest side, in pixels, of the original image of a media
+ *
+ *  @param media The media object
+ *
+ *  @return The number of pixels, or 0 if the media doesn't say it
+ */
++(CGFloat)originalDimensionOfMedia:(OlapicMediaEntity *)media{
+    if(!media) return 0;
+    CGSize original = media.originalSize;
+    return MAX(original.width, original.height);
+}
+/**
+ *  Save the real dimensions of an image that was downloaded, so the
+ *  next choices use them
+ *
+ *  @param image The image
+ *  @param size  The size it was downloaded with
+ */
+-(void)recordImage:(UIImage *)image withSize:(OlapicMediaImageSize)size{
+    if(!image || size == OlapicMediaImageSizeOriginal || size == OlapicMediaImageSizeSquare) return;
+    CGFloat longest = MAX(image.size.width, image.size.height) * image.scale;
+    if(longest <= 0) return;
+    @synchronized(measuredDimensions){
+        // A small original gives a smaller image, so the biggest one seen is the size limit
+        NSNumber *measured = [measuredDimensions objectForKey:@(size)];
+        if(!measured || [measured doubleValue] < longest){
+            [measuredDimensions setObject:@(longest) forKey:@(size)];
+        }
+    }
+}
+/**
+ *  Choose the size for a number of pixels
+ *
+ *  @param pixels The size, in pixels, the image will use on the screen
+ *  @param media  The media object (it can be nil)
+ *
+ *  @return The image size
+ */
+-(OlapicMediaImageSize)sizeForPixelSize:(CGSize)pixels ofMedia:(OlapicMediaEntity *)media{
+    CGFloat longest = MAX(pixels.width, pixels.height);
+    // There's nothing to gain asking for more pixels than the original has
+    CGFloat original = [OlapicImageSizeSelector originalDimensionOfMedia:media];
+    if(original > 0) longest = MIN(longest, original);
+    OlapicMediaImageSize size = OlapicMediaImageSizeOriginal;
+    for(OlapicMediaImageSize candidate = OlapicMediaImageSizeThumbnail; candidate < OlapicMediaImageSizeOriginal; candidate++){
+        if([self pixelDimensionForSize:candidate ofMedia:media] >= longest){
+            size = candidate;
+            break;
+        }
+    }
+    double speed = [self throughput];
+    // On a cellular connection the speed has to be proven first
+    BOOL slow = (speed > 0 && speed < lowThroughput) || (speed == 0 && [reachability connectionType] == OlapicConnectionTypeCellular);
+    if(size > OlapicMediaImageSizeMobile && slow){
+        size = OlapicMediaImageSizeMobile;
+        steppedDown++;
+    }
+    lastSize = size;
+    lastPixelSize = pixels;
+    return size;
+}
+/**
+ *  Choose the size for a view
+ *
+ *  @param points The view size, in points
+ *  @param media  The media object (it can be nil)
+ *
+ *  @return The image size
+ */
+-(OlapicMediaImageSize)sizeForViewSize:(CGSize)points ofMedia:(OlapicMediaEntity *)media{
+    CGFloat scale = [UIScreen mainScreen].scale;
+    return [self sizeForPixelSize:CGSizeMake(points.width * scale, points.height * scale) ofMedia:media];
+}
+/**
+ *  Get the current download speed estimate
+ *
+ *  @return The speed in bytes per second (0 if it's not known yet)
+ */
+-(double)throughput{
+    return [[[OlapicHTTPSession sharedHTTPSession] metrics] throughput];
+}
+/**
+ *  Load the image of a media with the size chosen for a view, using
+ *  the shared image loader
+ *
+ *  @param points  The view size, in points
+ *  @param media   The media object
+ *  @param success A callback for when the image is ready
+ *  @param failure A callback for when the image can't be loaded
+ *
+ *  @return A token to cancel the load, or nil if the image was on the cache
+ */
+-(NSString *)loadImageFittingSize:(CGSize)points fromMedia:(OlapicMediaEntity *)media onSuccess:(void (^)(UIImage *image, OlapicMediaImageSize size))success onFailure:(void (^)(NSError *error))failure{
+    OlapicMediaImageSize size = [self sizeForViewSize:points ofMedia:media];
+    return [[OlapicImageLoader sharedImageLoader] loadImageWithSize:size fromMedia:media onSuccess:^(UIImage *image){
+        [self recordImage:image withSize:size];
+        if(success) success(image, size);
+    } onFailure:failure];
+}
+#pragma mark - Metrics source
+/**
+ *  Get the last choice and the values used for it
+ *
+ *  @return A dictionary with the values, by name
+ */
+-(NSDictionary *)metricsSnapshot{
+    return @{
+             @"lastSize": [OlapicMediaHandler getKeyForImageSize:lastSize],
+             @"lastPixelWidth": @(lastPixelSize.width),
+             @"lastPixelHeight": @(lastPixelSize.height),
+             @"throughput": @([self throughput]),
+             @"lowThroughput": @(lowThroughput),
+             @"steppedDown": @(steppedDown),
+             @"connectionType": [OlapicReachability nameForConnectionType:[reachability connectionType]]
+             };
+}
+
+@end
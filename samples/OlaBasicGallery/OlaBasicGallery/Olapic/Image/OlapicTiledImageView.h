@@ -0,0 +1,132 @@
+//
+//  OlapicTiledImageView.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <ImageIO/ImageIO.h>
+#import <OlapicSDK/OlapicSDK.h>
+/**
+ *  Shows the original image of a media entity using a CATiledLayer, so
+ *  it can be zoomed without decoding the whole original into memory:
+ *
+ *  - The original is downloaded once and saved on the disk cache.
+ *  - Each zoom level is read from the original already downsampled to the
+ *    level size, and only one level is kept per view. The full size level
+ *    is decoded once, and all its tiles are cut from it at the same time.
+ *    Only one original is decoded at a time, for all the tiled views.
+ *  - A tile is only rendered when it's drawn, that is, when it's visible.
+ *    It's cropped from its level and saved next to the original, and the
+ *    rendered tiles are kept on a cache shared by all the tiled views, with
+ *    a memory limit. The disk cache also has a limit: the originals used the
+ *    longest time ago are removed, with their tiles.
+ *
+ *  The idea is to put it on top of a smaller version of the image, with
+ *  the same frame, so it works as the detail layer when the user zooms in.
+ */
+@interface OlapicTiledImageView : UIView{
+    /**
+     *  The media entity from where the image comes
+     */
+    OlapicMediaEntity *media;
+    /**
+     *  The biggest zoom scale this view will be shown at. It's used to
+     *  know how many levels of detail are needed
+     */
+    CGFloat maximumScale;
+    /**
+     *  The size, in pixels, of each tile
+     */
+    CGFloat tileSize;
+    /**
+     *  The size of the original image, in pixels
+     */
+    CGSize imageSize;
+    /**
+     *  The path of the original image on the disk cache
+     */
+    NSString *originalPath;
+    /**
+     *  The directory where the original and its tiles are saved
+     */
+    NSString *directory;
+    /**
+     *  The view bounds, saved on the main thread so the tiles can be
+     *  drawn on the background
+     */
+    CGSize boundsSize;
+    /**
+     *  The source for the original file, opened once the file is ready
+     */
+    CGImageSourceRef source;
+    /**
+     *  The image of the last level used to render tiles, downsampled to
+     *  the level size. The full size level is never kept
+     */
+    UIImage *levelImage;
+    /**
+     *  The width (in pixels) of the level of levelImage
+     */
+    CGFloat levelImageWidth;
+}
+
+@property (nonatomic,strong,readonly) OlapicMediaEntity *media;
+@property (nonatomic) CGFloat maximumScale;
+@property (nonatomic) CGFloat tileSize;
+@property (nonatomic,readonly) CGSize imageSize;
+/**
+ *  Class constructor
+ *
+ *  @param frame The view frame (the same one of the image it's covering)
+ *  @param med   The media object
+ *
+ *  @return An instance of this object (OlapicTiledImageView)
+ */
+-(id)initWithFrame:(CGRect)frame andMedia:(OlapicMediaEntity *)med;
+/**
+ *  Download the original image (or take it from the disk cache) and
+ *  start showing the tiles
+ *
+ *  @param success A callback for when the view is ready
+ *  @param failure A callback for when the original can't be downloaded or read
+ */
+-(void)loadOriginalAndDo:(void (^)(OlapicTiledImageView *view))success onFailure:(void (^)(NSError *error))failure;
+/**
+ *  The cache for the decoded tiles, shared by all the tiled views
+ *
+ *  @return The cache
+ */
++(NSCache *)tileCache;
+/**
+ *  Remove all the originals and tiles from the disk cache
+ */
++(void)clearDiskCache;
+
+@end
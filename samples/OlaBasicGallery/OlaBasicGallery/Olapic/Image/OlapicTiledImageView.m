@@ -0,0 +1,531 @@
+//
+//  OlapicTiledImageView.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#define kTileSize 256.0
+// The memory limit for the decoded tiles (~ 48 tiles of 256x256)
+#define kTileCacheCostLimit (12 * 1024 * 1024)
+#define kTileDiskCacheDirectory @"OlapicTiles"
+// The space the originals and their tiles can use on the disk (100MB)
+#define kTileDiskCacheCapacity (100 * 1024 * 1024)
+#define kTileJPEGQuality 0.85
+
+#import <QuartzCore/QuartzCore.h>
+#import <ImageIO/ImageIO.h>
+#import "OlapicTiledImageView.h"
+#import "OlapicFileDownloader.h"
+
+@interface OlapicTiledImageView()
+/**
+ *  Read the original size from the disk cache file, without decoding it,
+ *  and configure the tiled layer
+ *
+ *  @return If the file could be read
+ */
+-(BOOL)prepareOriginal;
+/**
+ *  Get a tile, from the memory cache, from the disk cache or
+ *  rendering it from the level where it belongs
+ *
+ *  @param levelSize The size of the level, in pixels
+ *  @param column    The tile column
+ *  @param row       The tile row
+ *
+ *  @return The tile image or nil if it can't be rendered
+ */
+-(UIImage *)tileForLevel:(CGSize)levelSize column:(NSInteger)column row:(NSInteger)row;
+/**
+ *  Crop a single tile from its level and save it on the disk cache
+ *
+ *  @param levelSize The size of the level, in pixels
+ *  @param column    The tile column
+ *  @param row       The tile row
+ *
+ *  @return The tile image or nil if the level can't be read
+ */
+-(UIImage *)renderTileForLevel:(CGSize)levelSize column:(NSInteger)column row:(NSInteger)row;
+/**
+ *  Decode the original once and cut all the tiles of the full size
+ *  level from it, saving them on the disk cache. Only one original is
+ *  decoded at a time, by all the tiled views, and the tiles drawn
+ *  meanwhile wait for it and then read their files
+ *
+ *  @param levelSize The size of the level, in pixels
+ *  @param column    The column of the tile that is needed
+ *  @param row       The row of the tile that is needed
+ *
+ *  @return The needed tile or nil if the original can't be read
+ */
+-(UIImage *)renderFullSizeTileForLevel:(CGSize)levelSize column:(NSInteger)column row:(NSInteger)row;
+/**
+ *  Crop a tile from the image of its level, and save it on the disk cache
+ *
+ *  @param levelRef  The level image
+ *  @param levelSize The size of the level, in pixels
+ *  @param column    The tile column
+ *  @param row       The tile row
+ *
+ *  @return The tile image or nil if it's outside of the level
+ */
+-(UIImage *)cutTileFromImage:(CGImageRef)levelRef level:(CGSize)levelSize column:(NSInteger)column row:(NSInteger)row;
+/**
+ *  Check if a level is as big as the original (or bigger)
+ *
+ *  @param levelSize The size of the level, in pixels
+ *
+ *  @return YES if the level needs the full size pixels
+ */
+-(BOOL)isFullSizeLevel:(CGSize)levelSize;
+/**
+ *  Get the image of a level smaller than the original, decoded
+ *  already downsampled (using the ImageIO thumbnail options)
+ *
+ *  @param levelSize The size of the level, in pixels
+ *
+ *  @return The level image or nil if the original can't be read
+ */
+-(UIImage *)imageForLevel:(CGSize)levelSize;
+/**
+ *  Get the name of a tile file
+ *
+ *  @param levelSize The size of the level, in pixels
+ *  @param column    The tile column
+ *  @param row       The tile row
+ *
+ *  @return The file name
+ */
+-(NSString *)tileNameForLevel:(CGSize)levelSize column:(NSInteger)column row:(NSInteger)row;
+/**
+ *  Get the directory of the disk cache
+ *
+ *  @return The path
+ */
++(NSString *)diskCachePath;
+/**
+ *  Remove the originals (and their tiles) used the longest time ago,
+ *  until the disk cache fits in its capacity
+ *
+ *  @param keptDirectory The directory of a media that is being shown, it's never removed
+ */
++(void)trimDiskCacheKeepingDirectory:(NSString *)keptDirectory;
+
+@end
+
+@implementation OlapicTiledImageView
+@synthesize media,maximumScale,tileSize,imageSize;
+/**
+ *  Use a CATiledLayer instead of a regular one
+ *
+ *  @return The layer class
+ */
++(Class)layerClass{
+    return [CATiledLayer class];
+}
+/**
+ *  Class constructor
+ *
+ *  @param frame The view frame (the same one of the image it's covering)
+ *  @param med   The media object
+ *
+ *  @return An instance of this object (OlapicTiledImageView)
+ */
+-(id)initWithFrame:(CGRect)frame andMedia:(OlapicMediaEntity *)med{
+    self = [super initWithFrame:frame];
+    if(self){
+        media = med;
+        maximumScale = 4.0;
+        tileSize = kTileSize;
+        imageSize = CGSizeZero;
+        boundsSize = frame.size;
+        self.backgroundColor = [UIColor clearColor];
+        self.opaque = NO;
+        self.userInteractionEnabled = NO;
+        source = NULL;
+        directory = [[OlapicTiledImageView diskCachePath] stringByAppendingPathComponent:[NSString stringWithFormat:@"%@",[media get:@"id"]]];
+        originalPath = [directory stringByAppendingPathComponent:@"original"];
+        // The levels handle the screen scale, so the tiles are on pixels
+        [super setContentScaleFactor:1.0];
+    }
+    return self;
+}
+/**
+ *  Download the original image (or take it from the disk cache) and
+ *  start showing the tiles
+ *
+ *  @param success A callback for when the view is ready
+ *  @param failure A callback for when the original can't be downloaded or read
+ */
+-(void)loadOriginalAndDo:(void (^)(OlapicTiledImageView *view))success onFailure:(void (^)(NSError *error))failure{
+    if([[NSFileManager defaultManager] fileExistsAtPath:originalPath] && [self prepareOriginal]){
+        // The media that was used last is the last one to be removed
+        [[NSFileManager defaultManager] setAttributes:@{NSFileModificationDate: [NSDate date]} ofItemAtPath:directory error:nil];
+        if(success) success(self);
+        return;
+    }
+    // A file that can't be read is downloaded again
+    [[NSFileManager defaultManager] removeItemAtPath:originalPath error:nil];
+    NSString *URL = [media getMediaURLForImageSize:OlapicMediaImageSizeOriginal];
+    if(!URL){
+        if(failure) failure([NSError errorWithDomain:@"OlapicTiledImageView" code:1 userInfo:@{NSLocalizedDescriptionKey: @"There's no URL for the original image"}]);
+        return;
+    }
+    // The original goes straight to the disk while it downloads, so it
+    // never has to fit in memory
+    [[OlapicFileDownloader sharedFileDownloader] downloadURL:URL toPath:originalPath onProgress:nil onSuccess:^(NSURL *fileURL){
+        [OlapicTiledImageView trimDiskCacheKeepingDirectory:directory];
+        if([self prepareOriginal]){
+            if(success) success(self);
+        }else if(failure){
+            failure([NSError errorWithDomain:@"OlapicTiledImageView" code:0 userInfo:@{NSLocalizedDescriptionKey: @"The original image couldn't be read"}]);
+        }
+    } onFailure:failure];
+}
+/**
+ *  Read the original size from the disk cache file, without decoding it,
+ *  and configure the tiled layer
+ *
+ *  @return If the file could be read
+ */
+-(BOOL)prepareOriginal{
+    CGImageSourceRef originalSource = CGImageSourceCreateWithURL((__bridge CFURLRef)[NSURL fileURLWithPath:originalPath], NULL);
+    if(!originalSource) return NO;
+    NSDictionary *properties = (__bridge_transfer NSDictionary *)CGImageSourceCopyPropertiesAtIndex(originalSource, 0, NULL);
+    CGFloat width = [[properties objectForKey:(NSString *)kCGImagePropertyPixelWidth] floatValue];
+    CGFloat height = [[properties objectForKey:(NSString *)kCGImagePropertyPixelHeight] floatValue];
+    if(width < 1 || height < 1){
+        CFRelease(originalSource);
+        return NO;
+    }
+    @synchronized(self){
+        if(source) CFRelease(source);
+        source = originalSource;
+        levelImage = nil;
+    }
+    imageSize = CGSizeMake(width, height);
+    // One level per power of two, up to the maximum zoom on the current screen
+    NSUInteger bias = (NSUInteger)ceil(log2(MAX(1.0, maximumScale * [UIScreen mainScreen].scale)));
+    CATiledLayer *tiledLayer = (CATiledLayer *)self.layer;
+    tiledLayer.tileSize = CGSizeMake(tileSize, tileSize);
+    tiledLayer.levelsOfDetailBias = bias;
+    tiledLayer.levelsOfDetail = bias + 1;
+    [self setNeedsDisplay];
+    return YES;
+}
+/**
+ *  Draw the tile for the given rect. CATiledLayer calls this method from
+ *  background threads, once per tile
+ *
+ *  @param rect The tile rect, on the view coordinates
+ */
+-(void)drawRect:(CGRect)rect{
+    if(imageSize.width < 1 || boundsSize.width < 1) return;
+    CGContextRef context = UIGraphicsGetCurrentContext();
+    CGFloat scale = CGContextGetCTM(context).a;
+    CGSize levelSize = CGSizeMake(ceil(boundsSize.width * scale), ceil(boundsSize.height * scale));
+    NSInteger column = (NSInteger)floor((rect.origin.x * scale) / tileSize);
+    NSInteger row = (NSInteger)floor((rect.origin.y * scale) / tileSize);
+    UIImage *tile = [self tileForLevel:levelSize column:column row:row];
+    if(!tile) return;
+    CGRect tileRect = CGRectMake((column * tileSize) / scale, (row * tileSize) / scale, tile.size.width / scale, tile.size.height / scale);
+    [tile drawInRect:tileRect];
+}
+/**
+ *  Get a tile, from the memory cache, from the disk cache or
+ *  rendering it from the level where it belongs
+ *
+ *  @param levelSize The size of the level, in pixels
+ *  @param column    The tile column
+ *  @param row       The tile row
+ *
+ *  @return The tile image or nil if it can't be rendered
+ */
+-(UIImage *)tileForLevel:(CGSize)levelSize column:(NSInteger)column row:(NSInteger)row{
+    NSString *name = [self tileNameForLevel:levelSize column:column row:row];
+    NSString *cacheKey = [NSString stringWithFormat:@"%@/%@",[media get:@"id"],name];
+    NSCache *cache = [OlapicTiledImageView tileCache];
+    UIImage *tile = [cache objectForKey:cacheKey];
+    if(tile) return tile;
+    tile = [UIImage imageWithContentsOfFile:[directory stringByAppendingPathComponent:name]];
+    if(!tile){
+        tile = [self renderTileForLevel:levelSize column:column row:row];
+    }
+    if(tile){
+        [cache setObject:tile forKey:cacheKey cost:(NSUInteger)(tile.size.width * tile.size.height * 4)];
+    }
+    return tile;
+}
+/**
+ *  Crop a single tile from its level and save it on the disk cache
+ *
+ *  @param levelSize The size of the level, in pixels
+ *  @param column    The tile column
+ *  @param row       The tile row
+ *
+ *  @return The tile image or nil if the level can't be read
+ */
+-(UIImage *)renderTileForLevel:(CGSize)levelSize column:(NSInteger)column row:(NSInteger)row{
+    if([self isFullSizeLevel:levelSize]){
+        return [self renderFullSizeTileForLevel:levelSize column:column row:row];
+    }
+    UIImage *level = [self imageForLevel:levelSize];
+    if(!level) return nil;
+    return [self cutTileFromImage:level.CGImage level:levelSize column:column row:row];
+}
+/**
+ *  Decode the original once and cut all the tiles of the full size
+ *  level from it, saving them on the disk cache. Only one original is
+ *  decoded at a time, by all the tiled views, and the tiles drawn
+ *  meanwhile wait for it and then read their files
+ *
+ *  @param levelSize The size of the level, in pixels
+ *  @param column    The column of the tile that is needed
+ *  @param row       The row of the tile that is needed
+ *
+ *  @return The needed tile or nil if the original can't be read
+ */
+-(UIImage *)renderFullSizeTileForLevel:(CGSize)levelSize column:(NSInteger)column row:(NSInteger)row{
+    @synchronized([OlapicTiledImageView class]){
+        // The level could have been cut while this tile was waiting
+        UIImage *tile = [UIImage imageWithContentsOfFile:[directory stringByAppendingPathComponent:[self tileNameForLevel:levelSize column:column row:row]]];
+        if(tile) return tile;
+        CGImageRef original = NULL;
+        @synchronized(self){
+            if(!source) return nil;
+            // The pixels are decoded here, once, and shared by all the crops
+            NSDictionary *options = @{(NSString *)kCGImageSourceShouldCache: @YES,
+                                      (NSString *)kCGImageSourceShouldCacheImmediately: @YES};
+            original = CGImageSourceCreateImageAtIndex(source, 0, (__bridge CFDictionaryRef)options);
+        }
+        if(!original) return nil;
+        NSInteger columns = (NSInteger)ceil(levelSize.width / tileSize);
+        NSInteger rows = (NSInteger)ceil(levelSize.height / tileSize);
+        for(NSInteger r = 0; r < rows; r++){
+            for(NSInteger c = 0; c < columns; c++){
+                @autoreleasepool{
+                    UIImage *cut = [self cutTileFromImage:original level:levelSize column:c row:r];
+                    if(c == column && r == row) tile = cut;
+                }
+            }
+        }
+        CGImageRelease(original);
+        return tile;
+    }
+}
+/**
+ *  Crop a tile from the image of its level, and save it on the disk cache
+ *
+ *  @param levelRef  The level image
+ *  @param levelSize The size of the level, in pixels
+ *  @param column    The tile column
+ *  @param row       The tile row
+ *
+ *  @return The tile image or nil if it's outside of the level
+ */
+-(UIImage *)cutTileFromImage:(CGImageRef)levelRef level:(CGSize)levelSize column:(NSInteger)column row:(NSInteger)row{
+    // The level image can be a little bit different from the level size,
+    // so the tile is cut proportionally
+    CGFloat ratioX = CGImageGetWidth(levelRef) / levelSize.width;
+    CGFloat ratioY = CGImageGetHeight(levelRef) / levelSize.height;
+    CGSize size = CGSizeMake(MIN(tileSize, levelSize.width - (column * tileSize)), MIN(tileSize, levelSize.height - (row * tileSize)));
+    if(size.width < 1 || size.height < 1) return nil;
+    CGRect sourceRect = CGRectMake(column * tileSize * ratioX, row * tileSize * ratioY, size.width * ratioX, size.height * ratioY);
+    CGImageRef cropped = CGImageCreateWithImageInRect(levelRef, sourceRect);
+    if(!cropped) return nil;
+    UIGraphicsBeginImageContextWithOptions(size, YES, 1.0);
+    [[UIImage imageWithCGImage:cropped] drawInRect:CGRectMake(0, 0, size.width, size.height)];
+    UIImage *tile = UIGraphicsGetImageFromCurrentImageContext();
+    UIGraphicsEndImageContext();
+    CGImageRelease(cropped);
+    NSString *path = [directory stringByAppendingPathComponent:[self tileNameForLevel:levelSize column:column row:row]];
+    [UIImageJPEGRepresentation(tile, kTileJPEGQuality) writeToFile:path atomically:YES];
+    return tile;
+}
+/**
+ *  Check if a level is as big as the original (or bigger)
+ *
+ *  @param levelSize The size of the level, in pixels
+ *
+ *  @return YES if the level needs the full size pixels
+ */
+-(BOOL)isFullSizeLevel:(CGSize)levelSize{
+    return levelSize.width >= imageSize.width || levelSize.height >= imageSize.height;
+}
+/**
+ *  Get the image of a level smaller than the original, decoded
+ *  already downsampled (using the ImageIO thumbnail options)
+ *
+ *  @param levelSize The size of the level, in pixels
+ *
+ *  @return The level image or nil if the original can't be read
+ */
+-(UIImage *)imageForLevel:(CGSize)levelSize{
+    // Several tiles of the same level are drawn at the same time
+    @synchronized(self){
+        if(levelImage && levelImageWidth == levelSize.width) return levelImage;
+        if(!source) return nil;
+        // Only one level is kept, the previous one is released before reading the new one
+        levelImage = nil;
+        NSDictionary *options = @{(NSString *)kCGImageSourceCreateThumbnailFromImageAlways: @YES,
+                                  (NSString *)kCGImageSourceThumbnailMaxPixelSize: @(MAX(levelSize.width, levelSize.height)),
+                                  (NSString *)kCGImageSourceShouldCache: @NO};
+        CGImageRef levelRef = CGImageSourceCreateThumbnailAtIndex(source, 0, (__bridge CFDictionaryRef)options);
+        if(!levelRef) return nil;
+        levelImage = [UIImage imageWithCGImage:levelRef];
+        levelImageWidth = levelSize.width;
+        CGImageRelease(levelRef);
+        return levelImage;
+    }
+}
+/**
+ *  Get the name of a tile file
+ *
+ *  @param levelSize The size of the level, in pixels
+ *  @param column    The tile column
+ *  @param row       The tile row
+ *
+ *  @return The file name
+ */
+-(NSString *)tileNameForLevel:(CGSize)levelSize column:(NSInteger)column row:(NSInteger)row{
+    return [NSString stringWithFormat:@"%ld_%ld_%ld.jpg",(long)levelSize.width,(long)column,(long)row];
+}
+/**
+ *  The cache for the decoded tiles, shared by all the tiled views
+ *
+ *  @return The cache
+ */
++(NSCache *)tileCache{
+    static NSCache *cache = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        cache = [[NSCache alloc] init];
+        [cache setName:@"OlapicTiledImageView"];
+        [cache setTotalCostLimit:kTileCacheCostLimit];
+    });
+    return cache;
+}
+/**
+ *  Get the directory of the disk cache
+ *
+ *  @return The path
+ */
++(NSString *)diskCachePath{
+    NSString *caches = [NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES) objectAtIndex:0];
+    return [caches stringByAppendingPathComponent:kTileDiskCacheDirectory];
+}
+/**
+ *  Remove all the originals and tiles from the disk cache
+ */
++(void)clearDiskCache{
+    [[OlapicTiledImageView tileCache] removeAllObjects];
+    [[NSFileManager defaultManager] removeItemAtPath:[OlapicTiledImageView diskCachePath] error:nil];
+}
+/**
+ *  Remove the originals (and their tiles) used the longest time ago,
+ *  until the disk cache fits in its capacity
+ *
+ *  @param keptDirectory The directory of a media that is being shown, it's never removed
+ */
++(void)trimDiskCacheKeepingDirectory:(NSString *)keptDirectory{
+    static dispatch_queue_t trimQueue = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        trimQueue = dispatch_queue_create("com.olapic.tiledimageview.trim", DISPATCH_QUEUE_SERIAL);
+    });
+    dispatch_async(trimQueue, ^{
+        NSFileManager *manager = [NSFileManager defaultManager];
+        NSString *cachePath = [OlapicTiledImageView diskCachePath];
+        NSArray *names = [manager contentsOfDirectoryAtPath:cachePath error:nil];
+        NSMutableArray *directories = [[NSMutableArray alloc] initWithCapacity:[names count]];
+        unsigned long long size = 0;
+        for(int i = 0; i < [names count]; i++){
+            NSString *path = [cachePath stringByAppendingPathComponent:[names objectAtIndex:i]];
+            NSDate *date = [[manager attributesOfItemAtPath:path error:nil] fileModificationDate];
+            // Each media directory holds its original and its tiles, they go together
+            unsigned long long directorySize = 0;
+            NSDirectoryEnumerator *enumerator = [manager enumeratorAtPath:path];
+            while([enumerator nextObject]){
+                directorySize += [[enumerator fileAttributes] fileSize];
+            }
+            size += directorySize;
+            [directories addObject:@{@"path": path,
+                                     @"size": @(directorySize),
+                                     @"date": date ? date : [NSDate distantPast]}];
+        }
+        if(size <= kTileDiskCacheCapacity) return;
+        [directories sortUsingComparator:^NSComparisonResult(NSDictionary *a, NSDictionary *b){
+            return [[a objectForKey:@"date"] compare:[b objectForKey:@"date"]];
+        }];
+        for(int i = 0; i < [directories count] && size > kTileDiskCacheCapacity; i++){
+            NSDictionary *media = [directories objectAtIndex:i];
+            if([[media objectForKey:@"path"] isEqualToString:keptDirectory]) continue;
+            // The views still showing it keep the original open, they only stop saving tiles
+            if([manager removeItemAtPath:[media objectForKey:@"path"] error:nil]){
+                size -= MIN(size, [[media objectForKey:@"size"] unsignedLongLongValue]);
+            }
+        }
+    });
+}
+#pragma mark - Default cycle
+/**
+ *  Overwrite the default UIView setFrame method in order
+ *  to save the bounds for the background drawing
+ *
+ *  @param frame The new size for the view
+ */
+-(void)setFrame:(CGRect)frame{
+    [super setFrame:frame];
+    boundsSize = self.bounds.size;
+}
+/**
+ *  Overwrite the default UIView layoutSubviews method in order
+ *  to save the bounds for the background drawing
+ */
+-(void)layoutSubviews{
+    [super layoutSubviews];
+    boundsSize = self.bounds.size;
+}
+/**
+ *  Close the original file
+ */
+-(void)dealloc{
+    if(source) CFRelease(source);
+}
+/**
+ *  The tiles are already on pixels, so the scale factor is
+ *  always 1 (the levels of detail take care of retina screens)
+ *
+ *  @param contentScaleFactor Ignored
+ */
+-(void)setContentScaleFactor:(CGFloat)contentScaleFactor{
+    [super setContentScaleFactor:1.0];
+}
+
+@end
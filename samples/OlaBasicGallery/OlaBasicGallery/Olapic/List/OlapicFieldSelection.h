@@ -0,0 +1,137 @@
+//
+//  OlapicFieldSelection.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <OlapicSDK/OlapicSDK.h>
+/**
+ *  A declared set of the fields a screen reads from the media, so the
+ *  API only has to send those.
+ *
+ *  The fields are the same paths used with `get:` (like `caption` or
+ *  `images.thumbnail`), and the embedded resources use the `_embedded`
+ *  prefix (like `_embedded.uploader`). The selection is sent as query
+ *  parameters, either on every request of a list (using its
+ *  extraParameters) or on a single handler request.
+ *
+ *  Example:
+ *  ```
+ *  OlapicFieldSelection *fields = [OlapicFieldSelection selectionWithPaths:@[@"id", @"images.square", @"images.thumbnail", @"original_image_width", @"original_image_height"]];
+ *  [fields applyToList:list];
+ *  ```
+ *
+ *  If the API ignores the parameters, the responses are the complete ones,
+ *  and projectedEntity: can still create copies without what the screen
+ *  doesn't need, so the entities kept in memory are smaller.
+ */
+@interface OlapicFieldSelection : NSObject{
+    /**
+     *  The selected paths
+     */
+    NSArray *paths;
+}
+
+@property (nonatomic,strong,readonly) NSArray *paths;
+/**
+ *  Create a selection
+ *
+ *  @param selectedPaths An array with the paths, like the ones used with `get:`
+ *
+ *  @return The selection object
+ */
++(instancetype)selectionWithPaths:(NSArray *)selectedPaths;
+/**
+ *  Class constructor
+ *
+ *  @param selectedPaths An array with the paths, like the ones used with `get:`
+ *
+ *  @return An instance of this object (OlapicFieldSelection)
+ */
+-(id)initWithPaths:(NSArray *)selectedPaths;
+/**
+ *  Get the names of the fields to request (the first part of each path,
+ *  without the embedded resources)
+ *
+ *  @return An array of strings, sorted
+ */
+-(NSArray *)fields;
+/**
+ *  Get the names of the embedded resources to request
+ *
+ *  @return An array of strings, sorted
+ */
+-(NSArray *)embeddedResources;
+/**
+ *  Get the query parameters for the selection
+ *
+ *  @return A dictionary with the parameters
+ */
+-(NSDictionary *)parameters;
+/**
+ *  Add the selection to other query parameters (for the handlers
+ *  methods that receive parameters)
+ *
+ *  @param parameters The original parameters, it can be nil
+ *
+ *  @return A new dictionary with all the parameters
+ */
+-(NSDictionary *)parametersMergedWith:(NSDictionary *)parameters;
+/**
+ *  Send the selection on every request of a list
+ *
+ *  @param list The media list
+ */
+-(void)applyToList:(OlapicMediaList *)list;
+/**
+ *  Stop sending the selection on the requests of a list
+ *
+ *  @param list The media list
+ */
+-(void)removeFromList:(OlapicMediaList *)list;
+/**
+ *  Get a copy of a response with only the selected paths (and the links)
+ *
+ *  @param data The response data
+ *
+ *  @return The projected data
+ */
+-(NSMutableDictionary *)projectData:(NSDictionary *)data;
+/**
+ *  Create a new entity with only the selected data (the original entity
+ *  isn't modified)
+ *
+ *  @param entity The entity
+ *
+ *  @return A new entity of the same class, with the projected data
+ */
+-(id)projectedEntity:(OlapicEntity *)entity;
+
+@end
@@ -0,0 +1,219 @@
+//
+//  OlapicFieldSelection.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+// The query parameter with the fields
+#define kFieldSelectionFieldsParameter @"fields"
+// The query parameter with the embedded resources
+#define kFieldSelectionEmbedParameter @"embed"
+// The key for the embedded resources on the responses
+#define kFieldSelectionEmbeddedKey @"_embedded"
+// The key for the links, they are always kept because the SDK uses them
+#define kFieldSelectionLinksKey @"_links"
+
+#import "OlapicFieldSelection.h"
+
+@interface OlapicFieldSelection()
+/**
+ *  Copy a path from a dictionary to another one
+ *
+ *  @param components The path components
+ *  @param source     The original dictionary
+ *  @param target     The dictionary with the projection
+ */
+-(void)copyPath:(NSArray *)components from:(NSDictionary *)source to:(NSMutableDictionary *)target;
+
+@end
+
+@implementation OlapicFieldSelection
+@synthesize paths;
+/**
+ *  Create a selection
+ *
+ *  @param selectedPaths An array with the paths, like the ones used with `get:`
+ *
+ *  @return The selection object
+ */
++(instancetype)selectionWithPaths:(NSArray *)selectedPaths{
+    return [[self alloc] initWithPaths:selectedPaths];
+}
+/**
+ *  Class constructor
+ *
+ *  @param selectedPaths An array with the paths, like the ones used with `get:`
+ *
+ *  @return An instance of this object (OlapicFieldSelection)
+ */
+-(id)initWithPaths:(NSArray *)selectedPaths{
+    self = [super init];
+    if(self){
+        paths = selectedPaths ? [selectedPaths copy] : @[];
+    }
+    return self;
+}
+/**
+ *  Get the names of the fields to request (the first part of each path,
+ *  without the embedded resources)
+ *
+ *  @return An array of strings, sorted
+ */
+-(NSArray *)fields{
+    NSMutableSet *fields = [[NSMutableSet alloc] init];
+    for(int i = 0; i < [paths count]; i++){
+        NSString *field = [[[paths objectAtIndex:i] componentsSeparatedByString:@"."] objectAtIndex:0];
+        if(![field isEqualToString:kFieldSelectionEmbeddedKey]) [fields addObject:field];
+    }
+    return [[fields allObjects] sortedArrayUsingSelector:@selector(compare:)];
+}
+/**
+ *  Get the names of the embedded resources to request
+ *
+ *  @return An array of strings, sorted
+ */
+-(NSArray *)embeddedResources{
+    NSMutableSet *resources = [[NSMutableSet alloc] init];
+    for(int i = 0; i < [paths count]; i++){
+        NSArray *components = [[paths objectAtIndex:i] componentsSeparatedByString:@"."];
+        if([components count] > 1 && [[components objectAtIndex:0] isEqualToString:kFieldSelectionEmbeddedKey]){
+            [resources addObject:[components objectAtIndex:1]];
+        }
+    }
+    return [[resources allObjects] sortedArrayUsingSelector:@selector(compare:)];
+}
+/**
+ *  Get the query parameters for the selection
+ *
+ *  @return A dictionary with the parameters
+ */
+-(NSDictionary *)parameters{
+    NSMutableDictionary *parameters = [[NSMutableDictionary alloc] init];
+    NSArray *fields = [self fields];
+    NSArray *resources = [self embeddedResources];
+    if([fields count] > 0) [parameters setObject:[fields componentsJoinedByString:@","] forKey:kFieldSelectionFieldsParameter];
+    // The embedded resources are only requested when they are selected, an
+    // empty value could be read as a different request
+    if([resources count] > 0) [parameters setObject:[resources componentsJoinedByString:@","] forKey:kFieldSelectionEmbedParameter];
+    return parameters;
+}
+/**
+ *  Add the selection to other query parameters (for the handlers
+ *  methods that receive parameters)
+ *
+ *  @param parameters The original parameters, it can be nil
+ *
+ *  @return A new dictionary with all the parameters
+ */
+-(NSDictionary *)parametersMergedWith:(NSDictionary *)parameters{
+    NSMutableDictionary *merged = parameters ? [parameters mutableCopy] : [[NSMutableDictionary alloc] init];
+    [merged addEntriesFromDictionary:[self parameters]];
+    return merged;
+}
+/**
+ *  Send the selection on every request of a list
+ *
+ *  @param list The media list
+ */
+-(void)applyToList:(OlapicMediaList *)list{
+    if(!list.extraParameters) list.extraParameters = [[NSMutableDictionary alloc] init];
+    [list.extraParameters addEntriesFromDictionary:[self parameters]];
+}
+/**
+ *  Stop sending the selection on the requests of a list
+ *
+ *  @param list The media list
+ */
+-(void)removeFromList:(OlapicMediaList *)list{
+    [list.extraParameters removeObjectsForKeys:@[kFieldSelectionFieldsParameter, kFieldSelectionEmbedParameter]];
+}
+/**
+ *  Get a copy of a response with only the selected paths (and the links)
+ *
+ *  @param data The response data
+ *
+ *  @return The projected data
+ */
+-(NSMutableDictionary *)projectData:(NSDictionary *)data{
+    NSMutableDictionary *projected = [[NSMutableDictionary alloc] init];
+    if(![data isKindOfClass:[NSDictionary class]]) return projected;
+    id links = [data objectForKey:kFieldSelectionLinksKey];
+    if(links) [projected setObject:links forKey:kFieldSelectionLinksKey];
+    // The longest paths go first, so a complete value selected with a
+    // shorter path (like `images` and `images.square`) is the one that stays
+    NSArray *sortedPaths = [paths sortedArrayUsingComparator:^NSComparisonResult(NSString *path1, NSString *path2){
+        NSUInteger length1 = [[path1 componentsSeparatedByString:@"."] count];
+        NSUInteger length2 = [[path2 componentsSeparatedByString:@"."] count];
+        if(length1 == length2) return NSOrderedSame;
+        return length1 > length2 ? NSOrderedAscending : NSOrderedDescending;
+    }];
+    for(int i = 0; i < [sortedPaths count]; i++){
+        [self copyPath:[[sortedPaths objectAtIndex:i] componentsSeparatedByString:@"."] from:data to:projected];
+    }
+    return projected;
+}
+/**
+ *  Create a new entity with only the selected data. The original entity
+ *  isn't modified, because its data can be shared with the list pages
+ *  or not be mutable at all
+ *
+ *  @param entity The entity
+ *
+ *  @return A new entity of the same class, with the projected data
+ */
+-(id)projectedEntity:(OlapicEntity *)entity{
+    if(!entity) return nil;
+    return [[[entity class] alloc] initWithData:[self projectData:entity.data]];
+}
+/**
+ *  Copy a path from a dictionary to another one
+ *
+ *  @param components The path components
+ *  @param source     The original dictionary
+ *  @param target     The dictionary with the projection
+ */
+-(void)copyPath:(NSArray *)components from:(NSDictionary *)source to:(NSMutableDictionary *)target{
+    if([components count] == 0 || ![source isKindOfClass:[NSDictionary class]]) return;
+    NSString *key = [components objectAtIndex:0];
+    id value = [source objectForKey:key];
+    if(!value) return;
+    if([components count] == 1 || ![value isKindOfClass:[NSDictionary class]]){
+        // The last part of the path (or a value that can't be walked) is copied complete
+        [target setObject:value forKey:key];
+        return;
+    }
+    NSMutableDictionary *child = [target objectForKey:key];
+    if(![child isKindOfClass:[NSMutableDictionary class]]){
+        child = [[NSMutableDictionary alloc] init];
+        [target setObject:child forKey:key];
+    }
+    [self copyPath:[components subarrayWithRange:NSMakeRange(1, [components count] - 1)] from:value to:child];
+}
+
+@end
@@ -0,0 +1,109 @@
+//
+//  OlapicMediaListDiff.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+
+@class OlapicMediaEntity;
+/**
+ *  The changes between two versions of a media list, using the
+ *  media ID as key. It's calculated in O(n log n) and it can be
+ *  applied as a batch update on a UI:
+ *
+ *  - deletes: indexes on the previous contents
+ *  - inserts: indexes on the new contents
+ *  - moves:   pairs of indexes (previous => new) for the media that changed
+ *             position; the fewest moves that explain the new order
+ *  - updates: indexes on the new contents for the media whose data changed
+ */
+@interface OlapicMediaListDiff : NSObject{
+    /**
+     *  The indexes (on the previous contents) of the removed media
+     */
+    NSIndexSet *deletes;
+    /**
+     *  The indexes (on the new contents) of the added media
+     */
+    NSIndexSet *inserts;
+    /**
+     *  A list of moves, each one is an array with two numbers:
+     *  the previous index and the new index
+     */
+    NSArray *moves;
+    /**
+     *  The indexes (on the new contents) of the media that is on both
+     *  versions, but its data changed
+     */
+    NSIndexSet *updates;
+    /**
+     *  For every index on the new contents, the index on the previous
+     *  contents (or NSNotFound if it was inserted)
+     */
+    NSArray *previousIndexes;
+}
+
+@property (nonatomic,strong,readonly) NSIndexSet *deletes;
+@property (nonatomic,strong,readonly) NSIndexSet *inserts;
+@property (nonatomic,strong,readonly) NSArray *moves;
+@property (nonatomic,strong,readonly) NSIndexSet *updates;
+/**
+ *  Calculate the changes between two arrays of media objects
+ *
+ *  @param previous The previous contents (OlapicMediaEntity objects)
+ *  @param current  The new contents (OlapicMediaEntity objects)
+ *
+ *  @return An instance of this object (OlapicMediaListDiff)
+ */
++(instancetype)diffFromMedia:(NSArray *)previous toMedia:(NSArray *)current;
+/**
+ *  Get the index on the previous contents for an index on the new contents
+ *
+ *  @param index The index on the new contents
+ *
+ *  @return The previous index or NSNotFound if the media was inserted
+ */
+-(NSUInteger)previousIndexForIndex:(NSUInteger)index;
+/**
+ *  Check if there's something to apply
+ *
+ *  @return If there's at least one insert, delete, move or update
+ */
+-(BOOL)hasChanges;
+/**
+ *  Get a media ID as a string, no matter if the API sent a number
+ *
+ *  @param media The media object
+ *
+ *  @return The media ID
+ */
++(NSString *)keyForMedia:(OlapicMediaEntity *)media;
+
+@end
@@ -0,0 +1,208 @@
+//
+//  OlapicMediaListDiff.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "OlapicMediaListDiff.h"
+#import <OlapicSDK/OlapicSDK.h>
+
+@interface OlapicMediaListDiff()
+/**
+ *  Find the longest increasing subsequence of a list of indexes, in
+ *  O(n log n), ignoring the NSNotFound values
+ *
+ *  @param indexes An array of NSNumber objects
+ *
+ *  @return A C array (that needs to be freed) with a flag for every
+ *  position of the list, set if it belongs to the subsequence
+ */
++(BOOL *)longestIncreasingSubsequenceOf:(NSArray *)indexes;
+
+@end
+
+@implementation OlapicMediaListDiff
+@synthesize deletes,inserts,moves,updates;
+/**
+ *  Calculate the changes between two arrays of media objects
+ *
+ *  @param previous The previous contents (OlapicMediaEntity objects)
+ *  @param current  The new contents (OlapicMediaEntity objects)
+ *
+ *  @return An instance of this object (OlapicMediaListDiff)
+ */
++(instancetype)diffFromMedia:(NSArray *)previous toMedia:(NSArray *)current{
+    OlapicMediaListDiff *diff = [[OlapicMediaListDiff alloc] init];
+    NSUInteger previousCount = [previous count];
+    NSUInteger currentCount = [current count];
+    // Index the previous contents by key
+    NSMutableDictionary *previousByKey = [[NSMutableDictionary alloc] initWithCapacity:previousCount];
+    for(NSUInteger i = 0; i < previousCount; i++){
+        NSString *key = [OlapicMediaListDiff keyForMedia:[previous objectAtIndex:i]];
+        // In case of duplicated keys, the first one wins
+        if(![previousByKey objectForKey:key]){
+            [previousByKey setObject:@(i) forKey:key];
+        }
+    }
+    // Match the new contents against the previous ones
+    NSMutableArray *matches = [[NSMutableArray alloc] initWithCapacity:currentCount];
+    BOOL *matchedPrevious = calloc(previousCount + 1, sizeof(BOOL));
+    NSMutableIndexSet *newInserts = [[NSMutableIndexSet alloc] init];
+    for(NSUInteger i = 0; i < currentCount; i++){
+        NSNumber *previousIndex = [previousByKey objectForKey:[OlapicMediaListDiff keyForMedia:[current objectAtIndex:i]]];
+        if(previousIndex && !matchedPrevious[[previousIndex unsignedIntegerValue]]){
+            matchedPrevious[[previousIndex unsignedIntegerValue]] = YES;
+            [matches addObject:previousIndex];
+        }else{
+            [newInserts addIndex:i];
+            [matches addObject:@(NSNotFound)];
+        }
+    }
+    NSMutableIndexSet *newDeletes = [[NSMutableIndexSet alloc] init];
+    for(NSUInteger i = 0; i < previousCount; i++){
+        if(!matchedPrevious[i]){
+            [newDeletes addIndex:i];
+        }
+    }
+    free(matchedPrevious);
+    // The media that stays in place is the longest increasing subsequence
+    // of the previous indexes (in the new order), so only the rest has to
+    // be reported as moved. E.g. [A,B,C] => [C,A,B] keeps A and B and
+    // moves C
+    BOOL *stays = [OlapicMediaListDiff longestIncreasingSubsequenceOf:matches];
+    NSMutableArray *newMoves = [[NSMutableArray alloc] init];
+    NSMutableIndexSet *newUpdates = [[NSMutableIndexSet alloc] init];
+    for(NSUInteger i = 0; i < currentCount; i++){
+        NSUInteger previousIndex = [[matches objectAtIndex:i] unsignedIntegerValue];
+        if(previousIndex == NSNotFound) continue;
+        if(!stays[i]){
+            [newMoves addObject:@[@(previousIndex), @(i)]];
+        }
+        OlapicMediaEntity *before = [previous objectAtIndex:previousIndex];
+        OlapicMediaEntity *after = [current objectAtIndex:i];
+        if(before != after && ![[before data] isEqualToDictionary:[after data]]){
+            [newUpdates addIndex:i];
+        }
+    }
+    free(stays);
+    diff->deletes = newDeletes;
+    diff->inserts = newInserts;
+    diff->moves = newMoves;
+    diff->updates = newUpdates;
+    diff->previousIndexes = matches;
+    return diff;
+}
+/**
+ *  Find the longest increasing subsequence of a list of indexes, in
+ *  O(n log n), ignoring the NSNotFound values
+ *
+ *  @param indexes An array of NSNumber objects
+ *
+ *  @return A C array (that needs to be freed) with a flag for every
+ *  position of the list, set if it belongs to the subsequence
+ */
++(BOOL *)longestIncreasingSubsequenceOf:(NSArray *)indexes{
+    NSUInteger count = [indexes count];
+    BOOL *result = calloc(count + 1, sizeof(BOOL));
+    // tails[k]: the position of the smallest value that ends a subsequence of length k + 1
+    NSUInteger *tails = calloc(count + 1, sizeof(NSUInteger));
+    // previous[i]: the position before i on the best subsequence that ends at i
+    NSUInteger *previous = calloc(count + 1, sizeof(NSUInteger));
+    NSUInteger *values = calloc(count + 1, sizeof(NSUInteger));
+    NSUInteger length = 0;
+    for(NSUInteger i = 0; i < count; i++){
+        values[i] = [[indexes objectAtIndex:i] unsignedIntegerValue];
+        if(values[i] == NSNotFound) continue;
+        NSUInteger low = 0;
+        NSUInteger high = length;
+        while(low < high){
+            NSUInteger middle = (low + high) / 2;
+            if(values[tails[middle]] < values[i]){
+                low = middle + 1;
+            }else{
+                high = middle;
+            }
+        }
+        previous[i] = (low > 0) ? tails[low - 1] : NSNotFound;
+        tails[low] = i;
+        if(low == length){
+            length++;
+        }
+    }
+    if(length > 0){
+        NSUInteger position = tails[length - 1];
+        while(position != NSNotFound){
+            result[position] = YES;
+            position = previous[position];
+        }
+    }
+    free(tails);
+    free(previous);
+    free(values);
+    return result;
+}
+/**
+ *  Get the index on the previous contents for an index on the new contents
+ *
+ *  @param index The index on the new contents
+ *
+ *  @return The previous index or NSNotFound if the media was inserted
+ */
+-(NSUInteger)previousIndexForIndex:(NSUInteger)index{
+    if(index >= [previousIndexes count]) return NSNotFound;
+    return [[previousIndexes objectAtIndex:index] unsignedIntegerValue];
+}
+/**
+ *  Check if there's something to apply
+ *
+ *  @return If there's at least one insert, delete, move or update
+ */
+-(BOOL)hasChanges{
+    return [inserts count] > 0 || [deletes count] > 0 || [moves count] > 0 || [updates count] > 0;
+}
+/**
+ *  Get a media ID as a string, no matter if the API sent a number
+ *
+ *  @param media The media object
+ *
+ *  @return The media ID
+ */
++(NSString *)keyForMedia:(OlapicMediaEntity *)media{
+    return [NSString stringWithFormat:@"%@",[media get:@"id"]];
+}
+/**
+ *  A readable version of the changes, for debugging
+ *
+ *  @return The description
+ */
+-(NSString *)description{
+    return [NSString stringWithFormat:@"<%@: %lu inserts, %lu deletes, %lu moves, %lu updates>",NSStringFromClass([self class]),(unsigned long)[inserts count],(unsigned long)[deletes count],(unsigned long)[moves count],(unsigned long)[updates count]];
+}
+
+@end
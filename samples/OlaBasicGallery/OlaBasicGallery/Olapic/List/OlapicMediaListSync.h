@@ -0,0 +1,189 @@
+//
+//  OlapicMediaListSync.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <OlapicSDK/OlapicMediaList.h>
+#import "OlapicMediaListDiff.h"
+
+@protocol OlapicMediaListSyncDelegate;
+/**
+ *  Keeps a media list up to date without reloading whole pages.
+ *  Every time it runs, it asks the API for a small head page of the
+ *  list, walks it until it finds the newest media it already has and
+ *  merges only the new ones at the head of the list first page.
+ *  When nothing changes, the polling interval grows (backoff) until it
+ *  reaches the maximum interval; as soon as new media arrives it goes
+ *  back to the base interval.
+ *  Every change on the list contents is also reported as a diff, so
+ *  the UI can apply a batch update instead of a full reload.
+ *
+ *  @warning The list has to use OlapicMediaListSortingTypeRecent, otherwise
+ *  the 'newest media' can't be detected and the new media would be merged
+ *  at the wrong positions, so the constructor refuses the other sortings.
+ */
+@interface OlapicMediaListSync : NSObject{
+    /**
+     *  The list that will be kept up to date
+     */
+    OlapicMediaList *list;
+    /**
+     *  A delegate object for the OlapicMediaListSyncDelegate methods
+     */
+    id <OlapicMediaListSyncDelegate>__weak delegate;
+    /**
+     *  The base polling interval (in seconds)
+     */
+    NSTimeInterval interval;
+    /**
+     *  The limit for the polling interval when the backoff is applied
+     */
+    NSTimeInterval maximumInterval;
+    /**
+     *  How much the interval grows every time a sync doesn't find new media
+     */
+    float backoffMultiplier;
+    /**
+     *  How many media objects it will ask for on every head request
+     */
+    NSInteger headCount;
+    /**
+     *  The limit of head pages it will follow on a single sync, in case
+     *  the list is too far behind
+     */
+    NSInteger maximumHeadPages;
+    /**
+     *  The interval that will be used for the next sync
+     */
+    NSTimeInterval currentInterval;
+    /**
+     *  The timer for the next sync. It's a dispatch timer that only keeps
+     *  a weak reference to this object, so releasing the sync stops it
+     */
+    dispatch_source_t timer;
+    /**
+     *  A flag to know if there's a sync request going on
+     */
+    BOOL syncing;
+    /**
+     *  A flag to know if the object should keep polling the API
+     */
+    BOOL polling;
+}
+
+@property (nonatomic,strong) OlapicMediaList *list;
+@property (nonatomic,weak) id <OlapicMediaListSyncDelegate>__weak delegate;
+@property (nonatomic) NSTimeInterval interval;
+@property (nonatomic) NSTimeInterval maximumInterval;
+@property (nonatomic) float backoffMultiplier;
+@property (nonatomic) NSInteger headCount;
+@property (nonatomic) NSInteger maximumHeadPages;
+@property (nonatomic,readonly) NSTimeInterval currentInterval;
+/**
+ *  Class constructor
+ *
+ *  @param mlist          The list to keep up to date
+ *  @param delegateObject An object implementing the OlapicMediaListSyncDelegate protocol
+ *
+ *  @return An instance of this object (OlapicMediaListSync), or nil if the list isn't sorted by recent
+ */
+-(id)initWithList:(OlapicMediaList *)mlist delegate:(id<OlapicMediaListSyncDelegate>)delegateObject;
+/**
+ *  Start polling the API using the current interval
+ */
+-(void)start;
+/**
+ *  Stop polling the API. A request that is already running still
+ *  finishes, but no other sync is scheduled
+ */
+-(void)stop;
+/**
+ *  Check if the object is polling the API
+ *
+ *  @return If the object was started and not stopped
+ */
+-(BOOL)running;
+/**
+ *  Run a sync right now, without waiting for the timer
+ */
+-(void)syncNow;
+/**
+ *  Get all the media on the list pages, in order
+ *
+ *  @return An array of OlapicMediaEntity objects
+ */
+-(NSArray *)allMedia;
+/**
+ *  Get the ID of the newest media the list has
+ *
+ *  @return The media ID or nil if the list is empty
+ */
+-(NSString *)newestMediaID;
+/**
+ *  Read an URL from an API link, which can be the URL itself or
+ *  a dictionary with an href key
+ *
+ *  @param link The API link
+ *
+ *  @return The URL or nil
+ */
++(NSString *)URLFromLink:(id)link;
+
+@end
+/**
+ *  The protocol to listen for the sync events
+ */
+@protocol OlapicMediaListSyncDelegate <NSObject>
+@optional
+/**
+ *  The sync found new media and merged it at the head of the list
+ *
+ *  @param sync  The sync object
+ *  @param media The new media objects, the newest first
+ */
+-(void)mediaListSync:(OlapicMediaListSync *)sync didLoadNewMedia:(NSArray *)media;
+/**
+ *  The list contents changed because new media was merged at the head
+ *
+ *  @param sync  The sync object
+ *  @param media All the media on the list, after the change
+ *  @param diff  The changes between the previous contents and the new ones
+ */
+-(void)mediaListSync:(OlapicMediaListSync *)sync didChangeMedia:(NSArray *)media withDiff:(OlapicMediaListDiff *)diff;
+/**
+ *  The sync request failed. The sync will try again after the
+ *  backoff interval
+ *
+ *  @param sync  The sync object
+ *  @param error The error it found
+ */
+-(void)mediaListSync:(OlapicMediaListSync *)sync didReceiveAnError:(NSError *)error;
+@end
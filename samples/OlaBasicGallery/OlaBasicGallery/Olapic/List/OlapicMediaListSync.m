@@ -0,0 +1,343 @@
+//
+//  OlapicMediaListSync.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "OlapicMediaListSync.h"
+#import <OlapicSDK/OlapicSDK.h>
+#import "OlapicEntityIdentityMap.h"
+#import "OlapicAPIClient.h"
+
+@interface OlapicMediaListSync()
+/**
+ *  The timer action: run the sync
+ */
+-(void)timerFired;
+/**
+ *  Schedule the next sync using the current interval
+ */
+-(void)scheduleNextSync;
+/**
+ *  Cancel the timer for the next sync, if there's one
+ */
+-(void)cancelTimer;
+/**
+ *  Request a head page and walk it until the newest known media is found.
+ *  If the entire page is new, it follows the 'next' link
+ *
+ *  @param URL       The API URL for the head page
+ *  @param page      How many head pages were already requested on this sync
+ *  @param newestID  The ID of the newest media on the list
+ *  @param collected The new media found so far
+ */
+-(void)fetchHead:(NSString *)URL page:(NSInteger)page newestID:(NSString *)newestID collected:(NSMutableArray *)collected;
+/**
+ *  Merge the new media at the head of the list, inform the delegate
+ *  and update the interval
+ *
+ *  @param media The new media objects
+ */
+-(void)finishWithMedia:(NSArray *)media;
+/**
+ *  Apply the backoff and inform the delegate about the error
+ *
+ *  @param error The error from the API
+ */
+-(void)finishWithError:(NSError *)error;
+/**
+ *  Replace the media of the first page and report the changes
+ *
+ *  @param media The new media for the first page
+ */
+-(void)replaceFirstPageMedia:(NSArray *)media;
+
+@end
+
+@implementation OlapicMediaListSync
+@synthesize list,delegate,interval,maximumInterval,backoffMultiplier,headCount,maximumHeadPages,currentInterval;
+/**
+ *  Class constructor
+ *
+ *  @param mlist          The list to keep up to date
+ *  @param delegateObject An object implementing the OlapicMediaListSyncDelegate protocol
+ *
+ *  @return An instance of this object (OlapicMediaListSync), or nil if the list isn't sorted by recent
+ */
+-(id)initWithList:(OlapicMediaList *)mlist delegate:(id<OlapicMediaListSyncDelegate>)delegateObject{
+    // The head of the other sortings isn't where the new media goes
+    if([mlist sorting] != OlapicMediaListSortingTypeRecent) return nil;
+    self = [super init];
+    if(self){
+        list = mlist;
+        delegate = delegateObject;
+        interval = 15.0;
+        maximumInterval = 240.0;
+        backoffMultiplier = 2.0;
+        headCount = 8;
+        maximumHeadPages = 5;
+        currentInterval = interval;
+        syncing = NO;
+        polling = NO;
+    }
+    return self;
+}
+/**
+ *  Start polling the API using the current interval
+ */
+-(void)start{
+    polling = YES;
+    currentInterval = interval;
+    [self scheduleNextSync];
+}
+/**
+ *  Stop polling the API. A request that is already running still
+ *  finishes, but no other sync is scheduled
+ */
+-(void)stop{
+    polling = NO;
+    [self cancelTimer];
+}
+/**
+ *  Check if the object is polling the API
+ *
+ *  @return If the object was started and not stopped
+ */
+-(BOOL)running{
+    return polling;
+}
+/**
+ *  The timer action: run the sync
+ */
+-(void)timerFired{
+    [self cancelTimer];
+    [self syncNow];
+    // If the sync couldn't start (the list is busy or empty), try again later
+    if(!syncing && polling){
+        [self scheduleNextSync];
+    }
+}
+/**
+ *  Schedule the next sync using the current interval
+ */
+-(void)scheduleNextSync{
+    [self cancelTimer];
+    // The handler only holds the sync weakly, so a sync nobody else
+    // keeps is released and its timer cancelled on dealloc
+    __weak OlapicMediaListSync *weakSelf = self;
+    timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, dispatch_get_main_queue());
+    dispatch_source_set_timer(timer, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(currentInterval * NSEC_PER_SEC)), DISPATCH_TIME_FOREVER, (uint64_t)(0.1 * currentInterval * NSEC_PER_SEC));
+    dispatch_source_set_event_handler(timer, ^{
+        [weakSelf timerFired];
+    });
+    dispatch_resume(timer);
+}
+/**
+ *  Cancel the timer for the next sync, if there's one
+ */
+-(void)cancelTimer{
+    if(timer){
+        dispatch_source_cancel(timer);
+        timer = nil;
+    }
+}
+/**
+ *  Run a sync right now, without waiting for the timer
+ */
+-(void)syncNow{
+    if(syncing || [list fetching] || ![list initialURL]) return;
+    NSString *newestID = [self newestMediaID];
+    // The list didn't load its first page yet, there's nothing to compare against
+    if(!newestID) return;
+    syncing = YES;
+    [self fetchHead:[list initialURL] page:0 newestID:newestID collected:[[NSMutableArray alloc] init]];
+}
+/**
+ *  Get the ID of the newest media the list has
+ *
+ *  @return The media ID or nil if the list is empty
+ */
+-(NSString *)newestMediaID{
+    if([[list pages] count] == 0) return nil;
+    NSArray *media = [[[list pages] objectAtIndex:0] valueForKey:@"media"];
+    if([media count] == 0) return nil;
+    return [OlapicMediaListDiff keyForMedia:[media objectAtIndex:0]];
+}
+/**
+ *  Request a head page and walk it until the newest known media is found.
+ *  If the entire page is new, it follows the 'next' link
+ *
+ *  @param URL       The API URL for the head page
+ *  @param page      How many head pages were already requested on this sync
+ *  @param newestID  The ID of the newest media on the list
+ *  @param collected The new media found so far
+ */
+-(void)fetchHead:(NSString *)URL page:(NSInteger)page newestID:(NSString *)newestID collected:(NSMutableArray *)collected{
+    NSMutableDictionary *parameters = [[NSMutableDictionary alloc] initWithDictionary:[list extraParameters]];
+    if(page == 0){
+        [parameters setValue:[NSString stringWithFormat:@"%ld",(long)headCount] forKey:@"count"];
+    }
+    [[OlapicAPIClient sharedClient] getMediaFromURL:URL parameters:parameters priority:OlapicRequestPriorityLow onSuccess:^(NSDictionary *response){
+        NSArray *media = [response valueForKey:@"media"];
+        BOOL reached = NO;
+        for(int i = 0; i < [media count]; i++){
+            OlapicMediaEntity *item = [media objectAtIndex:i];
+            if([[OlapicMediaListDiff keyForMedia:item] isEqualToString:newestID]){
+                reached = YES;
+                break;
+            }
+            [collected addObject:item];
+        }
+        NSString *next = [OlapicMediaListSync URLFromLink:[[response valueForKey:@"links"] valueForKey:@"next"]];
+        if(!reached && next && [media count] > 0 && (page + 1) < maximumHeadPages){
+            [self fetchHead:next page:(page + 1) newestID:newestID collected:collected];
+            return;
+        }
+        [self finishWithMedia:collected];
+    } onFailure:^(NSError *error){
+        [self finishWithError:error];
+    }];
+}
+/**
+ *  Merge the new media at the head of the list, inform the delegate
+ *  and update the interval
+ *
+ *  @param media The new media objects
+ */
+-(void)finishWithMedia:(NSArray *)media{
+    syncing = NO;
+    NSMutableArray *pages = [list pages];
+    // Only take the media the list doesn't already have, in case the
+    // head walk stopped before finding the newest media
+    NSMutableSet *known = [[NSMutableSet alloc] init];
+    for(int p = 0; p < [pages count]; p++){
+        NSArray *pageMedia = [[pages objectAtIndex:p] valueForKey:@"media"];
+        for(int i = 0; i < [pageMedia count]; i++){
+            [known addObject:[OlapicMediaListDiff keyForMedia:[pageMedia objectAtIndex:i]]];
+        }
+    }
+    NSMutableArray *fresh = [[NSMutableArray alloc] init];
+    for(int i = 0; i < [media count]; i++){
+        NSString *mediaID = [OlapicMediaListDiff keyForMedia:[media objectAtIndex:i]];
+        if(![known containsObject:mediaID]){
+            [known addObject:mediaID];
+            [fresh addObject:[media objectAtIndex:i]];
+        }
+    }
+    if([fresh count] > 0 && [pages count] > 0){
+        NSMutableArray *firstMedia = [[NSMutableArray alloc] initWithArray:fresh];
+        [firstMedia addObjectsFromArray:[[pages objectAtIndex:0] valueForKey:@"media"]];
+        currentInterval = interval;
+        if([delegate respondsToSelector:@selector(mediaListSync:didLoadNewMedia:)]){
+            [delegate mediaListSync:self didLoadNewMedia:fresh];
+        }
+        [self replaceFirstPageMedia:firstMedia];
+    }else{
+        currentInterval = MIN(currentInterval * backoffMultiplier, maximumInterval);
+    }
+    if(polling){
+        [self scheduleNextSync];
+    }
+}
+/**
+ *  Replace the media of the first page and report the changes
+ *
+ *  @param media The new media for the first page
+ */
+-(void)replaceFirstPageMedia:(NSArray *)media{
+    NSMutableArray *pages = [list pages];
+    if([pages count] == 0 || !media) return;
+    NSArray *previous = [self allMedia];
+    NSMutableDictionary *first = [[NSMutableDictionary alloc] initWithDictionary:[pages objectAtIndex:0]];
+    [first setValue:[[NSMutableArray alloc] initWithArray:media] forKey:@"media"];
+    [pages replaceObjectAtIndex:0 withObject:first];
+    // The diff has to be calculated before resolving the identities, as
+    // resolving refreshes the instances the previous contents are using
+    OlapicMediaListDiff *diff = [OlapicMediaListDiff diffFromMedia:previous toMedia:[self allMedia]];
+    [first setValue:[[NSMutableArray alloc] initWithArray:[[OlapicEntityIdentityMap sharedIdentityMap] resolveEntities:media]] forKey:@"media"];
+    if([diff hasChanges] && [delegate respondsToSelector:@selector(mediaListSync:didChangeMedia:withDiff:)]){
+        [delegate mediaListSync:self didChangeMedia:[self allMedia] withDiff:diff];
+    }
+}
+/**
+ *  Get all the media on the list pages, in order
+ *
+ *  @return An array of OlapicMediaEntity objects
+ */
+-(NSArray *)allMedia{
+    NSMutableArray *media = [[NSMutableArray alloc] init];
+    NSArray *pages = [list pages];
+    for(int p = 0; p < [pages count]; p++){
+        [media addObjectsFromArray:[[pages objectAtIndex:p] valueForKey:@"media"]];
+    }
+    return media;
+}
+/**
+ *  Apply the backoff and inform the delegate about the error
+ *
+ *  @param error The error from the API
+ */
+-(void)finishWithError:(NSError *)error{
+    syncing = NO;
+    currentInterval = MIN(currentInterval * backoffMultiplier, maximumInterval);
+    if([delegate respondsToSelector:@selector(mediaListSync:didReceiveAnError:)]){
+        [delegate mediaListSync:self didReceiveAnError:error];
+    }
+    if(polling){
+        [self scheduleNextSync];
+    }
+}
+/**
+ *  Read an URL from an API link, which can be the URL itself or
+ *  a dictionary with an href key
+ *
+ *  @param link The API link
+ *
+ *  @return The URL or nil
+ */
++(NSString *)URLFromLink:(id)link{
+    if([link isKindOfClass:[NSString class]] && [link length] > 0){
+        return link;
+    }
+    if([link isKindOfClass:[NSDictionary class]]){
+        id href = [link valueForKey:@"href"];
+        if([href isKindOfClass:[NSString class]] && [href length] > 0){
+            return href;
+        }
+    }
+    return nil;
+}
+/**
+ *  Stop the timer before going away
+ */
+-(void)dealloc{
+    [self cancelTimer];
+}
+
+@end
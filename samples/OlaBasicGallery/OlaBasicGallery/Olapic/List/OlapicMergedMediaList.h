@@ -0,0 +1,165 @@
+//
+//  OlapicMergedMediaList.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <OlapicSDK/OlapicSDK.h>
+/**
+ *  The state of a source of a merged list
+ */
+typedef NS_ENUM(NSInteger, OlapicMergedSourceState){
+    /**
+     *  The source has media left, buffered or on the API
+     */
+    OlapicMergedSourceStateActive = 0,
+    /**
+     *  The last request of the source failed: the pages are merged
+     *  without it until it's time to try again
+     */
+    OlapicMergedSourceStateBackedOff = 1,
+    /**
+     *  The source failed too many times in a row and it's not used anymore
+     */
+    OlapicMergedSourceStateDropped = 2,
+    /**
+     *  The source has no media left
+     */
+    OlapicMergedSourceStateFinished = 3
+};
+/**
+ *  A list that mixes the media of several lists (streams, categories...)
+ *  in a single feed, as if they were one.
+ *
+ *  Every source is paged on its own cursor, and the sources that need
+ *  more media are requested at the same time. The merged pages are built
+ *  with a k-way merge by the sort key the sources share (the submission
+ *  date for OlapicMediaListSortingTypeRecent, the photorank score for
+ *  OlapicMediaListSortingTypePhotorank; for the rest, the sources are
+ *  interleaved). A media is taken only when every source that still has
+ *  media has one buffered, so a source is requested again only when the
+ *  merged page needs what comes next on it, and what's left on the
+ *  buffers is used for the next page. A media that more than one source
+ *  has is only added once.
+ *
+ *  The sources fail on their own: when the request of a source fails, the
+ *  page is merged with the sources that answered, and the failed one is
+ *  backed off (its media joins the next pages after the wait, so it can
+ *  be a bit out of order). A source that fails too many times in a row
+ *  is dropped. The delegate only gets an error when there's no media
+ *  left to merge besides the one of the failing sources.
+ *
+ *  The merge runs on a background queue, and the delegate gets the same
+ *  calls (on the main thread) as with any other OlapicMediaList.
+ *
+ *  @warning The sources should use the same sorting as the merged list,
+ *  and they are only used to get their URL and parameters, so they
+ *  don't need to be started. The list only goes forward, so its pages
+ *  can't be dropped and requested again.
+ */
+@interface OlapicMergedMediaList : OlapicMediaList{
+    /**
+     *  The lists the media is taken from
+     */
+    NSArray *sources;
+    /**
+     *  The state of each source: a dictionary with the following keys:
+     *  - url: The API URL for its next request (missing when it has no more media)
+     *  - first: If the next request is its first one
+     *  - media: The media received and not used yet
+     *  - values: The sort values of that media
+     *  - failures: The number of requests that failed in a row
+     *  - retryAt: When it can be requested again, after a failure
+     *  - error: The error of its last request, if it failed
+     *  - dropped: If it failed too many times and it's not used anymore
+     */
+    NSMutableArray *cursors;
+    /**
+     *  The IDs of the media already added to the list
+     */
+    NSMutableSet *knownMedia;
+    /**
+     *  The media taken for the page that is being built, in case a
+     *  request fails and the page has to be continued later
+     */
+    NSMutableArray *pendingPage;
+    /**
+     *  The source to take media from next, when there's no sort key
+     */
+    NSUInteger nextSource;
+    /**
+     *  The queue where the cursors are merged
+     */
+    dispatch_queue_t mergeQueue;
+    /**
+     *  A flag to know if a page is being loaded
+     */
+    BOOL loading;
+    /**
+     *  A flag to know if any source has media left
+     */
+    BOOL hasMoreMedia;
+    /**
+     *  A flag to know if a page was already loaded
+     */
+    BOOL loadedOnce;
+}
+
+@property (nonatomic,strong,readonly) NSArray *sources;
+/**
+ *  Class constructor
+ *
+ *  @param lists          The source lists (OlapicMediaList objects)
+ *  @param delegateObject An object implementing the OlapicMediaListDelegate protocol
+ *  @param sortingType    The sorting the sources share
+ *  @param perPage        How many media objects per merged page will be loaded
+ *
+ *  @return An instance of this object (OlapicMergedMediaList)
+ */
+-(id)initWithSources:(NSArray *)lists delegate:(id<OlapicMediaListDelegate>)delegateObject sort:(OlapicMediaListSortingType)sortingType mediaPerPage:(NSInteger)perPage;
+/**
+ *  Get the value a media is merged by. The bigger values go first
+ *
+ *  @param media       The media object
+ *  @param sortingType The list sorting
+ *
+ *  @return The value, or nil if the sorting has no key to merge by
+ */
++(NSNumber *)sortValueForMedia:(OlapicMediaEntity *)media sorting:(OlapicMediaListSortingType)sortingType;
+/**
+ *  Get the state of a source. It shouldn't be called from the merge queue
+ *
+ *  @param index The source index
+ *
+ *  @return The source state
+ */
+-(OlapicMergedSourceState)stateOfSourceAtIndex:(NSUInteger)index;
+
+@end
@@ -0,0 +1,541 @@
+//
+//  OlapicMergedMediaList.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+// The limit of media a source can be asked for on its first request
+#define kMergedMediaListMaximumSourceCount 50
+// A source is dropped after failing this many times in a row
+#define kMergedMediaListMaximumSourceFailures 3
+// The wait after the first failure of a source, in seconds (it doubles with each failure)
+#define kMergedMediaListSourceBackoff 2.0
+
+#import "OlapicMergedMediaList.h"
+#import "OlapicAPIClient.h"
+#import "OlapicFuture.h"
+#import "OlapicMediaListSync.h"
+#import "OlapicMediaListDiff.h"
+#import "OlapicEntityIdentityMap.h"
+
+@interface OlapicMergedMediaList()
+/**
+ *  Create the cursors for the sources and forget the media already merged.
+ *  It runs on the merge queue
+ */
+-(void)resetCursors;
+/**
+ *  Take media from the cursors until the page is complete or the sources
+ *  run out of media. If a source needs more media to continue, the page
+ *  waits for it. It runs on the merge queue
+ */
+-(void)fillPage;
+/**
+ *  Request the next media of a group of sources, at the same time, and
+ *  continue the page when all of them arrive. It runs on the merge queue
+ *
+ *  @param pendingCursors The cursors that need more media
+ */
+-(void)fetchCursors:(NSArray *)pendingCursors;
+/**
+ *  Request a page of a source. It's called on the merge queue
+ *
+ *  @param URL        The source API URL
+ *  @param parameters The request parameters
+ *
+ *  @return A future for the response dictionary
+ */
+-(OlapicFuture *)futureForMediaFromURL:(NSString *)URL parameters:(NSDictionary *)parameters;
+/**
+ *  Save the failure of a source, backing it off or dropping it. It runs
+ *  on the merge queue
+ *
+ *  @param error  The error of the request
+ *  @param cursor The source cursor
+ */
+-(void)recordError:(NSError *)error forCursor:(NSMutableDictionary *)cursor;
+/**
+ *  Check if a source has to wait before being requested again
+ *
+ *  @param cursor The source cursor
+ *
+ *  @return If it's backed off
+ */
+-(BOOL)isCursorBackedOff:(NSDictionary *)cursor;
+/**
+ *  Get the cursor whose next media goes first on the merged list
+ *
+ *  @return The cursor index, or NSNotFound if there's no media left
+ */
+-(NSUInteger)indexOfNextCursor;
+/**
+ *  Add the page to the list and inform the delegate
+ *
+ *  @param media    The media of the page
+ *  @param moreMedia If any source has media left
+ */
+-(void)finishPageWithMedia:(NSArray *)media moreMedia:(BOOL)moreMedia;
+/**
+ *  Inform the delegate about an error
+ *
+ *  @param error The error from the API
+ */
+-(void)finishWithError:(NSError *)error;
+
+@end
+
+@implementation OlapicMergedMediaList
+@synthesize sources;
+/**
+ *  Class constructor
+ *
+ *  @param lists          The source lists (OlapicMediaList objects)
+ *  @param delegateObject An object implementing the OlapicMediaListDelegate protocol
+ *  @param sortingType    The sorting the sources share
+ *  @param perPage        How many media objects per merged page will be loaded
+ *
+ *  @return An instance of this object (OlapicMergedMediaList)
+ */
+-(id)initWithSources:(NSArray *)lists delegate:(id<OlapicMediaListDelegate>)delegateObject sort:(OlapicMediaListSortingType)sortingType mediaPerPage:(NSInteger)perPage{
+    self = [super init];
+    if(self){
+        sources = [lists copy];
+        delegate = delegateObject;
+        sorting = sortingType;
+        mediaPerPage = MAX(1, perPage);
+        currentOffset = 0;
+        pages = [[NSMutableArray alloc] init];
+        cursors = [[NSMutableArray alloc] init];
+        knownMedia = [[NSMutableSet alloc] init];
+        pendingPage = [[NSMutableArray alloc] init];
+        mergeQueue = dispatch_queue_create("com.olapic.mergedmedialist", DISPATCH_QUEUE_SERIAL);
+        loading = NO;
+        hasMoreMedia = YES;
+        loadedOnce = NO;
+    }
+    return self;
+}
+/**
+ *  Get the value a media is merged by. The bigger values go first
+ *
+ *  @param media       The media object
+ *  @param sortingType The list sorting
+ *
+ *  @return The value, or nil if the sorting has no key to merge by
+ */
++(NSNumber *)sortValueForMedia:(OlapicMediaEntity *)media sorting:(OlapicMediaListSortingType)sortingType{
+    static NSDateFormatter *dateFormatter = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        // '2014-05-12T16:23:11+00:00', whatever the user locale and calendar are
+        dateFormatter = [[NSDateFormatter alloc] init];
+        dateFormatter.locale = [[NSLocale alloc] initWithLocaleIdentifier:@"en_US_POSIX"];
+        dateFormatter.timeZone = [NSTimeZone timeZoneWithAbbreviation:@"GMT"];
+        dateFormatter.dateFormat = @"yyyy-MM-dd'T'HH:mm:ssZZZZZ";
+    });
+    if(sortingType == OlapicMediaListSortingTypeRecent){
+        id submitted = [media get:@"date_submitted"];
+        NSDate *date = [submitted isKindOfClass:[NSString class]] ? [dateFormatter dateFromString:submitted] : nil;
+        // The media without a date go last
+        return date ? @([date timeIntervalSince1970]) : @(-DBL_MAX);
+    }
+    if(sortingType == OlapicMediaListSortingTypePhotorank){
+        id score = [media get:@"photorank"];
+        return [score respondsToSelector:@selector(doubleValue)] ? @([score doubleValue]) : @(-DBL_MAX);
+    }
+    return nil;
+}
+/**
+ *  Get the state of a source. It shouldn't be called from the merge queue
+ *
+ *  @param index The source index
+ *
+ *  @return The source state
+ */
+-(OlapicMergedSourceState)stateOfSourceAtIndex:(NSUInteger)index{
+    __block OlapicMergedSourceState state = OlapicMergedSourceStateActive;
+    dispatch_sync(mergeQueue, ^{
+        if(index >= [cursors count]) return;
+        NSDictionary *cursor = [cursors objectAtIndex:index];
+        if([[cursor valueForKey:@"dropped"] boolValue]){
+            state = OlapicMergedSourceStateDropped;
+        }else if([self isCursorBackedOff:cursor]){
+            state = OlapicMergedSourceStateBackedOff;
+        }else if(![cursor valueForKey:@"url"] && [[cursor valueForKey:@"media"] count] == 0){
+            state = OlapicMergedSourceStateFinished;
+        }
+    });
+    return state;
+}
+/**
+ *  Start downloading media objects. If the list was already loaded,
+ *  it starts again from the first page
+ */
+-(void)startFetching{
+    if(loading) return;
+    [pages removeAllObjects];
+    currentOffset = 0;
+    loadedOnce = NO;
+    hasMoreMedia = YES;
+    dispatch_async(mergeQueue, ^{
+        [self resetCursors];
+    });
+    [self loadNextPage];
+}
+/**
+ *  Check if there's a new page that can be loaded
+ *
+ *  @return If any source has media left
+ */
+-(BOOL)canLoadNextPage{
+    return hasMoreMedia;
+}
+/**
+ *  Load a new page
+ */
+-(void)loadNextPage{
+    if(loading || !hasMoreMedia) return;
+    loading = YES;
+    dispatch_async(mergeQueue, ^{
+        [self fillPage];
+    });
+}
+/**
+ *  The pages are only built going forward
+ *
+ *  @return NO
+ */
+-(BOOL)canLoadPreviousPage{
+    return NO;
+}
+/**
+ *  The pages are only built going forward, so there's nothing to load
+ */
+-(void)loadPreviousPage{
+}
+/**
+ *  Check if the list is currenly building a page
+ *
+ *  @return If the list is downloading
+ */
+-(BOOL)fetching{
+    return loading;
+}
+/**
+ *  Get the last page that was loaded
+ *
+ *  @return The page information
+ */
+-(NSDictionary *)getCurrentPage{
+    return [pages lastObject];
+}
+/**
+ *  Get the media of the last page that was loaded
+ *
+ *  @return An array of OlapicMediaEntity objects
+ */
+-(NSArray *)getCurrentPageMedia{
+    return [[pages lastObject] valueForKey:@"media"];
+}
+/**
+ *  Get all the media on the list, in order
+ *
+ *  @return An array of OlapicMediaEntity objects
+ */
+-(NSArray *)getMedia{
+    NSMutableArray *media = [[NSMutableArray alloc] init];
+    for(int p = 0; p < [pages count]; p++){
+        [media addObjectsFromArray:[[pages objectAtIndex:p] valueForKey:@"media"]];
+    }
+    return media;
+}
+
+#pragma mark - Merge
+/**
+ *  Create the cursors for the sources and forget the media already merged.
+ *  It runs on the merge queue
+ */
+-(void)resetCursors{
+    [cursors removeAllObjects];
+    [knownMedia removeAllObjects];
+    [pendingPage removeAllObjects];
+    nextSource = 0;
+    for(int i = 0; i < [sources count]; i++){
+        NSMutableDictionary *cursor = [[NSMutableDictionary alloc] init];
+        [cursor setValue:[[sources objectAtIndex:i] initialURL] forKey:@"url"];
+        [cursor setValue:@YES forKey:@"first"];
+        [cursor setValue:[[NSMutableArray alloc] init] forKey:@"media"];
+        [cursor setValue:[[NSMutableArray alloc] init] forKey:@"values"];
+        [cursor setValue:@0 forKey:@"failures"];
+        [cursors addObject:cursor];
+    }
+}
+/**
+ *  Take media from the cursors until the page is complete or the sources
+ *  run out of media. If a source needs more media to continue, the page
+ *  waits for it. It runs on the merge queue
+ */
+-(void)fillPage{
+    while([pendingPage count] < mediaPerPage){
+        // Nothing can be taken while a source with media left has none
+        // buffered, as its next media could go first. The sources that
+        // failed don't hold the page until it's time to try them again
+        NSMutableArray *emptyCursors = [[NSMutableArray alloc] init];
+        for(int i = 0; i < [cursors count]; i++){
+            NSDictionary *cursor = [cursors objectAtIndex:i];
+            if([cursor valueForKey:@"url"] && [[cursor valueForKey:@"media"] count] == 0 && ![self isCursorBackedOff:cursor]){
+                [emptyCursors addObject:cursor];
+            }
+        }
+        if([emptyCursors count] > 0){
+            [self fetchCursors:emptyCursors];
+            return;
+        }
+        NSUInteger index = [self indexOfNextCursor];
+        if(index == NSNotFound) break;
+        NSDictionary *cursor = [cursors objectAtIndex:index];
+        OlapicMediaEntity *media = [[cursor valueForKey:@"media"] objectAtIndex:0];
+        [[cursor valueForKey:@"media"] removeObjectAtIndex:0];
+        [[cursor valueForKey:@"values"] removeObjectAtIndex:0];
+        NSString *mediaID = [OlapicMediaListDiff keyForMedia:media];
+        if(![knownMedia containsObject:mediaID]){
+            [knownMedia addObject:mediaID];
+            [pendingPage addObject:media];
+        }
+    }
+    BOOL moreMedia = NO;
+    NSError *sourceError = nil;
+    for(int i = 0; i < [cursors count]; i++){
+        NSDictionary *cursor = [cursors objectAtIndex:i];
+        if([cursor valueForKey:@"url"] || [[cursor valueForKey:@"media"] count] > 0){
+            moreMedia = YES;
+        }
+        if([self isCursorBackedOff:cursor]){
+            sourceError = [cursor valueForKey:@"error"];
+        }
+    }
+    if([pendingPage count] == 0 && sourceError){
+        // Only the failing sources have media left: the page is tried again later
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [self finishWithError:sourceError];
+        });
+        return;
+    }
+    if([pendingPage count] == 0 && !moreMedia){
+        // Every source was dropped or finished: the error of a dropped one says why the list ended early
+        for(int i = 0; i < [cursors count] && !sourceError; i++){
+            sourceError = [[cursors objectAtIndex:i] valueForKey:@"error"];
+        }
+        if(sourceError){
+            dispatch_async(dispatch_get_main_queue(), ^{
+                hasMoreMedia = NO;
+                [self finishWithError:sourceError];
+            });
+            return;
+        }
+    }
+    NSArray *media = [pendingPage copy];
+    [pendingPage removeAllObjects];
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [self finishPageWithMedia:media moreMedia:moreMedia];
+    });
+}
+/**
+ *  Request the next media of a group of sources, at the same time, and
+ *  continue the page when all of them arrive. It runs on the merge queue
+ *
+ *  @param pendingCursors The cursors that need more media
+ */
+-(void)fetchCursors:(NSArray *)pendingCursors{
+    // The first request of a source only asks for what the page is missing
+    NSInteger missing = MIN(mediaPerPage - [pendingPage count], kMergedMediaListMaximumSourceCount);
+    NSMutableArray *requests = [[NSMutableArray alloc] initWithCapacity:[pendingCursors count]];
+    for(int i = 0; i < [pendingCursors count]; i++){
+        NSDictionary *cursor = [pendingCursors objectAtIndex:i];
+        OlapicMediaList *source = [sources objectAtIndex:[cursors indexOfObjectIdenticalTo:cursor]];
+        NSMutableDictionary *parameters = [[NSMutableDictionary alloc] initWithDictionary:[source extraParameters]];
+        if([[cursor valueForKey:@"first"] boolValue]){
+            [parameters setValue:[NSString stringWithFormat:@"%ld",(long)missing] forKey:@"count"];
+        }
+        // Each source settles on its own: a failure is a value, so it doesn't reject the rest
+        [requests addObject:[[self futureForMediaFromURL:[cursor valueForKey:@"url"] parameters:parameters] recover:^OlapicFuture *(NSError *error){
+            return [OlapicFuture futureWithValue:error];
+        }]];
+    }
+    OlapicFuture *fetch = [OlapicFuture all:requests];
+    fetch.callbackQueue = mergeQueue;
+    [fetch onSuccess:^(NSArray *responses){
+        for(int i = 0; i < [pendingCursors count]; i++){
+            NSMutableDictionary *cursor = [pendingCursors objectAtIndex:i];
+            id response = [responses objectAtIndex:i];
+            if([response isKindOfClass:[NSError class]]){
+                [self recordError:response forCursor:cursor];
+                continue;
+            }
+            [cursor setValue:@0 forKey:@"failures"];
+            [cursor setValue:nil forKey:@"retryAt"];
+            [cursor setValue:nil forKey:@"error"];
+            NSArray *media = [response isKindOfClass:[NSDictionary class]] ? [response valueForKey:@"media"] : nil;
+            for(int m = 0; m < [media count]; m++){
+                [[cursor valueForKey:@"media"] addObject:[media objectAtIndex:m]];
+                NSNumber *value = [OlapicMergedMediaList sortValueForMedia:[media objectAtIndex:m] sorting:sorting];
+                [[cursor valueForKey:@"values"] addObject:(value ? value : [NSNull null])];
+            }
+            NSString *next = [OlapicMediaListSync URLFromLink:[[response valueForKey:@"links"] valueForKey:@"next"]];
+            // An empty page also ends the source, so it's not requested forever
+            [cursor setValue:([media count] > 0 ? next : nil) forKey:@"url"];
+            [cursor setValue:@NO forKey:@"first"];
+        }
+        [self fillPage];
+    } onFailure:^(NSError *error){
+        // Only a cancellation gets here. The media taken so far stays on
+        // the pending page, so the next call continues from here
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [self finishWithError:error];
+        });
+    }];
+}
+/**
+ *  Request a page of a source. It's called on the merge queue
+ *
+ *  @param URL        The source API URL
+ *  @param parameters The request parameters
+ *
+ *  @return A future for the response dictionary
+ */
+-(OlapicFuture *)futureForMediaFromURL:(NSString *)URL parameters:(NSDictionary *)parameters{
+    return [OlapicFuture futureWithBlock:^(OlapicFuture *future){
+        [[OlapicAPIClient sharedClient] getMediaFromURL:URL parameters:parameters priority:OlapicRequestPriorityNormal completionQueue:mergeQueue onSuccess:[future fulfillBlock] onFailure:[future rejectBlock]];
+    }];
+}
+/**
+ *  Save the failure of a source, backing it off or dropping it. It runs
+ *  on the merge queue
+ *
+ *  @param error  The error of the request
+ *  @param cursor The source cursor
+ */
+-(void)recordError:(NSError *)error forCursor:(NSMutableDictionary *)cursor{
+    NSInteger failures = [[cursor valueForKey:@"failures"] integerValue] + 1;
+    [cursor setValue:@(failures) forKey:@"failures"];
+    [cursor setValue:error forKey:@"error"];
+    if(failures >= kMergedMediaListMaximumSourceFailures){
+        // The rest of the list goes on without it
+        [cursor setValue:nil forKey:@"url"];
+        [cursor setValue:nil forKey:@"retryAt"];
+        [cursor setValue:@YES forKey:@"dropped"];
+        return;
+    }
+    NSTimeInterval wait = kMergedMediaListSourceBackoff * pow(2, failures - 1);
+    [cursor setValue:[NSDate dateWithTimeIntervalSinceNow:wait] forKey:@"retryAt"];
+}
+/**
+ *  Check if a source has to wait before being requested again
+ *
+ *  @param cursor The source cursor
+ *
+ *  @return If it's backed off
+ */
+-(BOOL)isCursorBackedOff:(NSDictionary *)cursor{
+    NSDate *retryAt = [cursor valueForKey:@"retryAt"];
+    return retryAt && [retryAt timeIntervalSinceNow] > 0;
+}
+/**
+ *  Get the cursor whose next media goes first on the merged list
+ *
+ *  @return The cursor index, or NSNotFound if there's no media left
+ */
+-(NSUInteger)indexOfNextCursor{
+    NSUInteger count = [cursors count];
+    NSUInteger best = NSNotFound;
+    NSNumber *bestValue = nil;
+    for(NSUInteger n = 0; n < count; n++){
+        // Without a sort key, the search starts after the last source used
+        NSUInteger i = (nextSource + n) % count;
+        NSDictionary *cursor = [cursors objectAtIndex:i];
+        if([[cursor valueForKey:@"media"] count] == 0) continue;
+        id value = [[cursor valueForKey:@"values"] objectAtIndex:0];
+        if(![value isKindOfClass:[NSNumber class]]){
+            best = i;
+            break;
+        }
+        // On a tie, the first source wins
+        if(!bestValue || [value compare:bestValue] == NSOrderedDescending || ([value compare:bestValue] == NSOrderedSame && i < best)){
+            best = i;
+            bestValue = value;
+        }
+    }
+    if(best != NSNotFound){
+        nextSource = (best + 1) % count;
+    }
+    return best;
+}
+/**
+ *  Add the page to the list and inform the delegate
+ *
+ *  @param media     The media of the page
+ *  @param moreMedia If any source has media left
+ */
+-(void)finishPageWithMedia:(NSArray *)media moreMedia:(BOOL)moreMedia{
+    loading = NO;
+    hasMoreMedia = moreMedia;
+    if([media count] == 0 && loadedOnce) return;
+    NSArray *resolved = [[OlapicEntityIdentityMap sharedIdentityMap] resolveEntities:media];
+    NSDictionary *links = @{};
+    [pages addObject:@{@"links": links, @"media": [[NSMutableArray alloc] initWithArray:resolved]}];
+    NSInteger previousOffset = currentOffset;
+    currentOffset = [pages count] - 1;
+    if(!loadedOnce){
+        loadedOnce = YES;
+        if([delegate respondsToSelector:@selector(OlapicMediaList:didLoadMediaForTheFirstTime:withLinks:)]){
+            [delegate OlapicMediaList:self didLoadMediaForTheFirstTime:resolved withLinks:links];
+        }
+    }
+    if([delegate respondsToSelector:@selector(OlapicMediaList:didLoadNewMedia:withLinks:)]){
+        [delegate OlapicMediaList:self didLoadNewMedia:resolved withLinks:links];
+    }
+    [delegate OlapicMediaList:self didLoadMedia:resolved withLinks:links];
+    if(currentOffset != previousOffset && [delegate respondsToSelector:@selector(OlapicMediaList:didChangeOffset:fromPreviousOffset:)]){
+        [delegate OlapicMediaList:self didChangeOffset:@(currentOffset) fromPreviousOffset:@(previousOffset)];
+    }
+}
+/**
+ *  Inform the delegate about an error
+ *
+ *  @param error The error from the API
+ */
+-(void)finishWithError:(NSError *)error{
+    loading = NO;
+    if(!loadedOnce && [delegate respondsToSelector:@selector(OlapicMediaList:didReceiveAnErrorForTheFirstTime:)]){
+        [delegate OlapicMediaList:self didReceiveAnErrorForTheFirstTime:error];
+    }
+    [delegate OlapicMediaList:self didReceiveAnError:error];
+}
+
+@end
@@ -0,0 +1,189 @@
+//
+//  OlapicMemoryGovernor.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+/**
+ *  The order in which the consumers are purged under memory pressure:
+ *  first what is cheap to get back, last what costs requests
+ */
+typedef NS_ENUM(NSInteger, OlapicMemoryPurgeLevel){
+    /**
+     *  Decoded images, they are decoded again from the HTTP cache
+     */
+    OlapicMemoryPurgeLevelImages = 0,
+    /**
+     *  List pages far from the screen, they are requested again when needed
+     */
+    OlapicMemoryPurgeLevelPages = 1,
+    /**
+     *  The SDK Pre Cache, its entities are requested again when needed
+     */
+    OlapicMemoryPurgeLevelPreCache = 2
+};
+/**
+ *  The protocol for the objects whose memory is managed by the governor
+ */
+@protocol OlapicMemoryConsumer <NSObject>
+@required
+/**
+ *  Get the number of bytes the object is using (it can be an estimate)
+ *
+ *  @return The number of bytes
+ */
+-(unsigned long long)memoryUsage;
+/**
+ *  Free memory until the object uses, at most, a number of bytes
+ *
+ *  @param size The number of bytes it can keep (0 to free everything it can)
+ */
+-(void)purgeMemoryToSize:(unsigned long long)size;
+@optional
+/**
+ *  The budget of the object changed, so it can apply it by itself
+ *
+ *  @param budget The number of bytes it can use
+ */
+-(void)setMemoryBudget:(unsigned long long)budget;
+
+@end
+
+@class OlapicPreCacheMemoryConsumer;
+/**
+ *  Keeps the memory the app holds for the Olapic content under control:
+ *
+ *  - Each consumer (images, list pages, the SDK Pre Cache) has a budget,
+ *    and it's purged down to it when it goes over.
+ *  - On a memory warning, the consumers are purged by level: the images
+ *    first, then the list pages and last the Pre Cache. It stops as soon as
+ *    the app footprint is under the limit, unless the warning is critical.
+ *  - The usage of every consumer can be read at any time.
+ *
+ *  This object should be used from the main thread.
+ */
+@interface OlapicMemoryGovernor : NSObject{
+    /**
+     *  The consumers, by name (they are not retained)
+     */
+    NSMapTable *consumers;
+    /**
+     *  The purge level of each consumer, by name
+     */
+    NSMutableDictionary *levels;
+    /**
+     *  The budget of each consumer, by name
+     */
+    NSMutableDictionary *budgets;
+    /**
+     *  The footprint, in bytes, under which the app is considered safe
+     */
+    unsigned long long footprintLimit;
+    /**
+     *  The number of purges made because of memory pressure
+     */
+    NSUInteger pressurePurges;
+    /**
+     *  The consumer for the SDK Pre Cache, which is always managed
+     */
+    OlapicPreCacheMemoryConsumer *preCacheConsumer;
+}
+
+@property (nonatomic) unsigned long long footprintLimit;
+@property (nonatomic,readonly) NSUInteger pressurePurges;
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared governor
+ */
++(instancetype)sharedGovernor;
+/**
+ *  Add a consumer
+ *
+ *  @param consumer The consumer object (it's not retained)
+ *  @param name     The name for the consumer
+ *  @param level    The purge level
+ *  @param budget   The number of bytes it can use
+ */
+-(void)addConsumer:(id<OlapicMemoryConsumer>)consumer withName:(NSString *)name level:(OlapicMemoryPurgeLevel)level budget:(unsigned long long)budget;
+/**
+ *  Remove a consumer
+ *
+ *  @param name The name used to add it
+ */
+-(void)removeConsumerWithName:(NSString *)name;
+/**
+ *  Change the budget of a consumer
+ *
+ *  @param budget The number of bytes it can use
+ *  @param name   The consumer name
+ */
+-(void)setBudget:(unsigned long long)budget forConsumerWithName:(NSString *)name;
+/**
+ *  Get the budget of a consumer
+ *
+ *  @param name The consumer name
+ *
+ *  @return The number of bytes it can use
+ */
+-(unsigned long long)budgetForConsumerWithName:(NSString *)name;
+/**
+ *  Purge the consumers that are over their budgets
+ */
+-(void)enforceBudgets;
+/**
+ *  Purge the consumers by level, until the footprint is under the limit
+ *
+ *  @param critical If all the levels should be purged, no matter the footprint
+ */
+-(void)purgeForMemoryPressure:(BOOL)critical;
+/**
+ *  Get the usage and the budget of every consumer
+ *
+ *  @return A dictionary with the 'usage' and the 'budget' of each consumer by name, plus the 'footprint'
+ */
+-(NSDictionary *)snapshot;
+/**
+ *  Get the memory the app is using, as the system counts it
+ *
+ *  @return The number of bytes
+ */
++(unsigned long long)currentFootprint;
+/**
+ *  Estimate how many bytes an object uses, including its content (for
+ *  the collections) and its data (for the entities)
+ *
+ *  @param object The object
+ *
+ *  @return The number of bytes
+ */
++(unsigned long long)estimatedSizeOfObject:(id)object;
+
+@end
@@ -0,0 +1,242 @@
+//
+//  OlapicMemoryGovernor.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+// The footprint limit is this fraction of the device memory
+#define kMemoryGovernorFootprintFraction 0.25
+// What an object costs without its content (header, isa, etc.)
+#define kMemoryGovernorObjectOverhead 16
+
+#import <UIKit/UIKit.h>
+#import <OlapicSDK/OlapicSDK.h>
+#import <mach/mach.h>
+#import "OlapicMemoryGovernor.h"
+#import "OlapicPreCacheMemoryConsumer.h"
+
+@interface OlapicMemoryGovernor()
+/**
+ *  Purge the consumers when the app receives a memory warning
+ *
+ *  @param notification The notification object
+ */
+-(void)didReceiveMemoryWarning:(NSNotification *)notification;
+
+@end
+
+@implementation OlapicMemoryGovernor
+@synthesize footprintLimit,pressurePurges;
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared governor
+ */
++(instancetype)sharedGovernor{
+    static OlapicMemoryGovernor *sharedGovernor = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedGovernor = [[OlapicMemoryGovernor alloc] init];
+    });
+    return sharedGovernor;
+}
+/**
+ *  Class constructor
+ *
+ *  @return An instance of this object (OlapicMemoryGovernor)
+ */
+-(id)init{
+    self = [super init];
+    if(self){
+        consumers = [NSMapTable strongToWeakObjectsMapTable];
+        levels = [[NSMutableDictionary alloc] init];
+        budgets = [[NSMutableDictionary alloc] init];
+        footprintLimit = (unsigned long long)([[NSProcessInfo processInfo] physicalMemory] * kMemoryGovernorFootprintFraction);
+        pressurePurges = 0;
+        preCacheConsumer = [[OlapicPreCacheMemoryConsumer alloc] init];
+        [self addConsumer:preCacheConsumer withName:@"preCache" level:OlapicMemoryPurgeLevelPreCache budget:kPreCacheMemoryDefaultBudget];
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(didReceiveMemoryWarning:) name:UIApplicationDidReceiveMemoryWarningNotification object:nil];
+    }
+    return self;
+}
+/**
+ *  Add a consumer
+ *
+ *  @param consumer The consumer object (it's not retained)
+ *  @param name     The name for the consumer
+ *  @param level    The purge level
+ *  @param budget   The number of bytes it can use
+ */
+-(void)addConsumer:(id<OlapicMemoryConsumer>)consumer withName:(NSString *)name level:(OlapicMemoryPurgeLevel)level budget:(unsigned long long)budget{
+    if(!consumer || !name) return;
+    [consumers setObject:consumer forKey:name];
+    [levels setObject:@(level) forKey:name];
+    [self setBudget:budget forConsumerWithName:name];
+}
+/**
+ *  Remove a consumer
+ *
+ *  @param name The name used to add it
+ */
+-(void)removeConsumerWithName:(NSString *)name{
+    if(!name) return;
+    [consumers removeObjectForKey:name];
+    [levels removeObjectForKey:name];
+    [budgets removeObjectForKey:name];
+}
+/**
+ *  Change the budget of a consumer
+ *
+ *  @param budget The number of bytes it can use
+ *  @param name   The consumer name
+ */
+-(void)setBudget:(unsigned long long)budget forConsumerWithName:(NSString *)name{
+    id<OlapicMemoryConsumer> consumer = [consumers objectForKey:name];
+    if(!consumer) return;
+    [budgets setObject:@(budget) forKey:name];
+    if([consumer respondsToSelector:@selector(setMemoryBudget:)]){
+        [consumer setMemoryBudget:budget];
+    }
+}
+/**
+ *  Get the budget of a consumer
+ *
+ *  @param name The consumer name
+ *
+ *  @return The number of bytes it can use
+ */
+-(unsigned long long)budgetForConsumerWithName:(NSString *)name{
+    return [[budgets objectForKey:name] unsignedLongLongValue];
+}
+/**
+ *  Purge the consumers that are over their budgets
+ */
+-(void)enforceBudgets{
+    NSDictionary *current = [consumers dictionaryRepresentation];
+    [current enumerateKeysAndObjectsUsingBlock:^(NSString *name, id<OlapicMemoryConsumer> consumer, BOOL *stop){
+        unsigned long long budget = [self budgetForConsumerWithName:name];
+        if([consumer memoryUsage] > budget){
+            [consumer purgeMemoryToSize:budget];
+        }
+    }];
+}
+/**
+ *  Purge the consumers by level, until the footprint is under the limit
+ *
+ *  @param critical If all the levels should be purged, no matter the footprint
+ */
+-(void)purgeForMemoryPressure:(BOOL)critical{
+    pressurePurges++;
+    NSDictionary *current = [consumers dictionaryRepresentation];
+    for(NSInteger level = OlapicMemoryPurgeLevelImages; level <= OlapicMemoryPurgeLevelPreCache; level++){
+        [current enumerateKeysAndObjectsUsingBlock:^(NSString *name, id<OlapicMemoryConsumer> consumer, BOOL *stop){
+            if([[levels objectForKey:name] integerValue] == level){
+                [consumer purgeMemoryToSize:0];
+            }
+        }];
+        // The next levels are more expensive to get back
+        if(!critical && [OlapicMemoryGovernor currentFootprint] <= footprintLimit) break;
+    }
+}
+/**
+ *  Get the usage and the budget of every consumer
+ *
+ *  @return A dictionary with the 'usage' and the 'budget' of each consumer by name, plus the 'footprint'
+ */
+-(NSDictionary *)snapshot{
+    NSMutableDictionary *values = [[NSMutableDictionary alloc] init];
+    NSDictionary *current = [consumers dictionaryRepresentation];
+    [current enumerateKeysAndObjectsUsingBlock:^(NSString *name, id<OlapicMemoryConsumer> consumer, BOOL *stop){
+        [values setObject:@{@"usage": @([consumer memoryUsage]),
+                            @"budget": @([self budgetForConsumerWithName:name]),
+                            @"level": [levels objectForKey:name]} forKey:name];
+    }];
+    [values setObject:@([OlapicMemoryGovernor currentFootprint]) forKey:@"footprint"];
+    [values setObject:@(footprintLimit) forKey:@"footprintLimit"];
+    [values setObject:@(pressurePurges) forKey:@"pressurePurges"];
+    return values;
+}
+/**
+ *  Purge the consumers when the app receives a memory warning
+ *
+ *  @param notification The notification object
+ */
+-(void)didReceiveMemoryWarning:(NSNotification *)notification{
+    [self purgeForMemoryPressure:NO];
+}
+/**
+ *  Get the memory the app is using, as the system counts it
+ *
+ *  @return The number of bytes
+ */
++(unsigned long long)currentFootprint{
+    task_vm_info_data_t info;
+    memset(&info, 0, sizeof(info));
+    mach_msg_type_number_t count = TASK_VM_INFO_COUNT;
+    if(task_info(mach_task_self(), TASK_VM_INFO, (task_info_t)&info, &count) != KERN_SUCCESS) return 0;
+    // Older kernels fill less of the structure, and don't have the footprint
+    if(count >= TASK_VM_INFO_REV1_COUNT) return info.phys_footprint;
+    return info.resident_size;
+}
+/**
+ *  Estimate how many bytes an object uses, including its content (for
+ *  the collections) and its data (for the entities)
+ *
+ *  @param object The object
+ *
+ *  @return The number of bytes
+ */
++(unsigned long long)estimatedSizeOfObject:(id)object{
+    if(!object) return 0;
+    unsigned long long size = kMemoryGovernorObjectOverhead;
+    if([object isKindOfClass:[NSString class]]){
+        size += [object lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+    }else if([object isKindOfClass:[NSData class]]){
+        size += [object length];
+    }else if([object isKindOfClass:[NSDictionary class]]){
+        for(id key in object){
+            size += [OlapicMemoryGovernor estimatedSizeOfObject:key] + [OlapicMemoryGovernor estimatedSizeOfObject:[object objectForKey:key]];
+        }
+    }else if([object isKindOfClass:[NSArray class]] || [object isKindOfClass:[NSSet class]]){
+        for(id item in object){
+            size += [OlapicMemoryGovernor estimatedSizeOfObject:item];
+        }
+    }else if([object isKindOfClass:[OlapicEntity class]]){
+        size += [OlapicMemoryGovernor estimatedSizeOfObject:[(OlapicEntity *)object data]];
+    }
+    return size;
+}
+/**
+ *  Remove the observer
+ */
+-(void)dealloc{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+@end
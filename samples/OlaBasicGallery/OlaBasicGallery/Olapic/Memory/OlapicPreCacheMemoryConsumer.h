@@ -0,0 +1,59 @@
+//
+//  OlapicPreCacheMemoryConsumer.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <OlapicSDK/OlapicSDK.h>
+#import "OlapicMemoryGovernor.h"
+
+// The default budget for the Pre Cache entries (4MB)
+#define kPreCacheMemoryDefaultBudget (4 * 1024 * 1024)
+/**
+ *  Lets the governor measure and purge the SDK Pre Cache: the entities
+ *  the SDK saves from the responses, so they don't have to be requested
+ *  again. The SDK doesn't limit it, so it grows with every response.
+ */
+@interface OlapicPreCacheMemoryConsumer : NSObject <OlapicMemoryConsumer>{
+    /**
+     *  The client that owns the Pre Cache
+     */
+    OlapicRestClient *rest;
+}
+/**
+ *  Class constructor
+ *
+ *  @param client The client that owns the Pre Cache
+ *
+ *  @return An instance of this object (OlapicPreCacheMemoryConsumer)
+ */
+-(id)initWithRestClient:(OlapicRestClient *)client;
+
+@end
@@ -0,0 +1,87 @@
+//
+//  OlapicPreCacheMemoryConsumer.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "OlapicPreCacheMemoryConsumer.h"
+
+@implementation OlapicPreCacheMemoryConsumer
+/**
+ *  Class constructor, for the client of the shared SDK
+ *
+ *  @return An instance of this object (OlapicPreCacheMemoryConsumer)
+ */
+-(id)init{
+    return [self initWithRestClient:[[OlapicSDK sharedOlapicSDK] rest]];
+}
+/**
+ *  Class constructor
+ *
+ *  @param client The client that owns the Pre Cache
+ *
+ *  @return An instance of this object (OlapicPreCacheMemoryConsumer)
+ */
+-(id)initWithRestClient:(OlapicRestClient *)client{
+    self = [super init];
+    if(self){
+        rest = client;
+    }
+    return self;
+}
+/**
+ *  Get the number of bytes the Pre Cache entries are using
+ *
+ *  @return The estimated number of bytes
+ */
+-(unsigned long long)memoryUsage{
+    return [OlapicMemoryGovernor estimatedSizeOfObject:[rest getPreCache]];
+}
+/**
+ *  Remove Pre Cache entries until they use, at most, a number of bytes.
+ *  The SDK doesn't say which ones are older, so they are removed in
+ *  the dictionary order
+ *
+ *  @param size The number of bytes it can keep (0 to remove everything)
+ */
+-(void)purgeMemoryToSize:(unsigned long long)size{
+    if(size == 0){
+        [rest clearPreCache];
+        return;
+    }
+    NSDictionary *entries = [rest getPreCache];
+    unsigned long long usage = [OlapicMemoryGovernor estimatedSizeOfObject:entries];
+    for(NSString *URL in [entries allKeys]){
+        if(usage <= size) break;
+        usage -= MIN(usage, [OlapicMemoryGovernor estimatedSizeOfObject:URL] + [OlapicMemoryGovernor estimatedSizeOfObject:[entries objectForKey:URL]]);
+        [rest usePreCacheForURL:URL];
+    }
+}
+
+@end
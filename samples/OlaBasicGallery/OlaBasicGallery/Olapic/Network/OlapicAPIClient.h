@@ -0,0 +1,359 @@
+//
+//  OlapicAPIClient.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <OlapicSDK/OlapicSDK.h>
+#import "OlapicRetryPolicy.h"
+#import "OlapicCircuitBreaker.h"
+#import "OlapicRateLimiter.h"
+#import "OlapicReachability.h"
+/**
+ *  The domain for the errors generated by the client
+ */
+extern NSString *const OlapicAPIClientErrorDomain;
+/**
+ *  The error codes of the client
+ */
+typedef NS_ENUM(NSInteger, OlapicAPIClientErrorCode){
+    /**
+     *  The request wasn't sent because the endpoint circuit is open
+     */
+    OlapicAPIClientErrorCircuitOpen = 1,
+    /**
+     *  The request was held while offline, and the connection didn't
+     *  come back in time (or too many requests were held)
+     */
+    OlapicAPIClientErrorOffline = 2
+};
+/**
+ *  The block that sends a request using the SDK. It must call one of
+ *  the callbacks, only once
+ *
+ *  @param success The callback for when the request works
+ *  @param failure The callback for when the request fails
+ */
+typedef void (^OlapicAPIClientRequestBlock)(void (^success)(id response), void (^failure)(NSError *error));
+/**
+ *  Sends the requests of the app to the API (using the SDK) and makes
+ *  them resilient to the temporary failures:
+ *
+ *  - The SDK only reconnects once, and only to authenticate again. Here,
+ *    the requests that fail with a temporary error are retried following
+ *    an OlapicRetryPolicy (exponential backoff with jitter, and respecting
+ *    the `Retry-After` header).
+ *  - Each endpoint has an OlapicCircuitBreaker. When an endpoint keeps
+ *    failing, its requests fail immediately until the reset time passes.
+ *    The endpoint is the URL host and path, with the IDs replaced, so
+ *    all the media of a stream share the same circuit.
+ *  - Every attempt waits for a token of the OlapicRateLimiter, so the
+ *    bursts are smoothed and the low priority work waits for its turn.
+ *  - While the device is offline (as OlapicReachability reports it) the
+ *    requests are held instead of failing or retrying, and they are sent
+ *    again, in priority order, when the connection comes back. A request
+ *    is held for heldRequestTimeout at most, and only maximumHeldRequests
+ *    are kept (the oldest one of the lowest priority leaves first): the
+ *    ones that leave fail with OlapicAPIClientErrorOffline.
+ *
+ *  Only the requests that are safe to repeat (GET) should go through the
+ *  retries.
+ *
+ *  Every request returns an identifier that can be used to cancel it. The
+ *  SDK can't abort an attempt that was already sent, but a cancelled
+ *  request leaves the rate limiter queue and the held requests, it's not
+ *  retried, and its callbacks are not called.
+ *
+ *  The requests can be made from any thread: the SDK expects to be used
+ *  from the main thread, so the attempts are always sent from there. The
+ *  callbacks are called on the completionQueue (the main queue by
+ *  default), or on the queue given to the request, so the responses
+ *  can be processed in the background without going through the main
+ *  thread.
+ */
+@interface OlapicAPIClient : NSObject{
+    /**
+     *  The policy for the retries
+     */
+    OlapicRetryPolicy *retryPolicy;
+    /**
+     *  The rate limiter for the attempts
+     */
+    OlapicRateLimiter *rateLimiter;
+    /**
+     *  The number of consecutive failures that open a circuit
+     */
+    NSUInteger failureThreshold;
+    /**
+     *  The time a circuit stays open
+     */
+    NSTimeInterval resetTimeout;
+    /**
+     *  The circuit breakers, by endpoint
+     */
+    NSMutableDictionary *circuitBreakers;
+    /**
+     *  The object that watches the connection
+     */
+    OlapicReachability *reachability;
+    /**
+     *  The requests held while offline. It has a queue for each
+     *  priority, and each request is a dictionary with the request
+     *  identifier, the block that sends it again and the failure callback
+     */
+    NSArray *heldRequests;
+    /**
+     *  The maximum time a request is held while offline
+     */
+    NSTimeInterval heldRequestTimeout;
+    /**
+     *  The maximum number of requests held while offline
+     */
+    NSUInteger maximumHeldRequests;
+    /**
+     *  The queue where the callbacks are called, when the request
+     *  doesn't give one
+     */
+    dispatch_queue_t completionQueue;
+    /**
+     *  The identifiers of the requests that didn't finish and weren't cancelled
+     */
+    NSMutableSet *activeRequests;
+}
+
+@property (nonatomic,strong) OlapicRetryPolicy *retryPolicy;
+@property (nonatomic,strong) OlapicRateLimiter *rateLimiter;
+@property (nonatomic) NSUInteger failureThreshold;
+@property (nonatomic) NSTimeInterval resetTimeout;
+@property (nonatomic,strong,readonly) OlapicReachability *reachability;
+@property (nonatomic) NSTimeInterval heldRequestTimeout;
+@property (nonatomic) NSUInteger maximumHeldRequests;
+@property (nonatomic,strong) dispatch_queue_t completionQueue;
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared client
+ */
++(instancetype)sharedClient;
+/**
+ *  Get the endpoint of a URL: its host and path, with the numeric
+ *  components replaced by "{id}"
+ *
+ *  @param URL The URL
+ *
+ *  @return The endpoint name
+ */
++(NSString *)endpointForURL:(NSString *)URL;
+/**
+ *  Get the circuit breaker for the endpoint of a URL (it's created if
+ *  it doesn't exist)
+ *
+ *  @param URL The URL
+ *
+ *  @return The circuit breaker
+ */
+-(OlapicCircuitBreaker *)circuitBreakerForURL:(NSString *)URL;
+/**
+ *  Get the circuit breaker of an endpoint (it's created if it doesn't exist)
+ *
+ *  @param endpoint The endpoint name
+ *
+ *  @return The circuit breaker
+ */
+-(OlapicCircuitBreaker *)circuitBreakerForEndpoint:(NSString *)endpoint;
+/**
+ *  Get the state of all the circuits
+ *
+ *  @return A dictionary with the state name for each endpoint
+ */
+-(NSDictionary *)circuitBreakerStates;
+/**
+ *  Close all the circuits
+ */
+-(void)resetCircuitBreakers;
+/**
+ *  Get the number of requests held until the device is online
+ *
+ *  @return The number of requests
+ */
+-(NSUInteger)heldRequestCount;
+/**
+ *  Cancel a request: the attempts waiting for the rate limiter, for a
+ *  retry or for the connection are not sent, and the callbacks are not
+ *  called. An attempt that was already sent can't be aborted, but its
+ *  response is ignored
+ *
+ *  @param identifier The identifier returned by the request
+ */
+-(void)cancelRequest:(NSString *)identifier;
+/**
+ *  Send a request with rate limiting, retries and circuit breaking
+ *
+ *  @param URL      The request URL, used to find the endpoint
+ *  @param priority The priority while waiting for the rate limiter
+ *  @param request  The block that sends the request. It's called once per attempt
+ *  @param policy   The policy for the retries (nil to use the client policy)
+ *  @param success  A callback for when the request works
+ *  @param failure  A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)performRequestForURL:(NSString *)URL priority:(OlapicRequestPriority)priority withBlock:(OlapicAPIClientRequestBlock)request policy:(OlapicRetryPolicy *)policy onSuccess:(void (^)(id response))success onFailure:(void (^)(NSError *error))failure;
+/**
+ *  Send a request with rate limiting, retries and circuit breaking, and
+ *  call the callbacks on a given queue
+ *
+ *  @param URL      The request URL, used to find the endpoint
+ *  @param priority The priority while waiting for the rate limiter
+ *  @param request  The block that sends the request. It's called once per attempt, on the main thread
+ *  @param policy   The policy for the retries (nil to use the client policy)
+ *  @param queue    The queue for the callbacks (nil to use the client completionQueue)
+ *  @param success  A callback for when the request works
+ *  @param failure  A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)performRequestForURL:(NSString *)URL priority:(OlapicRequestPriority)priority withBlock:(OlapicAPIClientRequestBlock)request policy:(OlapicRetryPolicy *)policy completionQueue:(dispatch_queue_t)queue onSuccess:(void (^)(id response))success onFailure:(void (^)(NSError *error))failure;
+/**
+ *  Send a request with rate limiting, retries and circuit breaking, using
+ *  a given endpoint for the circuit. It's meant for the URLs that don't
+ *  follow the API paths, like the images, where every URL is different
+ *
+ *  @param URL      The request URL
+ *  @param endpoint The endpoint name for the circuit (nil to get it from the URL)
+ *  @param priority The priority while waiting for the rate limiter
+ *  @param request  The block that sends the request. It's called once per attempt, on the main thread
+ *  @param policy   The policy for the retries (nil to use the client policy)
+ *  @param queue    The queue for the callbacks (nil to use the client completionQueue)
+ *  @param success  A callback for when the request works
+ *  @param failure  A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)performRequestForURL:(NSString *)URL endpoint:(NSString *)endpoint priority:(OlapicRequestPriority)priority withBlock:(OlapicAPIClientRequestBlock)request policy:(OlapicRetryPolicy *)policy completionQueue:(dispatch_queue_t)queue onSuccess:(void (^)(id response))success onFailure:(void (^)(NSError *error))failure;
+/**
+ *  Make a GET request to the API
+ *
+ *  @param URL        The request URL
+ *  @param parameters The request parameters
+ *  @param success    A callback for when the request works
+ *  @param failure    A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)get:(NSString *)URL parameters:(NSDictionary *)parameters onSuccess:(void (^)(id responseObject))success onFailure:(void (^)(NSError *error))failure;
+/**
+ *  Make a GET request to the API, calling the callbacks on a given queue
+ *
+ *  @param URL        The request URL
+ *  @param parameters The request parameters
+ *  @param queue      The queue for the callbacks (nil to use the client completionQueue)
+ *  @param success    A callback for when the request works
+ *  @param failure    A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)get:(NSString *)URL parameters:(NSDictionary *)parameters completionQueue:(dispatch_queue_t)queue onSuccess:(void (^)(id responseObject))success onFailure:(void (^)(NSError *error))failure;
+/**
+ *  Download the raw data of a URL
+ *
+ *  @param URL        The request URL
+ *  @param parameters The request parameters
+ *  @param success    A callback for when the request works
+ *  @param failure    A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)getData:(NSString *)URL parameters:(NSDictionary *)parameters onSuccess:(void (^)(NSData *responseData))success onFailure:(void (^)(NSError *error))failure;
+/**
+ *  Download the raw data of a URL, with a priority
+ *
+ *  @param URL        The request URL
+ *  @param parameters The request parameters
+ *  @param priority   The priority while waiting for the rate limiter
+ *  @param success    A callback for when the request works
+ *  @param failure    A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)getData:(NSString *)URL parameters:(NSDictionary *)parameters priority:(OlapicRequestPriority)priority onSuccess:(void (^)(NSData *responseData))success onFailure:(void (^)(NSError *error))failure;
+/**
+ *  Download the raw data of a URL, with a priority, calling the
+ *  callbacks on a given queue
+ *
+ *  @param URL        The request URL
+ *  @param parameters The request parameters
+ *  @param priority   The priority while waiting for the rate limiter
+ *  @param queue      The queue for the callbacks (nil to use the client completionQueue)
+ *  @param success    A callback for when the request works
+ *  @param failure    A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)getData:(NSString *)URL parameters:(NSDictionary *)parameters priority:(OlapicRequestPriority)priority completionQueue:(dispatch_queue_t)queue onSuccess:(void (^)(NSData *responseData))success onFailure:(void (^)(NSError *error))failure;
+/**
+ *  Get a list of media from an API URL, using the SDK media handler
+ *
+ *  @param URL        The API URL
+ *  @param parameters The request parameters
+ *  @param success    A callback with the response dictionary (media and links)
+ *  @param failure    A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)getMediaFromURL:(NSString *)URL parameters:(NSDictionary *)parameters onSuccess:(void (^)(NSDictionary *response))success onFailure:(void (^)(NSError *error))failure;
+/**
+ *  Get a list of media from an API URL, with a priority
+ *
+ *  @param URL        The API URL
+ *  @param parameters The request parameters
+ *  @param priority   The priority while waiting for the rate limiter
+ *  @param success    A callback with the response dictionary (media and links)
+ *  @param failure    A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)getMediaFromURL:(NSString *)URL parameters:(NSDictionary *)parameters priority:(OlapicRequestPriority)priority onSuccess:(void (^)(NSDictionary *response))success onFailure:(void (^)(NSError *error))failure;
+/**
+ *  Get a list of media from an API URL, with a priority, calling the
+ *  callbacks on a given queue
+ *
+ *  @param URL        The API URL
+ *  @param parameters The request parameters
+ *  @param priority   The priority while waiting for the rate limiter
+ *  @param queue      The queue for the callbacks (nil to use the client completionQueue)
+ *  @param success    A callback with the response dictionary (media and links)
+ *  @param failure    A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)getMediaFromURL:(NSString *)URL parameters:(NSDictionary *)parameters priority:(OlapicRequestPriority)priority completionQueue:(dispatch_queue_t)queue onSuccess:(void (^)(NSDictionary *response))success onFailure:(void (^)(NSError *error))failure;
+
+@end
@@ -0,0 +1,669 @@
+//
+//  OlapicAPIClient.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+// The default values for the circuits
+#define kAPIClientFailureThreshold 5
+#define kAPIClientResetTimeout 30
+// The default limits for the requests held while offline
+#define kAPIClientHeldRequestTimeout 60
+#define kAPIClientMaximumHeldRequests 100
+
+#import "OlapicAPIClient.h"
+#import "OlapicHTTPSession.h"
+
+NSString *const OlapicAPIClientErrorDomain = @"OlapicAPIClientErrorDomain";
+
+@interface OlapicAPIClient()
+/**
+ *  Send one attempt of a request, and schedule the next one if it fails
+ *
+ *  @param attempt    The attempt number (starting at 1)
+ *  @param identifier The request identifier
+ *  @param URL        The request URL
+ *  @param priority   The priority while waiting for the rate limiter
+ *  @param breaker    The endpoint circuit breaker
+ *  @param request    The block that sends the request
+ *  @param policy     The policy for the retries
+ *  @param success    A callback for when the request works
+ *  @param failure    A callback for when the request fails after all the attempts
+ */
+-(void)performAttempt:(NSUInteger)attempt ofRequest:(NSString *)identifier forURL:(NSString *)URL priority:(OlapicRequestPriority)priority withBreaker:(OlapicCircuitBreaker *)breaker request:(OlapicAPIClientRequestBlock)request policy:(OlapicRetryPolicy *)policy onSuccess:(void (^)(id response))success onFailure:(void (^)(NSError *error))failure;
+/**
+ *  Create the error for a request that wasn't sent because its circuit is open
+ *
+ *  @param breaker The circuit breaker
+ *
+ *  @return The error object
+ */
+-(NSError *)errorForOpenCircuit:(OlapicCircuitBreaker *)breaker;
+/**
+ *  Hold a request until the device is online
+ *
+ *  @param identifier The request identifier
+ *  @param block      The block that sends the request again
+ *  @param priority   The request priority
+ *  @param failure    The callback for when the request leaves without being sent
+ */
+-(void)holdRequest:(NSString *)identifier withBlock:(void (^)(void))block priority:(OlapicRequestPriority)priority onFailure:(void (^)(NSError *error))failure;
+/**
+ *  Remove a held request, if it's still waiting, and make it fail
+ *
+ *  @param entry  The held request
+ *  @param reason The reason for the error
+ */
+-(void)dropHeldRequest:(NSDictionary *)entry reason:(NSString *)reason;
+/**
+ *  Check if a request is still waiting for its response
+ *
+ *  @param identifier The request identifier
+ *
+ *  @return NO if it finished or it was cancelled
+ */
+-(BOOL)isRequestActive:(NSString *)identifier;
+/**
+ *  Mark a request as finished, so its callback can be called
+ *
+ *  @param identifier The request identifier
+ *
+ *  @return NO if it already finished or it was cancelled (so the callback is not called)
+ */
+-(BOOL)finishRequest:(NSString *)identifier;
+/**
+ *  Send the held requests, in priority order, when the device is online
+ *
+ *  @param notification The notification object
+ */
+-(void)reachabilityDidChange:(NSNotification *)notification;
+/**
+ *  Run a block on a queue. If the queue is the main one and this is
+ *  the main thread, it runs right away
+ *
+ *  @param block The block
+ *  @param queue The queue
+ */
++(void)performBlock:(void (^)(void))block onQueue:(dispatch_queue_t)queue;
+
+@end
+
+@implementation OlapicAPIClient
+@synthesize retryPolicy,rateLimiter,failureThreshold,resetTimeout,reachability,completionQueue,heldRequestTimeout,maximumHeldRequests;
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared client
+ */
++(instancetype)sharedClient{
+    static OlapicAPIClient *sharedClient = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedClient = [[OlapicAPIClient alloc] init];
+    });
+    return sharedClient;
+}
+/**
+ *  Class constructor
+ *
+ *  @return An instance of this object (OlapicAPIClient)
+ */
+-(id)init{
+    self = [super init];
+    if(self){
+        retryPolicy = [OlapicRetryPolicy defaultPolicy];
+        rateLimiter = [OlapicRateLimiter sharedRateLimiter];
+        failureThreshold = kAPIClientFailureThreshold;
+        resetTimeout = kAPIClientResetTimeout;
+        circuitBreakers = [[NSMutableDictionary alloc] init];
+        heldRequests = @[[[NSMutableArray alloc] init], [[NSMutableArray alloc] init], [[NSMutableArray alloc] init]];
+        heldRequestTimeout = kAPIClientHeldRequestTimeout;
+        maximumHeldRequests = kAPIClientMaximumHeldRequests;
+        reachability = [OlapicReachability sharedReachability];
+        completionQueue = dispatch_get_main_queue();
+        activeRequests = [[NSMutableSet alloc] init];
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(reachabilityDidChange:) name:OlapicReachabilityDidChangeNotification object:reachability];
+    }
+    return self;
+}
+/**
+ *  Get the endpoint of a URL: its host and path, with the numeric
+ *  components replaced by "{id}"
+ *
+ *  @param URL The URL
+ *
+ *  @return The endpoint name
+ */
++(NSString *)endpointForURL:(NSString *)URL{
+    NSURL *url = [NSURL URLWithString:URL];
+    if(!url) return URL ? URL : @"";
+    NSCharacterSet *nonDigits = [[NSCharacterSet decimalDigitCharacterSet] invertedSet];
+    NSMutableArray *components = [[NSMutableArray alloc] init];
+    NSArray *pathComponents = [[url path] componentsSeparatedByString:@"/"];
+    for(int i = 0; i < [pathComponents count]; i++){
+        NSString *component = [pathComponents objectAtIndex:i];
+        if([component length] > 0 && [component rangeOfCharacterFromSet:nonDigits].location == NSNotFound){
+            component = @"{id}";
+        }
+        [components addObject:component];
+    }
+    return [NSString stringWithFormat:@"%@%@", [url host] ? [url host] : @"", [components componentsJoinedByString:@"/"]];
+}
+/**
+ *  Get the circuit breaker for the endpoint of a URL (it's created if
+ *  it doesn't exist)
+ *
+ *  @param URL The URL
+ *
+ *  @return The circuit breaker
+ */
+-(OlapicCircuitBreaker *)circuitBreakerForURL:(NSString *)URL{
+    return [self circuitBreakerForEndpoint:[OlapicAPIClient endpointForURL:URL]];
+}
+/**
+ *  Get the circuit breaker of an endpoint (it's created if it doesn't exist)
+ *
+ *  @param endpoint The endpoint name
+ *
+ *  @return The circuit breaker
+ */
+-(OlapicCircuitBreaker *)circuitBreakerForEndpoint:(NSString *)endpoint{
+    @synchronized(circuitBreakers){
+        OlapicCircuitBreaker *breaker = [circuitBreakers objectForKey:endpoint];
+        if(!breaker){
+            breaker = [[OlapicCircuitBreaker alloc] initWithName:endpoint failureThreshold:failureThreshold resetTimeout:resetTimeout];
+            [circuitBreakers setObject:breaker forKey:endpoint];
+        }
+        return breaker;
+    }
+}
+/**
+ *  Get the state of all the circuits
+ *
+ *  @return A dictionary with the state name for each endpoint
+ */
+-(NSDictionary *)circuitBreakerStates{
+    NSMutableDictionary *states = [[NSMutableDictionary alloc] init];
+    NSDictionary *breakers;
+    @synchronized(circuitBreakers){
+        breakers = [circuitBreakers copy];
+    }
+    [breakers enumerateKeysAndObjectsUsingBlock:^(NSString *endpoint, OlapicCircuitBreaker *breaker, BOOL *stop){
+        [states setObject:[OlapicCircuitBreaker nameForState:[breaker state]] forKey:endpoint];
+    }];
+    return states;
+}
+/**
+ *  Close all the circuits
+ */
+-(void)resetCircuitBreakers{
+    NSArray *breakers;
+    @synchronized(circuitBreakers){
+        breakers = [circuitBreakers allValues];
+    }
+    [breakers makeObjectsPerformSelector:@selector(reset)];
+}
+/**
+ *  Send a request with rate limiting, retries and circuit breaking
+ *
+ *  @param URL      The request URL, used to find the endpoint
+ *  @param priority The priority while waiting for the rate limiter
+ *  @param request  The block that sends the request. It's called once per attempt
+ *  @param policy   The policy for the retries (nil to use the client policy)
+ *  @param success  A callback for when the request works
+ *  @param failure  A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)performRequestForURL:(NSString *)URL priority:(OlapicRequestPriority)priority withBlock:(OlapicAPIClientRequestBlock)request policy:(OlapicRetryPolicy *)policy onSuccess:(void (^)(id response))success onFailure:(void (^)(NSError *error))failure{
+    return [self performRequestForURL:URL priority:priority withBlock:request policy:policy completionQueue:nil onSuccess:success onFailure:failure];
+}
+/**
+ *  Send a request with rate limiting, retries and circuit breaking, and
+ *  call the callbacks on a given queue
+ *
+ *  @param URL      The request URL, used to find the endpoint
+ *  @param priority The priority while waiting for the rate limiter
+ *  @param request  The block that sends the request. It's called once per attempt, on the main thread
+ *  @param policy   The policy for the retries (nil to use the client policy)
+ *  @param queue    The queue for the callbacks (nil to use the client completionQueue)
+ *  @param success  A callback for when the request works
+ *  @param failure  A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)performRequestForURL:(NSString *)URL priority:(OlapicRequestPriority)priority withBlock:(OlapicAPIClientRequestBlock)request policy:(OlapicRetryPolicy *)policy completionQueue:(dispatch_queue_t)queue onSuccess:(void (^)(id response))success onFailure:(void (^)(NSError *error))failure{
+    return [self performRequestForURL:URL endpoint:nil priority:priority withBlock:request policy:policy completionQueue:queue onSuccess:success onFailure:failure];
+}
+/**
+ *  Send a request with rate limiting, retries and circuit breaking, using
+ *  a given endpoint for the circuit
+ *
+ *  @param URL      The request URL
+ *  @param endpoint The endpoint name for the circuit (nil to get it from the URL)
+ *  @param priority The priority while waiting for the rate limiter
+ *  @param request  The block that sends the request. It's called once per attempt, on the main thread
+ *  @param policy   The policy for the retries (nil to use the client policy)
+ *  @param queue    The queue for the callbacks (nil to use the client completionQueue)
+ *  @param success  A callback for when the request works
+ *  @param failure  A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)performRequestForURL:(NSString *)URL endpoint:(NSString *)endpoint priority:(OlapicRequestPriority)priority withBlock:(OlapicAPIClientRequestBlock)request policy:(OlapicRetryPolicy *)policy completionQueue:(dispatch_queue_t)queue onSuccess:(void (^)(id response))success onFailure:(void (^)(NSError *error))failure{
+    NSString *identifier = [[NSUUID UUID] UUIDString];
+    @synchronized(activeRequests){
+        [activeRequests addObject:identifier];
+    }
+    dispatch_queue_t callbackQueue = queue ? queue : (completionQueue ? completionQueue : dispatch_get_main_queue());
+    void (^deliverSuccess)(id) = ^(id response){
+        if(![self finishRequest:identifier]) return;
+        if(success) [OlapicAPIClient performBlock:^{ success(response); } onQueue:callbackQueue];
+    };
+    void (^deliverFailure)(NSError *) = ^(NSError *error){
+        if(![self finishRequest:identifier]) return;
+        if(failure) [OlapicAPIClient performBlock:^{ failure(error); } onQueue:callbackQueue];
+    };
+    OlapicRetryPolicy *attemptPolicy = policy ? policy : retryPolicy;
+    // The SDK, the rate limiter and the held requests live on the main thread
+    [OlapicAPIClient performBlock:^{
+        [self performAttempt:1 ofRequest:identifier forURL:URL priority:priority withBreaker:(endpoint ? [self circuitBreakerForEndpoint:endpoint] : [self circuitBreakerForURL:URL]) request:request policy:attemptPolicy onSuccess:deliverSuccess onFailure:deliverFailure];
+    } onQueue:dispatch_get_main_queue()];
+    return identifier;
+}
+/**
+ *  Send one attempt of a request, and schedule the next one if it fails
+ *
+ *  @param attempt    The attempt number (starting at 1)
+ *  @param identifier The request identifier
+ *  @param URL        The request URL
+ *  @param priority   The priority while waiting for the rate limiter
+ *  @param breaker    The endpoint circuit breaker
+ *  @param request    The block that sends the request
+ *  @param policy     The policy for the retries
+ *  @param success    A callback for when the request works
+ *  @param failure    A callback for when the request fails after all the attempts
+ */
+-(void)performAttempt:(NSUInteger)attempt ofRequest:(NSString *)identifier forURL:(NSString *)URL priority:(OlapicRequestPriority)priority withBreaker:(OlapicCircuitBreaker *)breaker request:(OlapicAPIClientRequestBlock)request policy:(OlapicRetryPolicy *)policy onSuccess:(void (^)(id response))success onFailure:(void (^)(NSError *error))failure{
+    // A cancelled request doesn't send more attempts
+    if(![self isRequestActive:identifier]) return;
+    void (^again)(void) = ^{
+        [self performAttempt:attempt ofRequest:identifier forURL:URL priority:priority withBreaker:breaker request:request policy:policy onSuccess:success onFailure:failure];
+    };
+    if(![reachability isReachable]){
+        [self holdRequest:identifier withBlock:again priority:priority onFailure:failure];
+        return;
+    }
+    if(![breaker allowRequest]){
+        if(failure) failure([self errorForOpenCircuit:breaker]);
+        return;
+    }
+    void (^send)(void) = ^{
+        // It was cancelled while it waited for its turn
+        if(![self isRequestActive:identifier]) return;
+        request(^(id response){
+            [breaker recordSuccess];
+            if(success) success(response);
+        }, ^(NSError *error){
+            // The connection was lost: the same attempt is sent when it's back
+            if(![reachability isReachable] && [OlapicRetryPolicy statusCodeForError:error] == 0){
+                [breaker recordCancellation];
+                [self holdRequest:identifier withBlock:again priority:priority onFailure:failure];
+                return;
+            }
+            // The failures are the only responses the SDK exposes, so the headers are read from them
+            [rateLimiter updateWithResponse:[OlapicRetryPolicy responseForError:error] forURL:URL];
+            // Only the failures of the endpoint count: an invalid request (a 404, for example) means it answered
+            if(![policy isRetryableError:error]){
+                [breaker recordSuccess];
+                if(failure) failure(error);
+                return;
+            }
+            [breaker recordFailure];
+            if(![policy shouldRetryError:error afterAttempt:attempt]){
+                if(failure) failure(error);
+                return;
+            }
+            NSTimeInterval delay = [policy delayAfterAttempt:attempt forError:error];
+            dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+                [self performAttempt:(attempt + 1) ofRequest:identifier forURL:URL priority:priority withBreaker:breaker request:request policy:policy onSuccess:success onFailure:failure];
+            });
+        });
+    };
+    if(rateLimiter){
+        [rateLimiter scheduleRequestForURL:URL priority:priority usingBlock:send];
+    }else{
+        send();
+    }
+}
+/**
+ *  Create the error for a request that wasn't sent because its circuit is open
+ *
+ *  @param breaker The circuit breaker
+ *
+ *  @return The error object
+ */
+-(NSError *)errorForOpenCircuit:(OlapicCircuitBreaker *)breaker{
+    NSDictionary *userInfo = @{
+        NSLocalizedDescriptionKey: [NSString stringWithFormat:@"The endpoint %@ is failing, the request wasn't sent", [breaker name]],
+        @"retryAfter": @([breaker timeUntilRetry])
+    };
+    return [NSError errorWithDomain:OlapicAPIClientErrorDomain code:OlapicAPIClientErrorCircuitOpen userInfo:userInfo];
+}
+/**
+ *  Get the number of requests held until the device is online
+ *
+ *  @return The number of requests
+ */
+-(NSUInteger)heldRequestCount{
+    NSUInteger count = 0;
+    @synchronized(heldRequests){
+        for(int i = 0; i < [heldRequests count]; i++){
+            count += [[heldRequests objectAtIndex:i] count];
+        }
+    }
+    return count;
+}
+/**
+ *  Cancel a request: the attempts waiting for the rate limiter, for a
+ *  retry or for the connection are not sent, and the callbacks are not
+ *  called. An attempt that was already sent can't be aborted, but its
+ *  response is ignored
+ *
+ *  @param identifier The identifier returned by the request
+ */
+-(void)cancelRequest:(NSString *)identifier{
+    if(!identifier) return;
+    @synchronized(activeRequests){
+        [activeRequests removeObject:identifier];
+    }
+    // The held attempts leave without failing
+    @synchronized(heldRequests){
+        for(int i = 0; i < [heldRequests count]; i++){
+            NSMutableArray *queue = [heldRequests objectAtIndex:i];
+            for(NSInteger e = [queue count] - 1; e >= 0; e--){
+                if([[[queue objectAtIndex:e] objectForKey:@"identifier"] isEqualToString:identifier]){
+                    [queue removeObjectAtIndex:e];
+                }
+            }
+        }
+    }
+}
+/**
+ *  Check if a request is still waiting for its response
+ *
+ *  @param identifier The request identifier
+ *
+ *  @return NO if it finished or it was cancelled
+ */
+-(BOOL)isRequestActive:(NSString *)identifier{
+    @synchronized(activeRequests){
+        return [activeRequests containsObject:identifier];
+    }
+}
+/**
+ *  Mark a request as finished, so its callback can be called
+ *
+ *  @param identifier The request identifier
+ *
+ *  @return NO if it already finished or it was cancelled (so the callback is not called)
+ */
+-(BOOL)finishRequest:(NSString *)identifier{
+    @synchronized(activeRequests){
+        if(![activeRequests containsObject:identifier]) return NO;
+        [activeRequests removeObject:identifier];
+        return YES;
+    }
+}
+/**
+ *  Hold a request until the device is online. If it waits more than
+ *  heldRequestTimeout, or there are too many held requests, it fails
+ *
+ *  @param identifier The request identifier
+ *  @param block      The block that sends the request again
+ *  @param priority   The request priority
+ *  @param failure    The callback for when the request leaves without being sent
+ */
+-(void)holdRequest:(NSString *)identifier withBlock:(void (^)(void))block priority:(OlapicRequestPriority)priority onFailure:(void (^)(NSError *error))failure{
+    if(![self isRequestActive:identifier]) return;
+    NSInteger index = MAX(OlapicRequestPriorityLow, MIN(OlapicRequestPriorityHigh, priority));
+    NSMutableDictionary *entry = [[NSMutableDictionary alloc] init];
+    [entry setObject:identifier forKey:@"identifier"];
+    [entry setObject:[block copy] forKey:@"block"];
+    if(failure) [entry setObject:[failure copy] forKey:@"failure"];
+    NSDictionary *dropped = nil;
+    @synchronized(heldRequests){
+        [[heldRequests objectAtIndex:index] addObject:entry];
+        // The oldest request of the lowest priority leaves to make room
+        if([self heldRequestCount] > MAX(1, maximumHeldRequests)){
+            for(int i = OlapicRequestPriorityLow; i <= OlapicRequestPriorityHigh && !dropped; i++){
+                dropped = [[heldRequests objectAtIndex:i] firstObject];
+            }
+        }
+    }
+    if(dropped){
+        [self dropHeldRequest:dropped reason:@"Too many requests are waiting for the connection"];
+    }
+    __weak NSDictionary *weakEntry = entry;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(heldRequestTimeout * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+        NSDictionary *expired = weakEntry;
+        if(expired) [self dropHeldRequest:expired reason:@"The connection didn't come back in time"];
+    });
+}
+/**
+ *  Remove a held request, if it's still waiting, and make it fail
+ *
+ *  @param entry  The held request
+ *  @param reason The reason for the error
+ */
+-(void)dropHeldRequest:(NSDictionary *)entry reason:(NSString *)reason{
+    BOOL removed = NO;
+    @synchronized(heldRequests){
+        for(int i = 0; i < [heldRequests count] && !removed; i++){
+            NSMutableArray *queue = [heldRequests objectAtIndex:i];
+            NSUInteger position = [queue indexOfObjectIdenticalTo:entry];
+            if(position != NSNotFound){
+                [queue removeObjectAtIndex:position];
+                removed = YES;
+            }
+        }
+    }
+    // It was already sent, or dropped
+    if(!removed) return;
+    void (^failure)(NSError *) = [entry objectForKey:@"failure"];
+    if(failure) failure([NSError errorWithDomain:OlapicAPIClientErrorDomain code:OlapicAPIClientErrorOffline userInfo:@{NSLocalizedDescriptionKey: reason}]);
+}
+/**
+ *  Send the held requests, in priority order, when the device is online
+ *
+ *  @param notification The notification object
+ */
+-(void)reachabilityDidChange:(NSNotification *)notification{
+    if(![reachability isReachable]) return;
+    for(NSInteger i = OlapicRequestPriorityHigh; i >= OlapicRequestPriorityLow; i--){
+        NSArray *blocks;
+        @synchronized(heldRequests){
+            NSMutableArray *queue = [heldRequests objectAtIndex:i];
+            blocks = [queue copy];
+            [queue removeAllObjects];
+        }
+        // They go to the rate limiter, so they don't leave all at once
+        for(int b = 0; b < [blocks count]; b++){
+            void (^block)(void) = [[blocks objectAtIndex:b] objectForKey:@"block"];
+            block();
+        }
+    }
+}
+/**
+ *  Run a block on a queue. If the queue is the main one and this is
+ *  the main thread, it runs right away
+ *
+ *  @param block The block
+ *  @param queue The queue
+ */
++(void)performBlock:(void (^)(void))block onQueue:(dispatch_queue_t)queue{
+    if(queue == dispatch_get_main_queue() && [NSThread isMainThread]){
+        block();
+    }else{
+        dispatch_async(queue, block);
+    }
+}
+/**
+ *  Remove the observer
+ */
+-(void)dealloc{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+#pragma mark - Requests
+/**
+ *  Make a GET request to the API
+ *
+ *  @param URL        The request URL
+ *  @param parameters The request parameters
+ *  @param success    A callback for when the request works
+ *  @param failure    A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)get:(NSString *)URL parameters:(NSDictionary *)parameters onSuccess:(void (^)(id responseObject))success onFailure:(void (^)(NSError *error))failure{
+    return [self get:URL parameters:parameters completionQueue:nil onSuccess:success onFailure:failure];
+}
+/**
+ *  Make a GET request to the API, calling the callbacks on a given queue
+ *
+ *  @param URL        The request URL
+ *  @param parameters The request parameters
+ *  @param queue      The queue for the callbacks (nil to use the client completionQueue)
+ *  @param success    A callback for when the request works
+ *  @param failure    A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)get:(NSString *)URL parameters:(NSDictionary *)parameters completionQueue:(dispatch_queue_t)queue onSuccess:(void (^)(id responseObject))success onFailure:(void (^)(NSError *error))failure{
+    return [self performRequestForURL:URL priority:OlapicRequestPriorityNormal withBlock:^(void (^attemptSuccess)(id response), void (^attemptFailure)(NSError *error)){
+        [[[OlapicSDK sharedOlapicSDK] rest] get:URL parameters:parameters onSuccess:attemptSuccess onFailure:attemptFailure];
+    } policy:nil completionQueue:queue onSuccess:success onFailure:failure];
+}
+/**
+ *  Download the raw data of a URL
+ *
+ *  @param URL        The request URL
+ *  @param parameters The request parameters
+ *  @param success    A callback for when the request works
+ *  @param failure    A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)getData:(NSString *)URL parameters:(NSDictionary *)parameters onSuccess:(void (^)(NSData *responseData))success onFailure:(void (^)(NSError *error))failure{
+    return [self getData:URL parameters:parameters priority:OlapicRequestPriorityNormal onSuccess:success onFailure:failure];
+}
+/**
+ *  Download the raw data of a URL, with a priority
+ *
+ *  @param URL        The request URL
+ *  @param parameters The request parameters
+ *  @param priority   The priority while waiting for the rate limiter
+ *  @param success    A callback for when the request works
+ *  @param failure    A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)getData:(NSString *)URL parameters:(NSDictionary *)parameters priority:(OlapicRequestPriority)priority onSuccess:(void (^)(NSData *responseData))success onFailure:(void (^)(NSError *error))failure{
+    return [self getData:URL parameters:parameters priority:priority completionQueue:nil onSuccess:success onFailure:failure];
+}
+/**
+ *  Download the raw data of a URL, with a priority, calling the
+ *  callbacks on a given queue
+ *
+ *  @param URL        The request URL
+ *  @param parameters The request parameters
+ *  @param priority   The priority while waiting for the rate limiter
+ *  @param queue      The queue for the callbacks (nil to use the client completionQueue)
+ *  @param success    A callback for when the request works
+ *  @param failure    A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)getData:(NSString *)URL parameters:(NSDictionary *)parameters priority:(OlapicRequestPriority)priority completionQueue:(dispatch_queue_t)queue onSuccess:(void (^)(NSData *responseData))success onFailure:(void (^)(NSError *error))failure{
+    return [self performRequestForURL:URL priority:priority withBlock:^(void (^attemptSuccess)(id response), void (^attemptFailure)(NSError *error)){
+        NSDate *start = [NSDate date];
+        [[[OlapicSDK sharedOlapicSDK] rest] getData:URL parameters:parameters onSuccess:^(NSData *responseData){
+            // The SDK transfers also count for the speed estimate (this time includes the latency)
+            [[[OlapicHTTPSession sharedHTTPSession] metrics] recordTransferOfBytes:[responseData length] duration:-[start timeIntervalSinceNow]];
+            attemptSuccess(responseData);
+        } onFailure:attemptFailure];
+    } policy:nil completionQueue:queue onSuccess:success onFailure:failure];
+}
+/**
+ *  Get a list of media from an API URL, using the SDK media handler
+ *
+ *  @param URL        The API URL
+ *  @param parameters The request parameters
+ *  @param success    A callback with the response dictionary (media and links)
+ *  @param failure    A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)getMediaFromURL:(NSString *)URL parameters:(NSDictionary *)parameters onSuccess:(void (^)(NSDictionary *response))success onFailure:(void (^)(NSError *error))failure{
+    return [self getMediaFromURL:URL parameters:parameters priority:OlapicRequestPriorityNormal onSuccess:success onFailure:failure];
+}
+/**
+ *  Get a list of media from an API URL, with a priority
+ *
+ *  @param URL        The API URL
+ *  @param parameters The request parameters
+ *  @param priority   The priority while waiting for the rate limiter
+ *  @param success    A callback with the response dictionary (media and links)
+ *  @param failure    A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)getMediaFromURL:(NSString *)URL parameters:(NSDictionary *)parameters priority:(OlapicRequestPriority)priority onSuccess:(void (^)(NSDictionary *response))success onFailure:(void (^)(NSError *error))failure{
+    return [self getMediaFromURL:URL parameters:parameters priority:priority completionQueue:nil onSuccess:success onFailure:failure];
+}
+/**
+ *  Get a list of media from an API URL, with a priority, calling the
+ *  callbacks on a given queue
+ *
+ *  @param URL        The API URL
+ *  @param parameters The request parameters
+ *  @param priority   The priority while waiting for the rate limiter
+ *  @param queue      The queue for the callbacks (nil to use the client completionQueue)
+ *  @param success    A callback with the response dictionary (media and links)
+ *  @param failure    A callback for when the request fails after all the attempts
+ *
+ *  @return The identifier of the request, to cancel it
+ */
+-(NSString *)getMediaFromURL:(NSString *)URL parameters:(NSDictionary *)parameters priority:(OlapicRequestPriority)priority completionQueue:(dispatch_queue_t)queue onSuccess:(void (^)(NSDictionary *response))success onFailure:(void (^)(NSError *error))failure{
+    return [self performRequestForURL:URL priority:priority withBlock:^(void (^attemptSuccess)(id response), void (^attemptFailure)(NSError *error)){
+        [[[OlapicSDK sharedOlapicSDK] media] getMediaFromURL:URL onSuccess:attemptSuccess onFailure:attemptFailure parameters:parameters];
+    } policy:nil completionQueue:queue onSuccess:success onFailure:failure];
+}
+
+@end
@@ -0,0 +1,159 @@
+//
+//  OlapicCircuitBreaker.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+/**
+ *  The notification posted when a circuit breaker changes its state.
+ *  The object is the circuit breaker
+ */
+extern NSString *const OlapicCircuitBreakerDidChangeStateNotification;
+/**
+ *  The states of a circuit breaker
+ */
+typedef NS_ENUM(NSInteger, OlapicCircuitBreakerState){
+    /**
+     *  The requests are sent normally
+     */
+    OlapicCircuitBreakerStateClosed,
+    /**
+     *  The endpoint is failing: the requests fail without being sent
+     */
+    OlapicCircuitBreakerStateOpen,
+    /**
+     *  The reset time passed: a single request is sent to test the endpoint
+     */
+    OlapicCircuitBreakerStateHalfOpen
+};
+/**
+ *  Stops sending requests to an endpoint that keeps failing, so the app
+ *  doesn't waste time (and battery) and the server can recover:
+ *
+ *  - After a number of consecutive failures the circuit opens, and the
+ *    requests fail immediately.
+ *  - When the reset time passes, one request is allowed. If it works the
+ *    circuit closes, if it fails the circuit opens again.
+ *
+ *  All the methods can be called from any thread. The notifications are
+ *  posted on the thread that changed the state.
+ */
+@interface OlapicCircuitBreaker : NSObject{
+    /**
+     *  The name of the endpoint
+     */
+    NSString *name;
+    /**
+     *  The number of consecutive failures that open the circuit
+     */
+    NSUInteger failureThreshold;
+    /**
+     *  The time the circuit stays open before testing the endpoint again
+     */
+    NSTimeInterval resetTimeout;
+    /**
+     *  The current state
+     */
+    OlapicCircuitBreakerState state;
+    /**
+     *  The number of consecutive failures
+     */
+    NSUInteger consecutiveFailures;
+    /**
+     *  The moment the circuit was opened
+     */
+    NSDate *openedAt;
+    /**
+     *  A flag to know if the test request of the half open state was already sent
+     */
+    BOOL probing;
+}
+
+@property (nonatomic,strong,readonly) NSString *name;
+@property (nonatomic) NSUInteger failureThreshold;
+@property (nonatomic) NSTimeInterval resetTimeout;
+@property (nonatomic,readonly) NSUInteger consecutiveFailures;
+/**
+ *  Class constructor
+ *
+ *  @param endpoint  The name of the endpoint
+ *  @param threshold The number of consecutive failures that open the circuit
+ *  @param timeout   The time the circuit stays open
+ *
+ *  @return An instance of this object (OlapicCircuitBreaker)
+ */
+-(id)initWithName:(NSString *)endpoint failureThreshold:(NSUInteger)threshold resetTimeout:(NSTimeInterval)timeout;
+/**
+ *  Get the current state. If the circuit is open and the reset time
+ *  passed, it's reported as half open
+ *
+ *  @return The state
+ */
+-(OlapicCircuitBreakerState)state;
+/**
+ *  Ask if a request can be sent now. On the half open state, only the
+ *  first call gets a YES
+ *
+ *  @return YES if the request can be sent
+ */
+-(BOOL)allowRequest;
+/**
+ *  Inform that a request worked. It closes the circuit
+ */
+-(void)recordSuccess;
+/**
+ *  Inform that a request failed
+ */
+-(void)recordFailure;
+/**
+ *  Inform that an allowed request was not completed (it was held or
+ *  cancelled), so it doesn't count as a success or a failure
+ */
+-(void)recordCancellation;
+/**
+ *  Get the time until a request will be allowed
+ *
+ *  @return The time in seconds (0 if the circuit is not open)
+ */
+-(NSTimeInterval)timeUntilRetry;
+/**
+ *  Close the circuit and forget the failures
+ */
+-(void)reset;
+/**
+ *  Get a readable name for a state
+ *
+ *  @param breakerState The state
+ *
+ *  @return The name ("closed", "open" or "half-open")
+ */
++(NSString *)nameForState:(OlapicCircuitBreakerState)breakerState;
+
+@end
@@ -0,0 +1,195 @@
+//
+//  OlapicCircuitBreaker.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "OlapicCircuitBreaker.h"
+
+NSString *const OlapicCircuitBreakerDidChangeStateNotification = @"OlapicCircuitBreakerDidChangeStateNotification";
+
+@interface OlapicCircuitBreaker()
+/**
+ *  Change the state and post the notification
+ *
+ *  @param newState The new state
+ */
+-(void)moveToState:(OlapicCircuitBreakerState)newState;
+
+@end
+
+@implementation OlapicCircuitBreaker
+@synthesize name,failureThreshold,resetTimeout,consecutiveFailures;
+/**
+ *  Class constructor
+ *
+ *  @param endpoint  The name of the endpoint
+ *  @param threshold The number of consecutive failures that open the circuit
+ *  @param timeout   The time the circuit stays open
+ *
+ *  @return An instance of this object (OlapicCircuitBreaker)
+ */
+-(id)initWithName:(NSString *)endpoint failureThreshold:(NSUInteger)threshold resetTimeout:(NSTimeInterval)timeout{
+    self = [super init];
+    if(self){
+        name = endpoint;
+        failureThreshold = MAX(1, threshold);
+        resetTimeout = timeout;
+        state = OlapicCircuitBreakerStateClosed;
+        consecutiveFailures = 0;
+        probing = NO;
+    }
+    return self;
+}
+/**
+ *  Get the current state. If the circuit is open and the reset time
+ *  passed, it's reported as half open
+ *
+ *  @return The state
+ */
+-(OlapicCircuitBreakerState)state{
+    @synchronized(self){
+        if(state == OlapicCircuitBreakerStateOpen && [self timeUntilRetry] <= 0){
+            probing = NO;
+            [self moveToState:OlapicCircuitBreakerStateHalfOpen];
+        }
+        return state;
+    }
+}
+/**
+ *  Ask if a request can be sent now. On the half open state, only the
+ *  first call gets a YES
+ *
+ *  @return YES if the request can be sent
+ */
+-(BOOL)allowRequest{
+    @synchronized(self){
+        switch([self state]){
+            case OlapicCircuitBreakerStateClosed:
+                return YES;
+            case OlapicCircuitBreakerStateOpen:
+                return NO;
+            case OlapicCircuitBreakerStateHalfOpen:
+                if(probing) return NO;
+                probing = YES;
+                return YES;
+        }
+        return YES;
+    }
+}
+/**
+ *  Inform that a request worked. It closes the circuit
+ */
+-(void)recordSuccess{
+    @synchronized(self){
+        consecutiveFailures = 0;
+        probing = NO;
+        openedAt = nil;
+        [self moveToState:OlapicCircuitBreakerStateClosed];
+    }
+}
+/**
+ *  Inform that a request failed
+ */
+-(void)recordFailure{
+    @synchronized(self){
+        consecutiveFailures++;
+        probing = NO;
+        // The test request failed, or there were too many failures
+        if(state == OlapicCircuitBreakerStateHalfOpen || consecutiveFailures >= failureThreshold){
+            openedAt = [NSDate date];
+            [self moveToState:OlapicCircuitBreakerStateOpen];
+        }
+    }
+}
+/**
+ *  Inform that an allowed request was not completed (it was held or
+ *  cancelled), so it doesn't count as a success or a failure
+ */
+-(void)recordCancellation{
+    @synchronized(self){
+        // On the half open state, another request can test the endpoint
+        probing = NO;
+    }
+}
+/**
+ *  Get the time until a request will be allowed
+ *
+ *  @return The time in seconds (0 if the circuit is not open)
+ */
+-(NSTimeInterval)timeUntilRetry{
+    @synchronized(self){
+        if(state != OlapicCircuitBreakerStateOpen || !openedAt) return 0;
+        return MAX(0, resetTimeout + [openedAt timeIntervalSinceNow]);
+    }
+}
+/**
+ *  Close the circuit and forget the failures
+ */
+-(void)reset{
+    [self recordSuccess];
+}
+/**
+ *  Change the state and post the notification
+ *
+ *  @param newState The new state
+ */
+-(void)moveToState:(OlapicCircuitBreakerState)newState{
+    if(state == newState) return;
+    state = newState;
+    [[NSNotificationCenter defaultCenter] postNotificationName:OlapicCircuitBreakerDidChangeStateNotification object:self];
+}
+/**
+ *  Get a readable name for a state
+ *
+ *  @param breakerState The state
+ *
+ *  @return The name ("closed", "open" or "half-open")
+ */
++(NSString *)nameForState:(OlapicCircuitBreakerState)breakerState{
+    switch(breakerState){
+        case OlapicCircuitBreakerStateClosed:
+            return @"closed";
+        case OlapicCircuitBreakerStateOpen:
+            return @"open";
+        case OlapicCircuitBreakerStateHalfOpen:
+            return @"half-open";
+    }
+    return @"unknown";
+}
+/**
+ *  Get a description with the name and the state
+ *
+ *  @return The description
+ */
+-(NSString *)description{
+    return [NSString stringWithFormat:@"<%@: %@ (%@, %lu failures)>", NSStringFromClass([self class]), name, [OlapicCircuitBreaker nameForState:[self state]], (unsigned long)consecutiveFailures];
+}
+
+@end
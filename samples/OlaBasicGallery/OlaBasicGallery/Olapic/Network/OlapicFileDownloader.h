@@ -0,0 +1,187 @@
+//
+//  OlapicFileDownloader.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <OlapicSDK/OlapicSDK.h>
+/**
+ *  Downloads big files (originals and videos) straight to the disk,
+ *  instead of collecting the whole response in memory like the SDK
+ *  getData: does:
+ *
+ *  - The body goes to a file as it arrives, and the progress is reported
+ *    while it downloads.
+ *  - The file ends on the downloads cache directory (or on a given path),
+ *    so it can be memory mapped and the media never has to fit in RAM.
+ *  - Downloads of the same file are merged, and every download returns
+ *    a token to cancel it; the transfer stops when nothing is waiting.
+ *  - The directory has a capacity: when the files go over it, the ones
+ *    used the longest time ago are removed.
+ *
+ *  It uses the shared HTTP session. The operations and the tokens are
+ *  not locked, so this object must only be used from the main thread
+ *  (every method, including the cancellations), and the callbacks are
+ *  called on the main thread.
+ */
+@interface OlapicFileDownloader : NSObject{
+    /**
+     *  The session used for the downloads
+     */
+    NSURLSession *session;
+    /**
+     *  The directory where the files are saved
+     */
+    NSString *directory;
+    /**
+     *  The maximum number of bytes the files of the directory can use
+     */
+    unsigned long long capacity;
+    /**
+     *  The number of bytes the files of the directory use
+     */
+    unsigned long long size;
+    /**
+     *  The downloads in progress, by destination path. Each one is a
+     *  dictionary with the task and the handlers. Only used on the main thread
+     */
+    NSMutableDictionary *operations;
+    /**
+     *  The destination path for each active token. Only used on the main thread
+     */
+    NSMutableDictionary *tokens;
+}
+
+@property (nonatomic,strong,readonly) NSString *directory;
+@property (nonatomic) unsigned long long capacity;
+@property (nonatomic,readonly) unsigned long long size;
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared downloader
+ */
++(instancetype)sharedFileDownloader;
+/**
+ *  Class constructor
+ *
+ *  @param urlSession The session for the downloads
+ *  @param path       The directory where the files are saved
+ *
+ *  @return An instance of this object (OlapicFileDownloader)
+ */
+-(id)initWithSession:(NSURLSession *)urlSession directory:(NSString *)path;
+/**
+ *  Class constructor
+ *
+ *  @param urlSession The session for the downloads
+ *  @param path       The directory where the files are saved
+ *  @param limit      The maximum number of bytes the files can use
+ *
+ *  @return An instance of this object (OlapicFileDownloader)
+ */
+-(id)initWithSession:(NSURLSession *)urlSession directory:(NSString *)path capacity:(unsigned long long)limit;
+/**
+ *  Get the file for a URL, if it was already downloaded to the directory
+ *
+ *  @param URL The file URL on the server
+ *
+ *  @return The local file URL, or nil if it wasn't downloaded
+ */
+-(NSURL *)cachedFileURLForURL:(NSString *)URL;
+/**
+ *  Get the path where a URL is saved on the directory
+ *
+ *  @param URL The file URL on the server
+ *
+ *  @return The local path
+ */
+-(NSString *)pathForURL:(NSString *)URL;
+/**
+ *  Download a file
+ *
+ *  @param URL      The file URL on the server
+ *  @param path     The local path for the file (nil to use the directory)
+ *  @param progress A callback with the progress, from 0 to 1 (-1 if the size is unknown)
+ *  @param success  A callback with the local file URL
+ *  @param failure  A callback for when the file can't be downloaded
+ *
+ *  @return A token to cancel the download, or nil if the file was already there (and the success callback was already called)
+ */
+-(NSString *)downloadURL:(NSString *)URL toPath:(NSString *)path onProgress:(void (^)(float progress))progress onSuccess:(void (^)(NSURL *fileURL))success onFailure:(void (^)(NSError *error))failure;
+/**
+ *  Download the video of a media, or its original image if it's not a
+ *  video. A video without a video URL fails, instead of downloading
+ *  its image
+ *
+ *  @param media    The media object
+ *  @param progress A callback with the progress, from 0 to 1 (-1 if the size is unknown)
+ *  @param success  A callback with the local file URL
+ *  @param failure  A callback for when the file can't be downloaded
+ *
+ *  @return A token to cancel the download, or nil if the file was already there (or the media has no file)
+ */
+-(NSString *)downloadMedia:(OlapicMediaEntity *)media onProgress:(void (^)(float progress))progress onSuccess:(void (^)(NSURL *fileURL))success onFailure:(void (^)(NSError *error))failure;
+/**
+ *  Cancel a download. The callbacks won't be called, and if nothing
+ *  else is waiting for the file, the transfer is cancelled
+ *
+ *  @param token The token returned by the download
+ */
+-(void)cancelDownload:(NSString *)token;
+/**
+ *  Remove all the files of the directory
+ */
+-(void)removeAllFiles;
+/**
+ *  Remove the files used the longest time ago, until the directory is
+ *  under its capacity. The files being downloaded are kept
+ */
+-(void)trimToCapacity;
+/**
+ *  Get the URL of the file of a media: the 'video_url' of a video, or
+ *  the original image if it's not a video
+ *
+ *  @param media The media object
+ *
+ *  @return The URL on the server, or nil if the media is a video without a video URL
+ */
++(NSString *)fileURLForMedia:(OlapicMediaEntity *)media;
+/**
+ *  Read a downloaded file mapping it in memory, so its pages are loaded
+ *  only when they are used
+ *
+ *  @param fileURL The local file URL
+ *  @param error   A pointer for the error, if the file can't be read
+ *
+ *  @return The data object
+ */
++(NSData *)mappedDataWithContentsOfURL:(NSURL *)fileURL error:(NSError **)error;
+
+@end
@@ -0,0 +1,472 @@
+//
+//  OlapicFileDownloader.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+// The downloaded files can use up to 100MB on the disk
+#define kFileDownloaderCapacity (100 * 1024 * 1024)
+#define kFileDownloaderDirectory @"OlapicSDK/Downloads"
+#define kFileDownloaderErrorDomain @"OlapicFileDownloader"
+
+#import "OlapicFileDownloader.h"
+#import "OlapicHTTPSession.h"
+#import <CommonCrypto/CommonDigest.h>
+
+// The KVO context for the tasks progress
+static void *kFileDownloaderProgressContext = &kFileDownloaderProgressContext;
+
+@interface OlapicFileDownloader()
+/**
+ *  Move a finished download to its path and call the handlers
+ *
+ *  @param path     The destination path
+ *  @param location The temporary file of the download
+ *  @param response The response
+ *  @param error    The error, if there was one
+ */
+-(void)finishDownloadToPath:(NSString *)path fromLocation:(NSURL *)location response:(NSURLResponse *)response error:(NSError *)error;
+/**
+ *  Call the handlers of an operation and remove it
+ *
+ *  @param path  The destination path
+ *  @param error The error, or nil if the file is ready
+ */
+-(void)completeOperationForPath:(NSString *)path withError:(NSError *)error;
+/**
+ *  Remove an operation, cancelling its task, if nothing is waiting for it
+ *
+ *  @param path The destination path
+ */
+-(void)cancelOperationIfUnusedForPath:(NSString *)path;
+/**
+ *  Stop observing the progress of an operation task
+ *
+ *  @param operation The operation dictionary
+ */
+-(void)stopObservingOperation:(NSDictionary *)operation;
+/**
+ *  Get all the files of the directory
+ *
+ *  @return An array of dictionaries with the 'path', the 'size' and the 'date' of each file
+ */
+-(NSArray *)directoryFiles;
+/**
+ *  Mark a file as used now, so it's the last one to be removed
+ *
+ *  @param path The file path
+ */
+-(void)touchFileAtPath:(NSString *)path;
+
+@end
+
+@implementation OlapicFileDownloader
+@synthesize directory,capacity,size;
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared downloader
+ */
++(instancetype)sharedFileDownloader{
+    static OlapicFileDownloader *sharedDownloader = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        NSString *caches = [NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES) firstObject];
+        sharedDownloader = [[OlapicFileDownloader alloc] initWithSession:[[OlapicHTTPSession sharedHTTPSession] session] directory:[caches stringByAppendingPathComponent:kFileDownloaderDirectory]];
+    });
+    return sharedDownloader;
+}
+/**
+ *  Class constructor
+ *
+ *  @param urlSession The session for the downloads
+ *  @param path       The directory where the files are saved
+ *
+ *  @return An instance of this object (OlapicFileDownloader)
+ */
+-(id)initWithSession:(NSURLSession *)urlSession directory:(NSString *)path{
+    return [self initWithSession:urlSession directory:path capacity:kFileDownloaderCapacity];
+}
+/**
+ *  Class constructor
+ *
+ *  @param urlSession The session for the downloads
+ *  @param path       The directory where the files are saved
+ *  @param limit      The maximum number of bytes the files can use
+ *
+ *  @return An instance of this object (OlapicFileDownloader)
+ */
+-(id)initWithSession:(NSURLSession *)urlSession directory:(NSString *)path capacity:(unsigned long long)limit{
+    self = [super init];
+    if(self){
+        session = urlSession;
+        directory = path;
+        capacity = limit;
+        operations = [[NSMutableDictionary alloc] init];
+        tokens = [[NSMutableDictionary alloc] init];
+        [[NSFileManager defaultManager] createDirectoryAtPath:directory withIntermediateDirectories:YES attributes:nil error:nil];
+        // The files from the previous sessions count too
+        size = 0;
+        NSArray *files = [self directoryFiles];
+        for(int i = 0; i < [files count]; i++){
+            size += [[[files objectAtIndex:i] objectForKey:@"size"] unsignedLongLongValue];
+        }
+    }
+    return self;
+}
+/**
+ *  Set the maximum number of bytes the files can use, removing the
+ *  files that don't fit anymore
+ *
+ *  @param limit The capacity, in bytes
+ */
+-(void)setCapacity:(unsigned long long)limit{
+    capacity = limit;
+    [self trimToCapacity];
+}
+/**
+ *  Get the file for a URL, if it was already downloaded to the directory
+ *
+ *  @param URL The file URL on the server
+ *
+ *  @return The local file URL, or nil if it wasn't downloaded
+ */
+-(NSURL *)cachedFileURLForURL:(NSString *)URL{
+    if(!URL) return nil;
+    NSString *path = [self pathForURL:URL];
+    if(![[NSFileManager defaultManager] fileExistsAtPath:path]) return nil;
+    [self touchFileAtPath:path];
+    return [NSURL fileURLWithPath:path];
+}
+/**
+ *  Get the path where a URL is saved on the directory
+ *
+ *  @param URL The file URL on the server
+ *
+ *  @return The local path
+ */
+-(NSString *)pathForURL:(NSString *)URL{
+    const char *string = [URL UTF8String];
+    unsigned char digest[CC_SHA1_DIGEST_LENGTH];
+    CC_SHA1(string, (CC_LONG)strlen(string), digest);
+    NSMutableString *name = [[NSMutableString alloc] initWithCapacity:(CC_SHA1_DIGEST_LENGTH * 2)];
+    for(int i = 0; i < CC_SHA1_DIGEST_LENGTH; i++){
+        [name appendFormat:@"%02x", digest[i]];
+    }
+    // The extension helps the players to know the file type
+    NSString *extension = [[[NSURL URLWithString:URL] path] pathExtension];
+    if([extension length] > 0){
+        [name appendFormat:@".%@", extension];
+    }
+    return [directory stringByAppendingPathComponent:name];
+}
+/**
+ *  Download a file
+ *
+ *  @param URL      The file URL on the server
+ *  @param path     The local path for the file (nil to use the directory)
+ *  @param progress A callback with the progress, from 0 to 1 (-1 if the size is unknown)
+ *  @param success  A callback with the local file URL
+ *  @param failure  A callback for when the file can't be downloaded
+ *
+ *  @return A token to cancel the download, or nil if the file was already there (and the success callback was already called)
+ */
+-(NSString *)downloadURL:(NSString *)URL toPath:(NSString *)path onProgress:(void (^)(float progress))progress onSuccess:(void (^)(NSURL *fileURL))success onFailure:(void (^)(NSError *error))failure{
+    NSURL *remoteURL = URL ? [NSURL URLWithString:URL] : nil;
+    if(!remoteURL){
+        if(failure) failure([NSError errorWithDomain:kFileDownloaderErrorDomain code:1 userInfo:@{NSLocalizedDescriptionKey: @"The URL is not valid"}]);
+        return nil;
+    }
+    if(!path) path = [self pathForURL:URL];
+    if([[NSFileManager defaultManager] fileExistsAtPath:path]){
+        [self touchFileAtPath:path];
+        if(success) success([NSURL fileURLWithPath:path]);
+        return nil;
+    }
+    NSMutableDictionary *operation = [operations objectForKey:path];
+    if(!operation){
+        NSURLSessionDownloadTask *task = [session downloadTaskWithURL:remoteURL completionHandler:^(NSURL *location, NSURLResponse *response, NSError *error){
+            // The temporary file is removed when this block returns, so it's moved here
+            [self finishDownloadToPath:path fromLocation:location response:response error:error];
+        }];
+        operation = [[NSMutableDictionary alloc] init];
+        [operation setObject:task forKey:@"task"];
+        [operation setObject:[[NSMutableArray alloc] init] forKey:@"handlers"];
+        [operation setObject:path forKey:@"path"];
+        [operations setObject:operation forKey:path];
+        [task addObserver:self forKeyPath:@"countOfBytesReceived" options:0 context:kFileDownloaderProgressContext];
+        [task resume];
+    }
+    NSString *token = [[NSUUID UUID] UUIDString];
+    NSMutableDictionary *handler = [[NSMutableDictionary alloc] init];
+    [handler setObject:token forKey:@"token"];
+    if(progress) [handler setObject:[progress copy] forKey:@"progress"];
+    if(success) [handler setObject:[success copy] forKey:@"success"];
+    if(failure) [handler setObject:[failure copy] forKey:@"failure"];
+    [[operation objectForKey:@"handlers"] addObject:handler];
+    [tokens setObject:path forKey:token];
+    return token;
+}
+/**
+ *  Download the video of a media, or its original image if it's not a
+ *  video. A video without a video URL fails, instead of downloading
+ *  its image
+ *
+ *  @param media    The media object
+ *  @param progress A callback with the progress, from 0 to 1 (-1 if the size is unknown)
+ *  @param success  A callback with the local file URL
+ *  @param failure  A callback for when the file can't be downloaded
+ *
+ *  @return A token to cancel the download, or nil if the file was already there (or the media has no file)
+ */
+-(NSString *)downloadMedia:(OlapicMediaEntity *)media onProgress:(void (^)(float progress))progress onSuccess:(void (^)(NSURL *fileURL))success onFailure:(void (^)(NSError *error))failure{
+    NSString *URL = [OlapicFileDownloader fileURLForMedia:media];
+    if(!URL && [media isVideo]){
+        // The image of a video is not the file that was asked for
+        if(failure) failure([NSError errorWithDomain:kFileDownloaderErrorDomain code:2 userInfo:@{NSLocalizedDescriptionKey: @"The video doesn't have a video URL"}]);
+        return nil;
+    }
+    return [self downloadURL:URL toPath:nil onProgress:progress onSuccess:success onFailure:failure];
+}
+/**
+ *  Cancel a download. The callbacks won't be called, and if nothing
+ *  else is waiting for the file, the transfer is cancelled
+ *
+ *  @param token The token returned by the download
+ */
+-(void)cancelDownload:(NSString *)token{
+    if(!token) return;
+    NSString *path = [tokens objectForKey:token];
+    if(!path) return;
+    [tokens removeObjectForKey:token];
+    NSMutableArray *handlers = [[operations objectForKey:path] objectForKey:@"handlers"];
+    for(int i = 0; i < [handlers count]; i++){
+        if([[[handlers objectAtIndex:i] objectForKey:@"token"] isEqualToString:token]){
+            [handlers removeObjectAtIndex:i];
+            break;
+        }
+    }
+    [self cancelOperationIfUnusedForPath:path];
+}
+/**
+ *  Remove all the files of the directory
+ */
+-(void)removeAllFiles{
+    NSFileManager *manager = [NSFileManager defaultManager];
+    NSArray *files = [self directoryFiles];
+    for(int i = 0; i < [files count]; i++){
+        NSDictionary *file = [files objectAtIndex:i];
+        // The files being downloaded are replaced when they finish
+        if(![operations objectForKey:[file objectForKey:@"path"]] && [manager removeItemAtPath:[file objectForKey:@"path"] error:nil]){
+            size -= MIN(size, [[file objectForKey:@"size"] unsignedLongLongValue]);
+        }
+    }
+}
+/**
+ *  Remove the files used the longest time ago, until the directory is
+ *  under its capacity. The files being downloaded are kept
+ */
+-(void)trimToCapacity{
+    if(size <= capacity) return;
+    NSArray *files = [[self directoryFiles] sortedArrayUsingComparator:^NSComparisonResult(NSDictionary *a, NSDictionary *b){
+        return [[a objectForKey:@"date"] compare:[b objectForKey:@"date"]];
+    }];
+    NSFileManager *manager = [NSFileManager defaultManager];
+    // The newest file was just asked for, so it's kept even if it's bigger than the capacity
+    for(int i = 0; i + 1 < [files count] && size > capacity; i++){
+        NSDictionary *file = [files objectAtIndex:i];
+        if([operations objectForKey:[file objectForKey:@"path"]]) continue;
+        // A mapped file stays readable until it's unmapped
+        if([manager removeItemAtPath:[file objectForKey:@"path"] error:nil]){
+            size -= MIN(size, [[file objectForKey:@"size"] unsignedLongLongValue]);
+        }
+    }
+}
+/**
+ *  Get all the files of the directory
+ *
+ *  @return An array of dictionaries with the 'path', the 'size' and the 'date' of each file
+ */
+-(NSArray *)directoryFiles{
+    NSMutableArray *files = [[NSMutableArray alloc] init];
+    NSDirectoryEnumerator *enumerator = [[NSFileManager defaultManager] enumeratorAtPath:directory];
+    NSString *file;
+    while((file = [enumerator nextObject])){
+        NSDictionary *attributes = [enumerator fileAttributes];
+        if(![[attributes fileType] isEqualToString:NSFileTypeRegular]) continue;
+        [files addObject:@{@"path": [directory stringByAppendingPathComponent:file],
+                           @"size": @([attributes fileSize]),
+                           @"date": [attributes fileModificationDate] ? [attributes fileModificationDate] : [NSDate distantPast]}];
+    }
+    return files;
+}
+/**
+ *  Mark a file as used now, so it's the last one to be removed
+ *
+ *  @param path The file path
+ */
+-(void)touchFileAtPath:(NSString *)path{
+    [[NSFileManager defaultManager] setAttributes:@{NSFileModificationDate: [NSDate date]} ofItemAtPath:path error:nil];
+}
+/**
+ *  Move a finished download to its path and call the handlers
+ *
+ *  @param path     The destination path
+ *  @param location The temporary file of the download
+ *  @param response The response
+ *  @param error    The error, if there was one
+ */
+-(void)finishDownloadToPath:(NSString *)path fromLocation:(NSURL *)location response:(NSURLResponse *)response error:(NSError *)error{
+    // A cancelled download was already removed, and there could be
+    // a new one for the same file
+    if([error code] == NSURLErrorCancelled) return;
+    NSInteger statusCode = [response isKindOfClass:[NSHTTPURLResponse class]] ? [(NSHTTPURLResponse *)response statusCode] : 200;
+    if(!error && (statusCode < 200 || statusCode >= 300)){
+        error = [NSError errorWithDomain:kFileDownloaderErrorDomain code:statusCode userInfo:@{NSLocalizedDescriptionKey: @"The file couldn't be downloaded"}];
+    }
+    if(!error){
+        NSFileManager *manager = [NSFileManager defaultManager];
+        [manager createDirectoryAtPath:[path stringByDeletingLastPathComponent] withIntermediateDirectories:YES attributes:nil error:nil];
+        [manager removeItemAtPath:path error:nil];
+        NSError *moveError = nil;
+        if(![manager moveItemAtURL:location toURL:[NSURL fileURLWithPath:path] error:&moveError]){
+            error = moveError;
+        }
+    }
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [self completeOperationForPath:path withError:error];
+    });
+}
+/**
+ *  Call the handlers of an operation and remove it
+ *
+ *  @param path  The destination path
+ *  @param error The error, or nil if the file is ready
+ */
+-(void)completeOperationForPath:(NSString *)path withError:(NSError *)error{
+    NSMutableDictionary *operation = [operations objectForKey:path];
+    if(!operation) return;
+    [self stopObservingOperation:operation];
+    [operations removeObjectForKey:path];
+    // Only the files of the directory count for its capacity
+    if(!error && [[path stringByDeletingLastPathComponent] isEqualToString:directory]){
+        size += [[[NSFileManager defaultManager] attributesOfItemAtPath:path error:nil] fileSize];
+        [self trimToCapacity];
+    }
+    NSArray *handlers = [operation objectForKey:@"handlers"];
+    NSURL *fileURL = [NSURL fileURLWithPath:path];
+    for(int i = 0; i < [handlers count]; i++){
+        NSDictionary *handler = [handlers objectAtIndex:i];
+        [tokens removeObjectForKey:[handler objectForKey:@"token"]];
+        if(error){
+            void (^failure)(NSError *) = [handler objectForKey:@"failure"];
+            if(failure) failure(error);
+        }else{
+            void (^success)(NSURL *) = [handler objectForKey:@"success"];
+            if(success) success(fileURL);
+        }
+    }
+}
+/**
+ *  Remove an operation, cancelling its task, if nothing is waiting for it
+ *
+ *  @param path The destination path
+ */
+-(void)cancelOperationIfUnusedForPath:(NSString *)path{
+    NSMutableDictionary *operation = [operations objectForKey:path];
+    if(!operation || [[operation objectForKey:@"handlers"] count] > 0) return;
+    [self stopObservingOperation:operation];
+    [[operation objectForKey:@"task"] cancel];
+    [operations removeObjectForKey:path];
+}
+/**
+ *  Stop observing the progress of an operation task
+ *
+ *  @param operation The operation dictionary
+ */
+-(void)stopObservingOperation:(NSDictionary *)operation{
+    [[operation objectForKey:@"task"] removeObserver:self forKeyPath:@"countOfBytesReceived" context:kFileDownloaderProgressContext];
+}
+/**
+ *  A task received more bytes: report the progress on the main thread
+ *
+ *  @param keyPath The observed property
+ *  @param object  The task
+ *  @param change  The change dictionary
+ *  @param context The observer context
+ */
+-(void)observeValueForKeyPath:(NSString *)keyPath ofObject:(id)object change:(NSDictionary *)change context:(void *)context{
+    if(context != kFileDownloaderProgressContext){
+        [super observeValueForKeyPath:keyPath ofObject:object change:change context:context];
+        return;
+    }
+    NSURLSessionTask *task = object;
+    int64_t expected = task.countOfBytesExpectedToReceive;
+    float progress = expected > 0 ? (float)((double)task.countOfBytesReceived / (double)expected) : -1;
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [operations enumerateKeysAndObjectsUsingBlock:^(NSString *path, NSDictionary *operation, BOOL *stop){
+            if([operation objectForKey:@"task"] != task) return;
+            NSArray *handlers = [[operation objectForKey:@"handlers"] copy];
+            for(int i = 0; i < [handlers count]; i++){
+                void (^callback)(float) = [[handlers objectAtIndex:i] objectForKey:@"progress"];
+                if(callback) callback(progress);
+            }
+            *stop = YES;
+        }];
+    });
+}
+/**
+ *  Get the URL of the file of a media: the 'video_url' of a video, or
+ *  the original image if it's not a video
+ *
+ *  @param media The media object
+ *
+ *  @return The URL on the server, or nil if the media is a video without a video URL
+ */
++(NSString *)fileURLForMedia:(OlapicMediaEntity *)media{
+    if([media isVideo]){
+        NSString *videoURL = [media get:@"video_url"];
+        return ([videoURL isKindOfClass:[NSString class]] && [videoURL length] > 0) ? videoURL : nil;
+    }
+    return [media getMediaURLForImageSize:OlapicMediaImageSizeOriginal];
+}
+/**
+ *  Read a downloaded file mapping it in memory, so its pages are loaded
+ *  only when they are used
+ *
+ *  @param fileURL The local file URL
+ *  @param error   A pointer for the error, if the file can't be read
+ *
+ *  @return The data object
+ */
++(NSData *)mappedDataWithContentsOfURL:(NSURL *)fileURL error:(NSError **)error{
+    return [NSData dataWithContentsOfURL:fileURL options:NSDataReadingMappedAlways error:error];
+}
+
+@end
@@ -0,0 +1,84 @@
+//
+//  OlapicHTTPSession.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import "OlapicNetworkMetrics.h"
+/**
+ *  The single URL session used by the app components that connect
+ *  without the SDK (images, original downloads, etc.), so they all share
+ *  the same pool of connections:
+ *
+ *  - The connections are kept alive and reused between requests to
+ *    the same host, and HTTP/2 multiplexes the requests on a single
+ *    connection when the server supports it.
+ *  - The number of connections per host is limited, so a burst of
+ *    thumbnails doesn't open (and handshake) a connection per image.
+ *  - The responses use the HTTP cache, with a disk cache that
+ *    survives the app restarts.
+ *
+ *  The connection metrics are collected by an OlapicNetworkMetrics object.
+ */
+@interface OlapicHTTPSession : NSObject{
+    /**
+     *  The URL session
+     */
+    NSURLSession *session;
+    /**
+     *  The object that collects the metrics (it's the session delegate)
+     */
+    OlapicNetworkMetrics *metrics;
+}
+
+@property (nonatomic,strong,readonly) NSURLSession *session;
+@property (nonatomic,strong,readonly) OlapicNetworkMetrics *metrics;
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared session object
+ */
++(instancetype)sharedHTTPSession;
+/**
+ *  Get the configuration used by the shared session
+ *
+ *  @return A new configuration object
+ */
++(NSURLSessionConfiguration *)defaultConfiguration;
+/**
+ *  Class constructor
+ *
+ *  @param configuration The session configuration
+ *
+ *  @return An instance of this object (OlapicHTTPSession)
+ */
+-(id)initWithConfiguration:(NSURLSessionConfiguration *)configuration;
+
+@end
@@ -0,0 +1,92 @@
+//
+//  OlapicHTTPSession.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+// The maximum number of connections for each host
+#define kHTTPSessionMaximumConnectionsPerHost 4
+// The time to wait for data before failing a request (in seconds)
+#define kHTTPSessionRequestTimeout 30
+// The size of the memory and the disk caches for the responses
+#define kHTTPSessionMemoryCapacity (4 * 1024 * 1024)
+#define kHTTPSessionDiskCapacity (64 * 1024 * 1024)
+
+#import "OlapicHTTPSession.h"
+
+@implementation OlapicHTTPSession
+@synthesize session,metrics;
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared session object
+ */
++(instancetype)sharedHTTPSession{
+    static OlapicHTTPSession *sharedSession = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedSession = [[OlapicHTTPSession alloc] initWithConfiguration:[OlapicHTTPSession defaultConfiguration]];
+    });
+    return sharedSession;
+}
+/**
+ *  Get the configuration used by the shared session
+ *
+ *  @return A new configuration object
+ */
++(NSURLSessionConfiguration *)defaultConfiguration{
+    NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration defaultSessionConfiguration];
+    configuration.HTTPMaximumConnectionsPerHost = kHTTPSessionMaximumConnectionsPerHost;
+    configuration.timeoutIntervalForRequest = kHTTPSessionRequestTimeout;
+    configuration.requestCachePolicy = NSURLRequestUseProtocolCachePolicy;
+    // Pipelining blocks the responses behind the slow ones, HTTP/2 doesn't need it
+    configuration.HTTPShouldUsePipelining = NO;
+    configuration.URLCache = [[NSURLCache alloc] initWithMemoryCapacity:kHTTPSessionMemoryCapacity diskCapacity:kHTTPSessionDiskCapacity diskPath:@"OlapicHTTPSession"];
+    return configuration;
+}
+/**
+ *  Class constructor
+ *
+ *  @param configuration The session configuration
+ *
+ *  @return An instance of this object (OlapicHTTPSession)
+ */
+-(id)initWithConfiguration:(NSURLSessionConfiguration *)configuration{
+    self = [super init];
+    if(self){
+        metrics = [[OlapicNetworkMetrics alloc] init];
+        // The delegate callbacks only update counters, so any queue works
+        NSOperationQueue *queue = [[NSOperationQueue alloc] init];
+        queue.maxConcurrentOperationCount = 1;
+        session = [NSURLSession sessionWithConfiguration:configuration delegate:metrics delegateQueue:queue];
+    }
+    return self;
+}
+
+@end
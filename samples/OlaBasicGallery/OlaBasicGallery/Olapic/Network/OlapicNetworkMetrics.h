@@ -0,0 +1,154 @@
+//
+//  OlapicNetworkMetrics.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+/**
+ *  The protocol for the objects that add their own values to the metrics
+ */
+@protocol OlapicNetworkMetricsSource <NSObject>
+@required
+/**
+ *  Get the current values of the source
+ *
+ *  @return A dictionary with the values, by name
+ */
+-(NSDictionary *)metricsSnapshot;
+
+@end
+/**
+ *  Collects the connection metrics of a URL session: how many requests
+ *  reused an open connection, how many had to open a new one, and how
+ *  long the TCP and TLS handshakes took.
+ *
+ *  It works as the session delegate, and the numbers are only available
+ *  on iOS 10 or newer (before that, the session never reports them).
+ *  The values can be read and reset at any time, for example on every
+ *  gallery page, to compare configurations. Other components can add
+ *  their values to the snapshot as sources.
+ */
+@interface OlapicNetworkMetrics : NSObject<NSURLSessionTaskDelegate>{
+    /**
+     *  The number of requests that finished
+     */
+    NSUInteger requests;
+    /**
+     *  The number of requests that used an open connection
+     */
+    NSUInteger reusedConnections;
+    /**
+     *  The number of requests that opened a new connection
+     */
+    NSUInteger openedConnections;
+    /**
+     *  The total time spent opening connections (TCP and TLS), in seconds
+     */
+    NSTimeInterval connectTime;
+    /**
+     *  The total time spent on TLS handshakes, in seconds
+     */
+    NSTimeInterval secureConnectionTime;
+    /**
+     *  The number of bytes received
+     */
+    int64_t receivedBytes;
+    /**
+     *  The number of requests for each protocol (like http/1.1 or h2)
+     */
+    NSMutableDictionary *protocols;
+    /**
+     *  The estimated download speed, in bytes per second (0 if there
+     *  are no samples yet). It's a moving average of the recent transfers
+     */
+    double throughput;
+    /**
+     *  The number of transfers used for the throughput
+     */
+    NSUInteger throughputSamples;
+    /**
+     *  The bytes of the small transfers that weren't used for the
+     *  throughput yet
+     */
+    int64_t pendingBytes;
+    /**
+     *  The time of the small transfers that weren't used for the
+     *  throughput yet
+     */
+    NSTimeInterval pendingDuration;
+    /**
+     *  The objects that add their values to the snapshot, by name (the
+     *  sources are not retained)
+     */
+    NSMapTable *sources;
+}
+
+@property (readonly) NSUInteger requests;
+@property (readonly) NSUInteger reusedConnections;
+@property (readonly) NSUInteger openedConnections;
+@property (readonly) NSTimeInterval connectTime;
+@property (readonly) NSTimeInterval secureConnectionTime;
+@property (readonly) int64_t receivedBytes;
+@property (readonly) double throughput;
+/**
+ *  Get all the values on a dictionary
+ *
+ *  @return A dictionary with the values, by name
+ */
+-(NSDictionary *)snapshot;
+/**
+ *  Set all the values to zero
+ */
+-(void)reset;
+/**
+ *  Add a transfer made outside the session (by the SDK, for example)
+ *  to the throughput estimate. The small transfers are added together
+ *  until they reach 16KB, and then they count as a single transfer, as
+ *  the time of each one alone is mostly latency
+ *
+ *  @param bytes    The number of bytes received
+ *  @param duration The time the transfer took, in seconds
+ */
+-(void)recordTransferOfBytes:(int64_t)bytes duration:(NSTimeInterval)duration;
+/**
+ *  Add an object whose values are included on the snapshot, under its name
+ *
+ *  @param source The source object (it's not retained)
+ *  @param name   The name for its values
+ */
+-(void)addSource:(id<OlapicNetworkMetricsSource>)source withName:(NSString *)name;
+/**
+ *  Stop including the values of a source on the snapshot
+ *
+ *  @param name The name used to add it
+ */
+-(void)removeSourceWithName:(NSString *)name;
+
+@end
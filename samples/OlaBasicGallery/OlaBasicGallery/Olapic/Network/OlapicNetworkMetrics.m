@@ -0,0 +1,193 @@
+//
+//  OlapicNetworkMetrics.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+// The transfers smaller than this don't say much about the speed (16KB)
+#define kNetworkMetricsMinimumThroughputBytes (16 * 1024)
+// The weight of a new transfer on the throughput average
+#define kNetworkMetricsThroughputWeight 0.3
+
+#import "OlapicNetworkMetrics.h"
+
+@implementation OlapicNetworkMetrics
+@synthesize requests,reusedConnections,openedConnections,connectTime,secureConnectionTime,receivedBytes,throughput;
+/**
+ *  Class constructor
+ *
+ *  @return An instance of this object (OlapicNetworkMetrics)
+ */
+-(id)init{
+    self = [super init];
+    if(self){
+        protocols = [[NSMutableDictionary alloc] init];
+        sources = [NSMapTable strongToWeakObjectsMapTable];
+        [self reset];
+    }
+    return self;
+}
+/**
+ *  Get all the values on a dictionary
+ *
+ *  @return A dictionary with the values, by name
+ */
+-(NSDictionary *)snapshot{
+    NSMutableDictionary *values;
+    NSDictionary *currentSources;
+    @synchronized(self){
+        values = [[NSMutableDictionary alloc] initWithDictionary:@{
+                 @"requests": @(requests),
+                 @"reusedConnections": @(reusedConnections),
+                 @"openedConnections": @(openedConnections),
+                 @"connectTime": @(connectTime),
+                 @"averageConnectTime": @(openedConnections > 0 ? connectTime / openedConnections : 0),
+                 @"secureConnectionTime": @(secureConnectionTime),
+                 @"receivedBytes": @(receivedBytes),
+                 @"throughput": @(throughput),
+                 @"protocols": [protocols copy]
+                 }];
+        currentSources = [sources dictionaryRepresentation];
+    }
+    // The sources are asked outside the lock, as they can have their own
+    [currentSources enumerateKeysAndObjectsUsingBlock:^(NSString *name, id<OlapicNetworkMetricsSource> source, BOOL *stop){
+        NSDictionary *sourceValues = [source metricsSnapshot];
+        if(sourceValues) [values setObject:sourceValues forKey:name];
+    }];
+    return values;
+}
+/**
+ *  Set all the values to zero
+ */
+-(void)reset{
+    @synchronized(self){
+        requests = 0;
+        reusedConnections = 0;
+        openedConnections = 0;
+        connectTime = 0;
+        secureConnectionTime = 0;
+        receivedBytes = 0;
+        throughput = 0;
+        throughputSamples = 0;
+        pendingBytes = 0;
+        pendingDuration = 0;
+        [protocols removeAllObjects];
+    }
+}
+/**
+ *  Add a transfer made outside the session (by the SDK, for example)
+ *  to the throughput estimate. The small transfers are added together
+ *  until they reach 16KB, and then they count as a single transfer, as
+ *  the time of each one alone is mostly latency
+ *
+ *  @param bytes    The number of bytes received
+ *  @param duration The time the transfer took, in seconds
+ */
+-(void)recordTransferOfBytes:(int64_t)bytes duration:(NSTimeInterval)duration{
+    if(bytes <= 0 || duration <= 0) return;
+    @synchronized(self){
+        if(bytes < kNetworkMetricsMinimumThroughputBytes){
+            // A screen of thumbnails is a lot of small transfers
+            pendingBytes += bytes;
+            pendingDuration += duration;
+            if(pendingBytes < kNetworkMetricsMinimumThroughputBytes) return;
+            bytes = pendingBytes;
+            duration = pendingDuration;
+            pendingBytes = 0;
+            pendingDuration = 0;
+        }
+        double speed = bytes / duration;
+        throughput = throughputSamples == 0 ? speed : (throughput * (1 - kNetworkMetricsThroughputWeight)) + (speed * kNetworkMetricsThroughputWeight);
+        throughputSamples++;
+    }
+}
+/**
+ *  Add an object whose values are included on the snapshot, under its name
+ *
+ *  @param source The source object (it's not retained)
+ *  @param name   The name for its values
+ */
+-(void)addSource:(id<OlapicNetworkMetricsSource>)source withName:(NSString *)name{
+    if(!source || !name) return;
+    @synchronized(self){
+        [sources setObject:source forKey:name];
+    }
+}
+/**
+ *  Stop including the values of a source on the snapshot
+ *
+ *  @param name The name used to add it
+ */
+-(void)removeSourceWithName:(NSString *)name{
+    if(!name) return;
+    @synchronized(self){
+        [sources removeObjectForKey:name];
+    }
+}
+
+#pragma mark - Session delegate
+/**
+ *  The session finished collecting the metrics of a task. There's a
+ *  transaction for every request the task made (redirects included)
+ *
+ *  @param session The session
+ *  @param task    The task
+ *  @param metrics The metrics object
+ */
+-(void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task didFinishCollectingMetrics:(NSURLSessionTaskMetrics *)metrics{
+    @synchronized(self){
+        for(NSURLSessionTaskTransactionMetrics *transaction in metrics.transactionMetrics){
+            // The ones that came from the local cache don't touch the network
+            if(transaction.resourceFetchType != NSURLSessionTaskMetricsResourceFetchTypeNetworkLoad) continue;
+            requests++;
+            if(transaction.reusedConnection){
+                reusedConnections++;
+            }else{
+                openedConnections++;
+                if(transaction.connectStartDate && transaction.connectEndDate){
+                    connectTime += [transaction.connectEndDate timeIntervalSinceDate:transaction.connectStartDate];
+                }
+                if(transaction.secureConnectionStartDate && transaction.secureConnectionEndDate){
+                    secureConnectionTime += [transaction.secureConnectionEndDate timeIntervalSinceDate:transaction.secureConnectionStartDate];
+                }
+            }
+            NSString *protocol = transaction.networkProtocolName ? transaction.networkProtocolName : @"unknown";
+            [protocols setObject:@([[protocols objectForKey:protocol] unsignedIntegerValue] + 1) forKey:protocol];
+        }
+        receivedBytes += task.countOfBytesReceived;
+    }
+    // The speed is measured from the first byte to the last one, so the
+    // latency of the request doesn't count
+    NSURLSessionTaskTransactionMetrics *last = [metrics.transactionMetrics lastObject];
+    if(last.resourceFetchType == NSURLSessionTaskMetricsResourceFetchTypeNetworkLoad && last.responseStartDate && last.responseEndDate){
+        [self recordTransferOfBytes:task.countOfBytesReceived duration:[last.responseEndDate timeIntervalSinceDate:last.responseStartDate]];
+    }
+}
+
+@end
@@ -0,0 +1,152 @@
+//
+//  OlapicRateLimiter.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import "OlapicTokenBucket.h"
+#import "OlapicNetworkMetrics.h"
+/**
+ *  The priorities of the requests waiting for a token
+ */
+typedef NS_ENUM(NSInteger, OlapicRequestPriority){
+    /**
+     *  Work the user is not waiting for (syncs, prefetches, avatars)
+     */
+    OlapicRequestPriorityLow = 0,
+    /**
+     *  The default priority
+     */
+    OlapicRequestPriorityNormal = 1,
+    /**
+     *  Work the user is waiting for
+     */
+    OlapicRequestPriorityHigh = 2
+};
+/**
+ *  Smooths the bursts of API requests, so they don't reach the server
+ *  rate limits:
+ *
+ *  - The endpoints are grouped in classes (images, media, uploaders,
+ *    curation and the rest), and each class has an OlapicTokenBucket.
+ *  - A request that doesn't get a token waits on a queue for its class,
+ *    instead of failing. The high priority requests leave the queue first.
+ *  - The rate limit headers of the responses (`X-RateLimit-Remaining`,
+ *    `X-RateLimit-Reset` and `Retry-After`) adjust the buckets, so a 429
+ *    pauses the whole class until the limit resets.
+ *
+ *  The bucket levels are included on the network metrics snapshot.
+ *  The state is protected by a lock, so it can be read from any thread,
+ *  but the requests should be scheduled from the main thread: the ones
+ *  that wait are started on the main thread.
+ */
+@interface OlapicRateLimiter : NSObject<OlapicNetworkMetricsSource>{
+    /**
+     *  The buckets, by endpoint class
+     */
+    NSMutableDictionary *buckets;
+    /**
+     *  The waiting requests, by endpoint class. Each one is an array
+     *  with a queue (array of blocks) for each priority
+     */
+    NSMutableDictionary *queues;
+    /**
+     *  The endpoint classes that have a drain scheduled
+     */
+    NSMutableSet *scheduledDrains;
+    /**
+     *  The number of requests that had to wait, by endpoint class
+     */
+    NSMutableDictionary *delayedRequests;
+}
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared rate limiter
+ */
++(instancetype)sharedRateLimiter;
+/**
+ *  Get the class of the endpoint of a URL
+ *
+ *  @param URL The URL
+ *
+ *  @return The endpoint class ("images", "media", "uploaders", "curation" or "default")
+ */
++(NSString *)endpointClassForURL:(NSString *)URL;
+/**
+ *  Change the bucket of an endpoint class
+ *
+ *  @param capacity      The maximum burst of requests
+ *  @param rate          The number of requests per second
+ *  @param endpointClass The endpoint class
+ */
+-(void)setCapacity:(double)capacity refillRate:(double)rate forEndpointClass:(NSString *)endpointClass;
+/**
+ *  Get the bucket of an endpoint class (it's created if it doesn't exist)
+ *
+ *  @param endpointClass The endpoint class
+ *
+ *  @return The bucket
+ */
+-(OlapicTokenBucket *)bucketForEndpointClass:(NSString *)endpointClass;
+/**
+ *  Start a request as soon as there's a token for its endpoint
+ *
+ *  @param URL      The request URL
+ *  @param priority The request priority
+ *  @param block    The block that starts the request
+ */
+-(void)scheduleRequestForURL:(NSString *)URL priority:(OlapicRequestPriority)priority usingBlock:(void (^)(void))block;
+/**
+ *  Start a request as soon as there's a token for an endpoint class, for
+ *  the requests the SDK sends without exposing their URL
+ *
+ *  @param endpointClass The endpoint class
+ *  @param priority      The request priority
+ *  @param block         The block that starts the request
+ */
+-(void)scheduleRequestForEndpointClass:(NSString *)endpointClass priority:(OlapicRequestPriority)priority usingBlock:(void (^)(void))block;
+/**
+ *  Adjust the bucket of an endpoint using the rate limit headers of a response
+ *
+ *  @param response The response
+ *  @param URL      The request URL
+ */
+-(void)updateWithResponse:(NSHTTPURLResponse *)response forURL:(NSString *)URL;
+/**
+ *  Get the number of requests waiting for a token
+ *
+ *  @param endpointClass The endpoint class
+ *
+ *  @return The number of requests
+ */
+-(NSUInteger)queuedRequestsForEndpointClass:(NSString *)endpointClass;
+
+@end
@@ -0,0 +1,349 @@
+//
+//  OlapicRateLimiter.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+// The default buckets (burst and requests per second)
+#define kRateLimiterMediaCapacity 8
+#define kRateLimiterMediaRate 4
+#define kRateLimiterUploadersCapacity 6
+#define kRateLimiterUploadersRate 2
+#define kRateLimiterCurationCapacity 4
+#define kRateLimiterCurationRate 2
+#define kRateLimiterDefaultCapacity 8
+#define kRateLimiterDefaultRate 4
+// The images are served by a CDN, so a whole screen of thumbnails can leave at once
+#define kRateLimiterImagesCapacity 32
+#define kRateLimiterImagesRate 16
+// A reset value bigger than this is a date, not a number of seconds
+#define kRateLimiterEpochThreshold 1000000000
+
+#import "OlapicRateLimiter.h"
+#import "OlapicHTTPSession.h"
+
+@interface OlapicRateLimiter()
+/**
+ *  Start the waiting requests of an endpoint class while there are
+ *  tokens, and schedule the next drain if some are still waiting
+ *
+ *  @param endpointClass The endpoint class
+ */
+-(void)drainQueueForEndpointClass:(NSString *)endpointClass;
+/**
+ *  Get the queues of an endpoint class (they are created if they don't exist)
+ *
+ *  @param endpointClass The endpoint class
+ *
+ *  @return An array with a queue for each priority
+ */
+-(NSArray *)queuesForEndpointClass:(NSString *)endpointClass;
+/**
+ *  Find the value of a header, ignoring the case of its name
+ *
+ *  @param names    The possible names of the header
+ *  @param response The response
+ *
+ *  @return The value or nil if the response doesn't have it
+ */
++(NSString *)valueForHeaders:(NSArray *)names inResponse:(NSHTTPURLResponse *)response;
+
+@end
+
+@implementation OlapicRateLimiter
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared rate limiter
+ */
++(instancetype)sharedRateLimiter{
+    static OlapicRateLimiter *sharedLimiter = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedLimiter = [[OlapicRateLimiter alloc] init];
+        [[[OlapicHTTPSession sharedHTTPSession] metrics] addSource:sharedLimiter withName:@"rateLimits"];
+    });
+    return sharedLimiter;
+}
+/**
+ *  Class constructor
+ *
+ *  @return An instance of this object (OlapicRateLimiter)
+ */
+-(id)init{
+    self = [super init];
+    if(self){
+        buckets = [[NSMutableDictionary alloc] init];
+        queues = [[NSMutableDictionary alloc] init];
+        scheduledDrains = [[NSMutableSet alloc] init];
+        delayedRequests = [[NSMutableDictionary alloc] init];
+        [self setCapacity:kRateLimiterMediaCapacity refillRate:kRateLimiterMediaRate forEndpointClass:@"media"];
+        [self setCapacity:kRateLimiterUploadersCapacity refillRate:kRateLimiterUploadersRate forEndpointClass:@"uploaders"];
+        [self setCapacity:kRateLimiterCurationCapacity refillRate:kRateLimiterCurationRate forEndpointClass:@"curation"];
+        [self setCapacity:kRateLimiterDefaultCapacity refillRate:kRateLimiterDefaultRate forEndpointClass:@"default"];
+        [self setCapacity:kRateLimiterImagesCapacity refillRate:kRateLimiterImagesRate forEndpointClass:@"images"];
+    }
+    return self;
+}
+/**
+ *  Get the class of the endpoint of a URL
+ *
+ *  @param URL The URL
+ *
+ *  @return The endpoint class ("images", "media", "uploaders", "curation" or "default")
+ */
++(NSString *)endpointClassForURL:(NSString *)URL{
+    NSString *path = [[[NSURL URLWithString:URL] path] lowercaseString];
+    if(!path) return @"default";
+    // The image files go first, as the CDN paths can include "media"
+    if([@[@"jpg", @"jpeg", @"png", @"gif", @"webp"] containsObject:[path pathExtension]]) return @"images";
+    // The curation goes first, as its paths also include "media"
+    if([path rangeOfString:@"curation"].location != NSNotFound) return @"curation";
+    if([path rangeOfString:@"/uploaders"].location != NSNotFound || [path rangeOfString:@"/users"].location != NSNotFound) return @"uploaders";
+    if([path rangeOfString:@"/media"].location != NSNotFound) return @"media";
+    return @"default";
+}
+/**
+ *  Change the bucket of an endpoint class
+ *
+ *  @param capacity      The maximum burst of requests
+ *  @param rate          The number of requests per second
+ *  @param endpointClass The endpoint class
+ */
+-(void)setCapacity:(double)capacity refillRate:(double)rate forEndpointClass:(NSString *)endpointClass{
+    @synchronized(self){
+        OlapicTokenBucket *bucket = [buckets objectForKey:endpointClass];
+        if(bucket){
+            bucket.capacity = capacity;
+            bucket.refillRate = rate;
+        }else{
+            [buckets setObject:[[OlapicTokenBucket alloc] initWithCapacity:capacity refillRate:rate] forKey:endpointClass];
+        }
+    }
+}
+/**
+ *  Get the bucket of an endpoint class (it's created if it doesn't exist)
+ *
+ *  @param endpointClass The endpoint class
+ *
+ *  @return The bucket
+ */
+-(OlapicTokenBucket *)bucketForEndpointClass:(NSString *)endpointClass{
+    @synchronized(self){
+        OlapicTokenBucket *bucket = [buckets objectForKey:endpointClass];
+        if(!bucket){
+            bucket = [[OlapicTokenBucket alloc] initWithCapacity:kRateLimiterDefaultCapacity refillRate:kRateLimiterDefaultRate];
+            [buckets setObject:bucket forKey:endpointClass];
+        }
+        return bucket;
+    }
+}
+/**
+ *  Start a request as soon as there's a token for its endpoint
+ *
+ *  @param URL      The request URL
+ *  @param priority The request priority
+ *  @param block    The block that starts the request
+ */
+-(void)scheduleRequestForURL:(NSString *)URL priority:(OlapicRequestPriority)priority usingBlock:(void (^)(void))block{
+    [self scheduleRequestForEndpointClass:[OlapicRateLimiter endpointClassForURL:URL] priority:priority usingBlock:block];
+}
+/**
+ *  Start a request as soon as there's a token for an endpoint class, for
+ *  the requests the SDK sends without exposing their URL
+ *
+ *  @param endpointClass The endpoint class
+ *  @param priority      The request priority
+ *  @param block         The block that starts the request
+ */
+-(void)scheduleRequestForEndpointClass:(NSString *)endpointClass priority:(OlapicRequestPriority)priority usingBlock:(void (^)(void))block{
+    if(!block) return;
+    BOOL startNow = NO;
+    @synchronized(self){
+        // Only go ahead of the queue if nobody is waiting
+        if([self queuedRequestsForEndpointClass:endpointClass] == 0 && [[self bucketForEndpointClass:endpointClass] consumeToken]){
+            startNow = YES;
+        }else{
+            NSInteger index = MAX(OlapicRequestPriorityLow, MIN(OlapicRequestPriorityHigh, priority));
+            [[[self queuesForEndpointClass:endpointClass] objectAtIndex:index] addObject:[block copy]];
+            [delayedRequests setObject:@([[delayedRequests objectForKey:endpointClass] unsignedIntegerValue] + 1) forKey:endpointClass];
+        }
+    }
+    // The requests are started without the lock, as they can schedule other ones
+    if(startNow){
+        block();
+        return;
+    }
+    [self drainQueueForEndpointClass:endpointClass];
+}
+/**
+ *  Start the waiting requests of an endpoint class while there are
+ *  tokens, and schedule the next drain if some are still waiting
+ *
+ *  @param endpointClass The endpoint class
+ */
+-(void)drainQueueForEndpointClass:(NSString *)endpointClass{
+    while(YES){
+        void (^block)(void) = nil;
+        @synchronized(self){
+            if([scheduledDrains containsObject:endpointClass]) return;
+            if([self queuedRequestsForEndpointClass:endpointClass] == 0 || ![[self bucketForEndpointClass:endpointClass] consumeToken]) break;
+            NSArray *classQueues = [self queuesForEndpointClass:endpointClass];
+            for(NSInteger i = OlapicRequestPriorityHigh; i >= OlapicRequestPriorityLow; i--){
+                NSMutableArray *queue = [classQueues objectAtIndex:i];
+                if([queue count] == 0) continue;
+                block = [queue objectAtIndex:0];
+                [queue removeObjectAtIndex:0];
+                break;
+            }
+        }
+        block();
+    }
+    NSTimeInterval delay;
+    @synchronized(self){
+        if([self queuedRequestsForEndpointClass:endpointClass] == 0) return;
+        [scheduledDrains addObject:endpointClass];
+        delay = MAX(0.01, [[self bucketForEndpointClass:endpointClass] timeUntilToken]);
+    }
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+        @synchronized(self){
+            [scheduledDrains removeObject:endpointClass];
+        }
+        [self drainQueueForEndpointClass:endpointClass];
+    });
+}
+/**
+ *  Get the queues of an endpoint class (they are created if they don't exist)
+ *
+ *  @param endpointClass The endpoint class
+ *
+ *  @return An array with a queue for each priority
+ */
+-(NSArray *)queuesForEndpointClass:(NSString *)endpointClass{
+    // Called with the lock taken
+    NSArray *classQueues = [queues objectForKey:endpointClass];
+    if(!classQueues){
+        classQueues = @[[[NSMutableArray alloc] init], [[NSMutableArray alloc] init], [[NSMutableArray alloc] init]];
+        [queues setObject:classQueues forKey:endpointClass];
+    }
+    return classQueues;
+}
+/**
+ *  Get the number of requests waiting for a token
+ *
+ *  @param endpointClass The endpoint class
+ *
+ *  @return The number of requests
+ */
+-(NSUInteger)queuedRequestsForEndpointClass:(NSString *)endpointClass{
+    @synchronized(self){
+        NSArray *classQueues = [queues objectForKey:endpointClass];
+        NSUInteger count = 0;
+        for(int i = 0; i < [classQueues count]; i++){
+            count += [[classQueues objectAtIndex:i] count];
+        }
+        return count;
+    }
+}
+/**
+ *  Adjust the bucket of an endpoint using the rate limit headers of a response
+ *
+ *  @param response The response
+ *  @param URL      The request URL
+ */
+-(void)updateWithResponse:(NSHTTPURLResponse *)response forURL:(NSString *)URL{
+    if(!response) return;
+    OlapicTokenBucket *bucket = [self bucketForEndpointClass:[OlapicRateLimiter endpointClassForURL:URL]];
+    NSString *remaining = [OlapicRateLimiter valueForHeaders:@[@"X-RateLimit-Remaining", @"RateLimit-Remaining"] inResponse:response];
+    NSString *reset = [OlapicRateLimiter valueForHeaders:@[@"X-RateLimit-Reset", @"RateLimit-Reset"] inResponse:response];
+    NSString *retryAfter = [OlapicRateLimiter valueForHeaders:@[@"Retry-After"] inResponse:response];
+    if(remaining){
+        [bucket limitToRemaining:[remaining doubleValue]];
+    }
+    NSDate *resetDate = nil;
+    if(retryAfter && [retryAfter doubleValue] > 0){
+        resetDate = [NSDate dateWithTimeIntervalSinceNow:[retryAfter doubleValue]];
+    }else if(reset){
+        double value = [reset doubleValue];
+        resetDate = value > kRateLimiterEpochThreshold ? [NSDate dateWithTimeIntervalSince1970:value] : [NSDate dateWithTimeIntervalSinceNow:value];
+    }
+    // The limit was reached: nothing else is sent until it resets
+    if(resetDate && ([response statusCode] == 429 || (remaining && [remaining doubleValue] < 1))){
+        [bucket pauseUntil:resetDate];
+    }else if([response statusCode] == 429){
+        [bucket limitToRemaining:0];
+    }
+}
+/**
+ *  Find the value of a header, ignoring the case of its name
+ *
+ *  @param names    The possible names of the header
+ *  @param response The response
+ *
+ *  @return The value or nil if the response doesn't have it
+ */
++(NSString *)valueForHeaders:(NSArray *)names inResponse:(NSHTTPURLResponse *)response{
+    NSDictionary *headers = [response allHeaderFields];
+    for(NSString *header in headers){
+        for(int i = 0; i < [names count]; i++){
+            if([header caseInsensitiveCompare:[names objectAtIndex:i]] == NSOrderedSame){
+                return [NSString stringWithFormat:@"%@", [headers objectForKey:header]];
+            }
+        }
+    }
+    return nil;
+}
+#pragma mark - Metrics source
+/**
+ *  Get the current level of each bucket
+ *
+ *  @return A dictionary with the tokens, capacity, rate and waiting requests of each endpoint class
+ */
+-(NSDictionary *)metricsSnapshot{
+    NSMutableDictionary *levels = [[NSMutableDictionary alloc] init];
+    // The state is locked, so it can be read from the metrics thread
+    // without waiting for the main one
+    @synchronized(self){
+        [buckets enumerateKeysAndObjectsUsingBlock:^(NSString *endpointClass, OlapicTokenBucket *bucket, BOOL *stop){
+            // Reading the tokens refills the bucket, and ends the pause if it's over
+            double tokens = [bucket tokens];
+            [levels setObject:@{
+                                @"tokens": @(tokens),
+                                @"capacity": @([bucket capacity]),
+                                @"refillRate": @([bucket refillRate]),
+                                @"queued": @([self queuedRequestsForEndpointClass:endpointClass]),
+                                @"delayed": @([[delayedRequests objectForKey:endpointClass] unsignedIntegerValue]),
+                                @"paused": @([bucket pausedUntil] != nil)
+                                } forKey:endpointClass];
+        }];
+    }
+    return levels;
+}
+
+@end
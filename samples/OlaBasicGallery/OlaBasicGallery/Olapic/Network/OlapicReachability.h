@@ -0,0 +1,126 @@
+//
+//  OlapicReachability.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <SystemConfiguration/SystemConfiguration.h>
+/**
+ *  The notification posted when the connection changes. The object
+ *  is the reachability object
+ */
+extern NSString *const OlapicReachabilityDidChangeNotification;
+/**
+ *  The types of connection
+ */
+typedef NS_ENUM(NSInteger, OlapicConnectionType){
+    /**
+     *  There's no connection
+     */
+    OlapicConnectionTypeNone,
+    /**
+     *  A cellular connection (slower, and it uses the user data plan)
+     */
+    OlapicConnectionTypeCellular,
+    /**
+     *  A WiFi or wired connection
+     */
+    OlapicConnectionTypeWiFi
+};
+/**
+ *  Watches the device connection using the SystemConfiguration
+ *  reachability API, so the app can hold the requests while it's offline
+ *  and adapt the amount of content it downloads to the connection type.
+ *
+ *  The notifications are posted on the main thread.
+ */
+@interface OlapicReachability : NSObject{
+    /**
+     *  The reachability reference
+     */
+    SCNetworkReachabilityRef reachabilityRef;
+    /**
+     *  The current connection type
+     */
+    OlapicConnectionType connectionType;
+    /**
+     *  A flag to know if the changes are being watched
+     */
+    BOOL monitoring;
+}
+
+@property (nonatomic,readonly) OlapicConnectionType connectionType;
+@property (nonatomic,readonly) BOOL monitoring;
+/**
+ *  Get the shared instance. It's already watching the connection
+ *
+ *  @return The shared reachability object
+ */
++(instancetype)sharedReachability;
+/**
+ *  Class constructor, to watch the connection to a host
+ *
+ *  @param host The host name
+ *
+ *  @return An instance of this object (OlapicReachability)
+ */
+-(id)initWithHost:(NSString *)host;
+/**
+ *  Start watching the connection changes
+ *
+ *  @return YES if it could start
+ */
+-(BOOL)startMonitoring;
+/**
+ *  Stop watching the connection changes
+ */
+-(void)stopMonitoring;
+/**
+ *  Check if there's a connection
+ *
+ *  @return YES if the device is online
+ */
+-(BOOL)isReachable;
+/**
+ *  Check if the connection is cellular
+ *
+ *  @return YES if the device is on a cellular connection
+ */
+-(BOOL)isCellular;
+/**
+ *  Get a readable name for a connection type
+ *
+ *  @param type The connection type
+ *
+ *  @return The name ("none", "cellular" or "wifi")
+ */
++(NSString *)nameForConnectionType:(OlapicConnectionType)type;
+
+@end
@@ -0,0 +1,222 @@
+//
+//  OlapicReachability.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "OlapicReachability.h"
+#import <netinet/in.h>
+
+NSString *const OlapicReachabilityDidChangeNotification = @"OlapicReachabilityDidChangeNotification";
+
+@interface OlapicReachability()
+/**
+ *  Update the connection type using the reachability flags, and post
+ *  the notification if it changed
+ *
+ *  @param flags The reachability flags
+ */
+-(void)updateWithFlags:(SCNetworkReachabilityFlags)flags;
+/**
+ *  Get the connection type for a set of reachability flags
+ *
+ *  @param flags The reachability flags
+ *
+ *  @return The connection type
+ */
++(OlapicConnectionType)connectionTypeForFlags:(SCNetworkReachabilityFlags)flags;
+
+@end
+/**
+ *  The reachability callback. It's called on the main queue
+ *
+ *  @param target The reachability reference
+ *  @param flags  The new flags
+ *  @param info   The reachability object
+ */
+static void OlapicReachabilityCallback(SCNetworkReachabilityRef target, SCNetworkReachabilityFlags flags, void *info){
+    OlapicReachability *reachability = (__bridge OlapicReachability *)info;
+    [reachability updateWithFlags:flags];
+}
+
+@implementation OlapicReachability
+@synthesize connectionType,monitoring;
+/**
+ *  Get the shared instance. It's already watching the connection
+ *
+ *  @return The shared reachability object
+ */
++(instancetype)sharedReachability{
+    static OlapicReachability *sharedReachability = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedReachability = [[OlapicReachability alloc] init];
+        [sharedReachability startMonitoring];
+    });
+    return sharedReachability;
+}
+/**
+ *  Class constructor, to watch the connection to any host
+ *
+ *  @return An instance of this object (OlapicReachability)
+ */
+-(id)init{
+    self = [super init];
+    if(self){
+        struct sockaddr_in address;
+        bzero(&address, sizeof(address));
+        address.sin_len = sizeof(address);
+        address.sin_family = AF_INET;
+        reachabilityRef = SCNetworkReachabilityCreateWithAddress(kCFAllocatorDefault, (const struct sockaddr *)&address);
+        // The local address answers right away, so the first state is known
+        SCNetworkReachabilityFlags flags = 0;
+        connectionType = (reachabilityRef && SCNetworkReachabilityGetFlags(reachabilityRef, &flags)) ? [OlapicReachability connectionTypeForFlags:flags] : OlapicConnectionTypeWiFi;
+        monitoring = NO;
+    }
+    return self;
+}
+/**
+ *  Class constructor, to watch the connection to a host
+ *
+ *  @param host The host name
+ *
+ *  @return An instance of this object (OlapicReachability)
+ */
+-(id)initWithHost:(NSString *)host{
+    self = [super init];
+    if(self){
+        reachabilityRef = SCNetworkReachabilityCreateWithName(kCFAllocatorDefault, [host UTF8String]);
+        // Resolving the host can take a while, so it's considered online
+        // until the first callback says otherwise
+        connectionType = OlapicConnectionTypeWiFi;
+        monitoring = NO;
+    }
+    return self;
+}
+/**
+ *  Start watching the connection changes
+ *
+ *  @return YES if it could start
+ */
+-(BOOL)startMonitoring{
+    if(monitoring) return YES;
+    if(!reachabilityRef) return NO;
+    SCNetworkReachabilityContext context = {0, (__bridge void *)self, NULL, NULL, NULL};
+    if(!SCNetworkReachabilitySetCallback(reachabilityRef, OlapicReachabilityCallback, &context)) return NO;
+    if(!SCNetworkReachabilitySetDispatchQueue(reachabilityRef, dispatch_get_main_queue())){
+        SCNetworkReachabilitySetCallback(reachabilityRef, NULL, NULL);
+        return NO;
+    }
+    monitoring = YES;
+    return YES;
+}
+/**
+ *  Stop watching the connection changes
+ */
+-(void)stopMonitoring{
+    if(!monitoring || !reachabilityRef) return;
+    SCNetworkReachabilitySetDispatchQueue(reachabilityRef, NULL);
+    SCNetworkReachabilitySetCallback(reachabilityRef, NULL, NULL);
+    monitoring = NO;
+}
+/**
+ *  Check if there's a connection
+ *
+ *  @return YES if the device is online
+ */
+-(BOOL)isReachable{
+    return connectionType != OlapicConnectionTypeNone;
+}
+/**
+ *  Check if the connection is cellular
+ *
+ *  @return YES if the device is on a cellular connection
+ */
+-(BOOL)isCellular{
+    return connectionType == OlapicConnectionTypeCellular;
+}
+/**
+ *  Update the connection type using the reachability flags, and post
+ *  the notification if it changed
+ *
+ *  @param flags The reachability flags
+ */
+-(void)updateWithFlags:(SCNetworkReachabilityFlags)flags{
+    OlapicConnectionType type = [OlapicReachability connectionTypeForFlags:flags];
+    if(type == connectionType) return;
+    connectionType = type;
+    [[NSNotificationCenter defaultCenter] postNotificationName:OlapicReachabilityDidChangeNotification object:self];
+}
+/**
+ *  Get the connection type for a set of reachability flags
+ *
+ *  @param flags The reachability flags
+ *
+ *  @return The connection type
+ */
++(OlapicConnectionType)connectionTypeForFlags:(SCNetworkReachabilityFlags)flags{
+    if(!(flags & kSCNetworkReachabilityFlagsReachable)) return OlapicConnectionTypeNone;
+    // A connection that has to be established first only counts if
+    // it's established automatically, without the user
+    if(flags & kSCNetworkReachabilityFlagsConnectionRequired){
+        BOOL automatic = (flags & (kSCNetworkReachabilityFlagsConnectionOnDemand | kSCNetworkReachabilityFlagsConnectionOnTraffic)) != 0;
+        if(!automatic || (flags & kSCNetworkReachabilityFlagsInterventionRequired)) return OlapicConnectionTypeNone;
+    }
+    if(flags & kSCNetworkReachabilityFlagsIsWWAN) return OlapicConnectionTypeCellular;
+    return OlapicConnectionTypeWiFi;
+}
+/**
+ *  Get a readable name for a connection type
+ *
+ *  @param type The connection type
+ *
+ *  @return The name ("none", "cellular" or "wifi")
+ */
++(NSString *)nameForConnectionType:(OlapicConnectionType)type{
+    switch(type){
+        case OlapicConnectionTypeNone:
+            return @"none";
+        case OlapicConnectionTypeCellular:
+            return @"cellular";
+        case OlapicConnectionTypeWiFi:
+            return @"wifi";
+    }
+    return @"unknown";
+}
+/**
+ *  Stop watching and release the reachability reference
+ */
+-(void)dealloc{
+    [self stopMonitoring];
+    if(reachabilityRef){
+        CFRelease(reachabilityRef);
+    }
+}
+
+@end
@@ -0,0 +1,148 @@
+//
+//  OlapicRetryPolicy.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+/**
+ *  Decides if a failed request should be tried again, and how long
+ *  to wait before doing it:
+ *
+ *  - Only the errors that can be temporary are retried: connection
+ *    problems and the 408, 429, 500, 502, 503 and 504 statuses.
+ *  - The wait grows exponentially with every attempt, and a random
+ *    value between zero and that limit is used (full jitter), so the
+ *    clients that failed together don't retry together.
+ *  - If the response has a `Retry-After` header, that time is used.
+ */
+@interface OlapicRetryPolicy : NSObject{
+    /**
+     *  The maximum number of attempts, including the first one
+     */
+    NSUInteger maximumAttempts;
+    /**
+     *  The limit for the wait after the first attempt (in seconds)
+     */
+    NSTimeInterval baseDelay;
+    /**
+     *  The maximum limit for the wait (in seconds)
+     */
+    NSTimeInterval maximumDelay;
+    /**
+     *  How much the limit grows after every attempt
+     */
+    double multiplier;
+    /**
+     *  The maximum `Retry-After` time that will be respected; if the
+     *  server asks for more, the request fails
+     */
+    NSTimeInterval maximumRetryAfter;
+    /**
+     *  The HTTP statuses that can be retried
+     */
+    NSSet *retryableStatusCodes;
+    /**
+     *  The NSURLErrorDomain codes that can be retried
+     */
+    NSSet *retryableErrorCodes;
+}
+
+@property (nonatomic) NSUInteger maximumAttempts;
+@property (nonatomic) NSTimeInterval baseDelay;
+@property (nonatomic) NSTimeInterval maximumDelay;
+@property (nonatomic) double multiplier;
+@property (nonatomic) NSTimeInterval maximumRetryAfter;
+@property (nonatomic,strong) NSSet *retryableStatusCodes;
+@property (nonatomic,strong) NSSet *retryableErrorCodes;
+/**
+ *  Get a policy with the default values
+ *
+ *  @return The policy object
+ */
++(instancetype)defaultPolicy;
+/**
+ *  Get a policy that never retries
+ *
+ *  @return The policy object
+ */
++(instancetype)noRetryPolicy;
+/**
+ *  Check if an error can be temporary
+ *
+ *  @param error The error
+ *
+ *  @return YES if trying again could work
+ */
+-(BOOL)isRetryableError:(NSError *)error;
+/**
+ *  Check if a request should be tried again
+ *
+ *  @param error   The error of the last attempt
+ *  @param attempt The number of attempts already made (starting at 1)
+ *
+ *  @return YES if it should be retried
+ */
+-(BOOL)shouldRetryError:(NSError *)error afterAttempt:(NSUInteger)attempt;
+/**
+ *  Get the time to wait before the next attempt
+ *
+ *  @param attempt The number of attempts already made (starting at 1)
+ *  @param error   The error of the last attempt
+ *
+ *  @return The time in seconds
+ */
+-(NSTimeInterval)delayAfterAttempt:(NSUInteger)attempt forError:(NSError *)error;
+/**
+ *  Find the HTTP response of a failed request
+ *
+ *  @param error The error
+ *
+ *  @return The response or nil if the request didn't get one
+ */
++(NSHTTPURLResponse *)responseForError:(NSError *)error;
+/**
+ *  Get the HTTP status of a failed request
+ *
+ *  @param error The error
+ *
+ *  @return The status or 0 if the request didn't get a response
+ */
++(NSInteger)statusCodeForError:(NSError *)error;
+/**
+ *  Read the `Retry-After` header of a failed request (in seconds
+ *  or as an HTTP date)
+ *
+ *  @param error The error
+ *
+ *  @return The time to wait in seconds, or -1 if there's no header
+ */
++(NSTimeInterval)retryAfterForError:(NSError *)error;
+
+@end
@@ -0,0 +1,188 @@
+//
+//  OlapicRetryPolicy.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+// The default values for the policy
+#define kRetryPolicyMaximumAttempts 4
+#define kRetryPolicyBaseDelay 0.5
+#define kRetryPolicyMaximumDelay 30
+#define kRetryPolicyMultiplier 2.0
+#define kRetryPolicyMaximumRetryAfter 120
+
+#import "OlapicRetryPolicy.h"
+
+@implementation OlapicRetryPolicy
+@synthesize maximumAttempts,baseDelay,maximumDelay,multiplier,maximumRetryAfter,retryableStatusCodes,retryableErrorCodes;
+/**
+ *  Get a policy with the default values
+ *
+ *  @return The policy object
+ */
++(instancetype)defaultPolicy{
+    return [[self alloc] init];
+}
+/**
+ *  Get a policy that never retries
+ *
+ *  @return The policy object
+ */
++(instancetype)noRetryPolicy{
+    OlapicRetryPolicy *policy = [[self alloc] init];
+    policy.maximumAttempts = 1;
+    return policy;
+}
+/**
+ *  Class constructor
+ *
+ *  @return An instance of this object (OlapicRetryPolicy)
+ */
+-(id)init{
+    self = [super init];
+    if(self){
+        maximumAttempts = kRetryPolicyMaximumAttempts;
+        baseDelay = kRetryPolicyBaseDelay;
+        maximumDelay = kRetryPolicyMaximumDelay;
+        multiplier = kRetryPolicyMultiplier;
+        maximumRetryAfter = kRetryPolicyMaximumRetryAfter;
+        retryableStatusCodes = [NSSet setWithObjects:@408, @429, @500, @502, @503, @504, nil];
+        retryableErrorCodes = [NSSet setWithObjects:
+                               @(NSURLErrorTimedOut),
+                               @(NSURLErrorCannotFindHost),
+                               @(NSURLErrorCannotConnectToHost),
+                               @(NSURLErrorNetworkConnectionLost),
+                               @(NSURLErrorDNSLookupFailed),
+                               @(NSURLErrorNotConnectedToInternet),
+                               @(NSURLErrorBadServerResponse),
+                               @(NSURLErrorSecureConnectionFailed),
+                               nil];
+    }
+    return self;
+}
+/**
+ *  Check if an error can be temporary
+ *
+ *  @param error The error
+ *
+ *  @return YES if trying again could work
+ */
+-(BOOL)isRetryableError:(NSError *)error{
+    if(!error) return NO;
+    NSInteger status = [OlapicRetryPolicy statusCodeForError:error];
+    if(status > 0) return [retryableStatusCodes containsObject:@(status)];
+    if([[error domain] isEqualToString:NSURLErrorDomain]){
+        return [retryableErrorCodes containsObject:@([error code])];
+    }
+    NSError *underlying = [[error userInfo] objectForKey:NSUnderlyingErrorKey];
+    return underlying ? [self isRetryableError:underlying] : NO;
+}
+/**
+ *  Check if a request should be tried again
+ *
+ *  @param error   The error of the last attempt
+ *  @param attempt The number of attempts already made (starting at 1)
+ *
+ *  @return YES if it should be retried
+ */
+-(BOOL)shouldRetryError:(NSError *)error afterAttempt:(NSUInteger)attempt{
+    if(attempt >= maximumAttempts || ![self isRetryableError:error]) return NO;
+    // Waiting more than that is worse than failing
+    return [OlapicRetryPolicy retryAfterForError:error] <= maximumRetryAfter;
+}
+/**
+ *  Get the time to wait before the next attempt
+ *
+ *  @param attempt The number of attempts already made (starting at 1)
+ *  @param error   The error of the last attempt
+ *
+ *  @return The time in seconds
+ */
+-(NSTimeInterval)delayAfterAttempt:(NSUInteger)attempt forError:(NSError *)error{
+    NSTimeInterval retryAfter = [OlapicRetryPolicy retryAfterForError:error];
+    if(retryAfter >= 0) return MIN(retryAfter, maximumRetryAfter);
+    NSTimeInterval limit = MIN(maximumDelay, baseDelay * pow(multiplier, (double)(attempt - 1)));
+    return limit * ((double)arc4random() / (double)UINT32_MAX);
+}
+/**
+ *  Find the HTTP response of a failed request
+ *
+ *  @param error The error
+ *
+ *  @return The response or nil if the request didn't get one
+ */
++(NSHTTPURLResponse *)responseForError:(NSError *)error{
+    if(!error) return nil;
+    // The transport saves it on the user info, with a key that depends on its version
+    for(id value in [[error userInfo] allValues]){
+        if([value isKindOfClass:[NSHTTPURLResponse class]]) return value;
+    }
+    return [OlapicRetryPolicy responseForError:[[error userInfo] objectForKey:NSUnderlyingErrorKey]];
+}
+/**
+ *  Get the HTTP status of a failed request
+ *
+ *  @param error The error
+ *
+ *  @return The status or 0 if the request didn't get a response
+ */
++(NSInteger)statusCodeForError:(NSError *)error{
+    return [[OlapicRetryPolicy responseForError:error] statusCode];
+}
+/**
+ *  Read the `Retry-After` header of a failed request (in seconds
+ *  or as an HTTP date)
+ *
+ *  @param error The error
+ *
+ *  @return The time to wait in seconds, or -1 if there's no header
+ */
++(NSTimeInterval)retryAfterForError:(NSError *)error{
+    NSDictionary *headers = [[OlapicRetryPolicy responseForError:error] allHeaderFields];
+    NSString *value = nil;
+    for(NSString *name in headers){
+        if([name caseInsensitiveCompare:@"Retry-After"] == NSOrderedSame){
+            value = [headers objectForKey:name];
+            break;
+        }
+    }
+    if(!value) return -1;
+    NSScanner *scanner = [NSScanner scannerWithString:value];
+    double seconds = 0;
+    if([scanner scanDouble:&seconds] && [scanner isAtEnd]) return MAX(0, seconds);
+    NSDateFormatter *formatter = [[NSDateFormatter alloc] init];
+    formatter.locale = [[NSLocale alloc] initWithLocaleIdentifier:@"en_US_POSIX"];
+    formatter.timeZone = [NSTimeZone timeZoneWithAbbreviation:@"GMT"];
+    formatter.dateFormat = @"EEE, dd MMM yyyy HH:mm:ss zzz";
+    NSDate *date = [formatter dateFromString:value];
+    if(!date) return -1;
+    return MAX(0, [date timeIntervalSinceNow]);
+}
+
+@end
@@ -0,0 +1,110 @@
+//
+//  OlapicTokenBucket.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+/**
+ *  A token bucket: it holds up to `capacity` tokens and gets `refillRate`
+ *  new tokens per second. Every request takes a token, so a burst can
+ *  use the whole bucket, but the sustained rate is the refill rate.
+ *
+ *  The bucket can also be paused (with no tokens) until a moment, when
+ *  the server says the limit was reached.
+ *
+ *  All the methods can be called from any thread.
+ */
+@interface OlapicTokenBucket : NSObject{
+    /**
+     *  The maximum number of tokens
+     */
+    double capacity;
+    /**
+     *  The number of tokens added every second
+     */
+    double refillRate;
+    /**
+     *  The current number of tokens
+     */
+    double tokens;
+    /**
+     *  The last time the tokens were refilled
+     */
+    NSTimeInterval lastRefill;
+    /**
+     *  The moment until which no tokens are given
+     */
+    NSDate *pausedUntil;
+}
+
+@property (nonatomic) double capacity;
+@property (nonatomic) double refillRate;
+@property (nonatomic,strong,readonly) NSDate *pausedUntil;
+/**
+ *  Class constructor. The bucket starts full
+ *
+ *  @param maximum The maximum number of tokens
+ *  @param rate    The number of tokens added every second
+ *
+ *  @return An instance of this object (OlapicTokenBucket)
+ */
+-(id)initWithCapacity:(double)maximum refillRate:(double)rate;
+/**
+ *  Get the current number of tokens
+ *
+ *  @return The number of tokens (it can have decimals)
+ */
+-(double)tokens;
+/**
+ *  Take a token, if there's one
+ *
+ *  @return YES if a token was taken
+ */
+-(BOOL)consumeToken;
+/**
+ *  Get the time until there's a token
+ *
+ *  @return The time in seconds (0 if there's one now)
+ */
+-(NSTimeInterval)timeUntilToken;
+/**
+ *  Limit the tokens to the number the server says are remaining
+ *
+ *  @param remaining The remaining requests
+ */
+-(void)limitToRemaining:(double)remaining;
+/**
+ *  Empty the bucket and stop giving tokens until a moment
+ *
+ *  @param date The moment the tokens are given again
+ */
+-(void)pauseUntil:(NSDate *)date;
+
+@end
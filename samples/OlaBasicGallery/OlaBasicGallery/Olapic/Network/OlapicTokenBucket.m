@@ -0,0 +1,197 @@
+//
+//  OlapicTokenBucket.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "OlapicTokenBucket.h"
+
+@interface OlapicTokenBucket()
+/**
+ *  Add the tokens generated since the last refill. It must be called
+ *  with the lock taken
+ */
+-(void)refill;
+
+@end
+
+@implementation OlapicTokenBucket
+/**
+ *  Class constructor. The bucket starts full
+ *
+ *  @param maximum The maximum number of tokens
+ *  @param rate    The number of tokens added every second
+ *
+ *  @return An instance of this object (OlapicTokenBucket)
+ */
+-(id)initWithCapacity:(double)maximum refillRate:(double)rate{
+    self = [super init];
+    if(self){
+        capacity = MAX(1, maximum);
+        refillRate = MAX(0.01, rate);
+        tokens = capacity;
+        lastRefill = [NSDate timeIntervalSinceReferenceDate];
+    }
+    return self;
+}
+/**
+ *  Get the maximum number of tokens
+ *
+ *  @return The capacity
+ */
+-(double)capacity{
+    @synchronized(self){
+        return capacity;
+    }
+}
+/**
+ *  Change the maximum number of tokens. The tokens over the new
+ *  capacity are dropped
+ *
+ *  @param maximum The maximum number of tokens
+ */
+-(void)setCapacity:(double)maximum{
+    @synchronized(self){
+        [self refill];
+        capacity = MAX(1, maximum);
+        tokens = MIN(tokens, capacity);
+    }
+}
+/**
+ *  Get the number of tokens added every second
+ *
+ *  @return The refill rate
+ */
+-(double)refillRate{
+    @synchronized(self){
+        return refillRate;
+    }
+}
+/**
+ *  Change the number of tokens added every second. The tokens
+ *  generated until now use the previous rate
+ *
+ *  @param rate The number of tokens added every second
+ */
+-(void)setRefillRate:(double)rate{
+    @synchronized(self){
+        [self refill];
+        refillRate = MAX(0.01, rate);
+    }
+}
+/**
+ *  Get the moment until which no tokens are given
+ *
+ *  @return The date or nil if the bucket is not paused
+ */
+-(NSDate *)pausedUntil{
+    @synchronized(self){
+        [self refill];
+        return pausedUntil;
+    }
+}
+/**
+ *  Get the current number of tokens
+ *
+ *  @return The number of tokens (it can have decimals)
+ */
+-(double)tokens{
+    @synchronized(self){
+        [self refill];
+        return tokens;
+    }
+}
+/**
+ *  Take a token, if there's one
+ *
+ *  @return YES if a token was taken
+ */
+-(BOOL)consumeToken{
+    @synchronized(self){
+        [self refill];
+        if(tokens < 1) return NO;
+        tokens -= 1;
+        return YES;
+    }
+}
+/**
+ *  Get the time until there's a token
+ *
+ *  @return The time in seconds (0 if there's one now)
+ */
+-(NSTimeInterval)timeUntilToken{
+    @synchronized(self){
+        [self refill];
+        if(pausedUntil) return MAX(0, [pausedUntil timeIntervalSinceNow]);
+        if(tokens >= 1) return 0;
+        return (1 - tokens) / refillRate;
+    }
+}
+/**
+ *  Limit the tokens to the number the server says are remaining
+ *
+ *  @param remaining The remaining requests
+ */
+-(void)limitToRemaining:(double)remaining{
+    @synchronized(self){
+        [self refill];
+        tokens = MAX(0, MIN(tokens, remaining));
+    }
+}
+/**
+ *  Empty the bucket and stop giving tokens until a moment
+ *
+ *  @param date The moment the tokens are given again
+ */
+-(void)pauseUntil:(NSDate *)date{
+    @synchronized(self){
+        tokens = 0;
+        if(!pausedUntil || [date compare:pausedUntil] == NSOrderedDescending){
+            pausedUntil = date;
+        }
+        lastRefill = [NSDate timeIntervalSinceReferenceDate];
+    }
+}
+/**
+ *  Add the tokens generated since the last refill. It must be called
+ *  with the lock taken
+ */
+-(void)refill{
+    NSTimeInterval now = [NSDate timeIntervalSinceReferenceDate];
+    if(pausedUntil){
+        if([pausedUntil timeIntervalSinceReferenceDate] > now) return;
+        // The pause ended: the tokens are generated from that moment
+        lastRefill = [pausedUntil timeIntervalSinceReferenceDate];
+        pausedUntil = nil;
+    }
+    tokens = MIN(capacity, tokens + ((now - lastRefill) * refillRate));
+    lastRefill = now;
+}
+
+@end
@@ -0,0 +1,91 @@
+//
+//  OlapicCachedKeychainItem.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <OlapicSDK/KeychainItemWrapper.h>
+/**
+ *  A keychain item that keeps the values of another one in memory, so
+ *  the SDK doesn't query the keychain on every request:
+ *
+ *  - It wraps the keychain item the SDK already created, and every
+ *    keychain access is delegated to it.
+ *  - The values and the data dictionary are read from the wrapped item
+ *    only the first time, and the following reads come from memory.
+ *  - The changes are applied in memory right away, and written to the
+ *    wrapped item on a background queue, in the same order they were made.
+ *    A change of a value forgets the data dictionary, and a change of the
+ *    data dictionary forgets the values, as both are on the same item.
+ *  - Resetting the item clears the memory and the keychain.
+ *
+ *  It can be used from any thread.
+ */
+@interface OlapicCachedKeychainItem : KeychainItemWrapper{
+    /**
+     *  The keychain item that reads and writes the keychain
+     */
+    KeychainItemWrapper *keychainItem;
+    /**
+     *  The values read or written, by key. A value that's not on the
+     *  keychain is saved as NSNull
+     */
+    NSMutableDictionary *values;
+    /**
+     *  The data dictionary, or nil if it wasn't read yet
+     */
+    NSDictionary *dataDictionary;
+    /**
+     *  The serial queue for the keychain writes
+     */
+    dispatch_queue_t writeQueue;
+}
+/**
+ *  The keychain item that reads and writes the keychain
+ */
+@property (nonatomic,strong,readonly) KeychainItemWrapper *keychainItem;
+/**
+ *  Class constructor
+ *
+ *  @param item The keychain item to wrap
+ *
+ *  @return An instance of this object (OlapicCachedKeychainItem)
+ */
+-(id)initWithKeychainItem:(KeychainItemWrapper *)item;
+/**
+ *  Wait until all the pending writes are on the keychain
+ */
+-(void)flush;
+/**
+ *  Forget the values in memory, so the next reads go to the keychain
+ */
+-(void)invalidate;
+
+@end
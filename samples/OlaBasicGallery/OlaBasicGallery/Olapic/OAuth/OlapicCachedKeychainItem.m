@@ -0,0 +1,217 @@
+//
+//  OlapicCachedKeychainItem.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "OlapicCachedKeychainItem.h"
+
+// The key to know if the code is running on the write queue
+static void *kCachedKeychainItemQueueKey = &kCachedKeychainItemQueueKey;
+
+@interface OlapicCachedKeychainItem()
+/**
+ *  Run a write on the background queue (or right away, if it's already
+ *  running on it)
+ *
+ *  @param write The block that writes to the keychain
+ */
+-(void)enqueueWrite:(void (^)(void))write;
+
+@end
+
+@implementation OlapicCachedKeychainItem
+
+@synthesize keychainItem;
+/**
+ *  Class constructor
+ *
+ *  @param item The keychain item to wrap
+ *
+ *  @return An instance of this object (OlapicCachedKeychainItem)
+ */
+-(id)initWithKeychainItem:(KeychainItemWrapper *)item{
+    // The wrapped item owns the keychain data, so the wrapper constructor is not called
+    self = [super init];
+    if(self){
+        keychainItem = item;
+        values = [[NSMutableDictionary alloc] init];
+        dataDictionary = nil;
+        writeQueue = dispatch_queue_create("com.olapic.keychain.write", DISPATCH_QUEUE_SERIAL);
+        dispatch_queue_set_specific(writeQueue, kCachedKeychainItemQueueKey, kCachedKeychainItemQueueKey, NULL);
+    }
+    return self;
+}
+/**
+ *  Class constructor, wrapping a new keychain item
+ *
+ *  @param identifier  The keychain item identifier
+ *  @param accessGroup The keychain access group (nil for the app group)
+ *
+ *  @return An instance of this object (OlapicCachedKeychainItem)
+ */
+-(id)initWithIdentifier:(NSString *)identifier accessGroup:(NSString *)accessGroup{
+    return [self initWithKeychainItem:[[KeychainItemWrapper alloc] initWithIdentifier:identifier accessGroup:accessGroup]];
+}
+/**
+ *  Get a value, from memory if it was already read
+ *
+ *  @param key The value key
+ *
+ *  @return The value or nil if it's not saved
+ */
+-(id)objectForKey:(id)key{
+    if(!key) return nil;
+    id value = nil;
+    @synchronized(self){
+        value = [values objectForKey:key];
+    }
+    if(!value){
+        // The first read waits for the pending writes, so it gets the last value.
+        // The lock is not held while waiting, as the writes can read
+        [self flush];
+        value = [keychainItem objectForKey:key];
+        if(!value) value = [NSNull null];
+        @synchronized(self){
+            // A write that happened meanwhile wins
+            if(values && ![values objectForKey:key]){
+                [values setObject:value forKey:key];
+            }
+            if([values objectForKey:key]) value = [values objectForKey:key];
+        }
+    }
+    return value == [NSNull null] ? nil : value;
+}
+/**
+ *  Save a value in memory and schedule the keychain write
+ *
+ *  @param inObject The value
+ *  @param key      The value key
+ */
+-(void)setObject:(id)inObject forKey:(id)key{
+    if(!key) return;
+    @synchronized(self){
+        [values setObject:(inObject ? inObject : [NSNull null]) forKey:key];
+        // The data dictionary is on the same item, so it's read again after the write
+        dataDictionary = nil;
+    }
+    [self enqueueWrite:^{
+        [keychainItem setObject:inObject forKey:key];
+    }];
+}
+/**
+ *  Get the data dictionary, from memory if it was already read
+ *
+ *  @return The data dictionary
+ */
+-(NSDictionary *)getDataDictionary{
+    NSDictionary *dictionary = nil;
+    @synchronized(self){
+        dictionary = dataDictionary;
+    }
+    if(!dictionary){
+        [self flush];
+        dictionary = [[keychainItem getDataDictionary] copy];
+        if(!dictionary) dictionary = @{};
+        @synchronized(self){
+            if(!dataDictionary) dataDictionary = dictionary;
+            dictionary = dataDictionary;
+        }
+    }
+    return dictionary;
+}
+/**
+ *  Save the data dictionary in memory and schedule the keychain write
+ *
+ *  @param dict The data dictionary
+ */
+-(void)saveDataDictionary:(NSDictionary *)dict{
+    NSDictionary *saved = dict ? [dict copy] : @{};
+    @synchronized(self){
+        dataDictionary = saved;
+        // The values are on the same item, so they're read again after the write
+        [values removeAllObjects];
+    }
+    [self enqueueWrite:^{
+        [keychainItem saveDataDictionary:saved];
+    }];
+}
+/**
+ *  Clear the values in memory and reset the keychain item. The reset
+ *  is not written behind, so the next read can't get the old values
+ */
+-(void)resetKeychainItem{
+    [self invalidate];
+    if(dispatch_get_specific(kCachedKeychainItemQueueKey)){
+        [keychainItem resetKeychainItem];
+        return;
+    }
+    dispatch_sync(writeQueue, ^{
+        [keychainItem resetKeychainItem];
+    });
+}
+/**
+ *  Make the item accessible after the first unlock, after the pending writes
+ */
+-(void)makeAccessibleAtUnlock{
+    [self enqueueWrite:^{
+        [keychainItem makeAccessibleAtUnlock];
+    }];
+}
+/**
+ *  Wait until all the pending writes are on the keychain
+ */
+-(void)flush{
+    if(dispatch_get_specific(kCachedKeychainItemQueueKey)) return;
+    dispatch_sync(writeQueue, ^{});
+}
+/**
+ *  Forget the values in memory, so the next reads go to the keychain
+ */
+-(void)invalidate{
+    @synchronized(self){
+        [values removeAllObjects];
+        dataDictionary = nil;
+    }
+}
+/**
+ *  Run a write on the background queue (or right away, if it's already
+ *  running on it)
+ *
+ *  @param write The block that writes to the keychain
+ */
+-(void)enqueueWrite:(void (^)(void))write{
+    if(dispatch_get_specific(kCachedKeychainItemQueueKey)){
+        write();
+        return;
+    }
+    dispatch_async(writeQueue, write);
+}
+
+@end
@@ -0,0 +1,124 @@
+//
+//  OlapicCachedOAuthForSecretKey.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "OlapicCachedOAuthForSecretKey.h"
+
+@interface OlapicCachedOAuthForSecretKey()
+/**
+ *  Make sure the keychain object is the cached one, wrapping the one
+ *  the SDK created
+ *
+ *  @return The cached keychain item (nil if the SDK has no keychain item)
+ */
+-(OlapicCachedKeychainItem *)cachedKeychain;
+/**
+ *  Write the pending changes before the app is suspended
+ *
+ *  @param notification The notification object
+ */
+-(void)applicationDidEnterBackground:(NSNotification *)notification;
+
+@end
+
+@implementation OlapicCachedOAuthForSecretKey
+/**
+ *  Class constructor
+ *
+ *  @param client The client ID
+ *  @param secret The secret key
+ *
+ *  @return An instance of this object (OlapicCachedOAuthForSecretKey)
+ */
+-(id)initWithClientId:(NSString *)client andSecretKey:(NSString *)secret{
+    self = [super initWithClientId:client andSecretKey:secret];
+    if(self){
+        [self cachedKeychain];
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(applicationDidEnterBackground:) name:UIApplicationDidEnterBackgroundNotification object:nil];
+    }
+    return self;
+}
+/**
+ *  Get the keychain object, making sure it's the cached one
+ *
+ *  @return The keychain object
+ */
+-(KeychainItemWrapper *)getKeychain{
+    return [self cachedKeychain];
+}
+/**
+ *  Make sure the keychain object is the cached one, wrapping the one
+ *  the SDK created
+ *
+ *  @return The cached keychain item (nil if the SDK has no keychain item)
+ */
+-(OlapicCachedKeychainItem *)cachedKeychain{
+    if(![keychain isKindOfClass:[OlapicCachedKeychainItem class]]){
+        // The SDK creates its own keychain item, the cache only goes on top of it
+        KeychainItemWrapper *item = keychain ? keychain : [super getKeychain];
+        if(!item) return nil;
+        if(![item isKindOfClass:[OlapicCachedKeychainItem class]]){
+            item = [[OlapicCachedKeychainItem alloc] initWithKeychainItem:item];
+        }
+        keychain = item;
+    }
+    return (OlapicCachedKeychainItem *)keychain;
+}
+/**
+ *  Clear the saved credentials, from memory and from the keychain
+ */
+-(void)clearCache{
+    [super clearCache];
+    // The SDK could have cleared the keychain without resetting the item
+    [[self cachedKeychain] invalidate];
+}
+/**
+ *  Wait until the credentials are on the keychain
+ */
+-(void)flush{
+    [[self cachedKeychain] flush];
+}
+/**
+ *  Write the pending changes before the app is suspended
+ *
+ *  @param notification The notification object
+ */
+-(void)applicationDidEnterBackground:(NSNotification *)notification{
+    [self flush];
+}
+/**
+ *  Remove the observer
+ */
+-(void)dealloc{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+@end
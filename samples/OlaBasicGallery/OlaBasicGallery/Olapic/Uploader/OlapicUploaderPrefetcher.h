@@ -0,0 +1,109 @@
+//
+//  OlapicUploaderPrefetcher.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <UIKit/UIKit.h>
+#import <OlapicSDK/OlapicSDK.h>
+/**
+ *  Gets the uploaders of a page of media before the detail views need
+ *  them, so the uploader information is already there when the user
+ *  swipes to a photo:
+ *
+ *  - The media that share an uploader only need one request, and the
+ *    uploaders the media already have embedded don't need any.
+ *  - The rest of the uploaders are requested together with an
+ *    OlapicBulkRequest (a single round trip). If the bulk request
+ *    fails, they are requested one by one.
+ *  - The avatars are downloaded with OlapicImageLoader and resized on a
+ *    background queue to the size of the detail view, and the resized
+ *    version is saved on the image cache.
+ *
+ *  This object should be used from the main thread, and the
+ *  callbacks are always called on the main thread.
+ */
+@interface OlapicUploaderPrefetcher : NSObject{
+    /**
+     *  The size the avatars are shown with
+     */
+    CGSize avatarSize;
+    /**
+     *  The uploaders already resolved, by URL
+     */
+    NSCache *uploaders;
+    /**
+     *  The uploaders being requested, by URL. Each one is a dictionary
+     *  with the media waiting for it and the handlers
+     */
+    NSMutableDictionary *pending;
+}
+
+@property (nonatomic) CGSize avatarSize;
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared prefetcher
+ */
++(instancetype)sharedPrefetcher;
+/**
+ *  Get the uploaders (and their avatars) of a group of media, with as
+ *  few requests as possible. The uploaders are set on the media objects
+ *
+ *  @param media An array of OlapicMediaEntity objects
+ */
+-(void)prefetchUploadersForMedia:(NSArray *)media;
+/**
+ *  Get the uploader of a media. If it was already prefetched, or it's
+ *  being prefetched, no new request is made
+ *
+ *  @param media   The media object
+ *  @param success A callback with the uploader
+ *  @param failure A callback for when the uploader can't be loaded
+ */
+-(void)getUploaderForMedia:(OlapicMediaEntity *)media onSuccess:(void (^)(OlapicUploaderEntity *uploader))success onFailure:(void (^)(NSError *error))failure;
+/**
+ *  Get the avatar of an uploader, resized to the avatar size
+ *
+ *  @param uploader The uploader object
+ *  @param success  A callback with the resized avatar
+ *  @param failure  A callback for when the avatar can't be loaded
+ */
+-(void)loadAvatarForUploader:(OlapicUploaderEntity *)uploader onSuccess:(void (^)(UIImage *avatar))success onFailure:(void (^)(NSError *error))failure;
+/**
+ *  Get the URL of the uploader of a media
+ *
+ *  @param media The media object
+ *
+ *  @return The uploader URL or nil
+ */
++(NSString *)uploaderURLForMedia:(OlapicMediaEntity *)media;
+
+@end
@@ -0,0 +1,383 @@
+//
+//  OlapicUploaderPrefetcher.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+// The limit of requests on a single bulk request
+#define kUploaderPrefetcherBulkLimit 20
+
+#import "OlapicUploaderPrefetcher.h"
+#import "OlapicEntityIdentityMap.h"
+#import "OlapicMediaListSync.h"
+#import "OlapicImageLoader.h"
+#import "OlapicAsyncImageView.h"
+
+@interface OlapicUploaderPrefetcher()
+/**
+ *  Get the uploader a media already has embedded
+ *
+ *  @param media The media object
+ *
+ *  @return The uploader object or nil if the media doesn't have its data
+ */
+-(OlapicUploaderEntity *)embeddedUploaderForMedia:(OlapicMediaEntity *)media;
+/**
+ *  Add a media (and a handler) to the ones waiting for an uploader
+ *
+ *  @param media   The media object
+ *  @param URL     The uploader URL
+ *  @param handler A block to call with the uploader or the error (it can be nil)
+ *
+ *  @return YES if the uploader needs to be requested
+ */
+-(BOOL)waitForUploaderWithURL:(NSString *)URL media:(OlapicMediaEntity *)media handler:(void (^)(OlapicUploaderEntity *uploader, NSError *error))handler;
+/**
+ *  Request a group of uploaders. More than one go on bulk requests
+ *
+ *  @param URLs The uploader URLs
+ */
+-(void)fetchUploaderURLs:(NSArray *)URLs;
+/**
+ *  Request a single uploader
+ *
+ *  @param URL The uploader URL
+ */
+-(void)fetchUploaderURL:(NSString *)URL;
+/**
+ *  Set the uploader on the media waiting for it and call the handlers
+ *
+ *  @param uploader The uploader object (or nil, if it failed)
+ *  @param error    The error, if it failed
+ *  @param URL      The uploader URL
+ */
+-(void)finishUploader:(OlapicUploaderEntity *)uploader error:(NSError *)error forURL:(NSString *)URL;
+/**
+ *  Read the uploader data from a response of a bulk request
+ *
+ *  @param item  The response
+ *  @param error Set when the request failed or the response doesn't have the bulk format
+ *
+ *  @return The uploader data or nil if the request failed
+ */
++(NSDictionary *)uploaderDataFromBulkResponse:(id)item error:(NSError **)error;
+
+@end
+
+@implementation OlapicUploaderPrefetcher
+@synthesize avatarSize;
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared prefetcher
+ */
++(instancetype)sharedPrefetcher{
+    static OlapicUploaderPrefetcher *sharedPrefetcher = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedPrefetcher = [[OlapicUploaderPrefetcher alloc] init];
+    });
+    return sharedPrefetcher;
+}
+/**
+ *  Class constructor
+ *
+ *  @return An instance of this object (OlapicUploaderPrefetcher)
+ */
+-(id)init{
+    self = [super init];
+    if(self){
+        // The size of the avatar on the detail view
+        avatarSize = CGSizeMake(54, 54);
+        uploaders = [[NSCache alloc] init];
+        pending = [[NSMutableDictionary alloc] init];
+    }
+    return self;
+}
+/**
+ *  Get the uploaders (and their avatars) of a group of media, with as
+ *  few requests as possible. The uploaders are set on the media objects
+ *
+ *  @param media An array of OlapicMediaEntity objects
+ */
+-(void)prefetchUploadersForMedia:(NSArray *)media{
+    NSMutableArray *URLs = [[NSMutableArray alloc] init];
+    for(int i = 0; i < [media count]; i++){
+        OlapicMediaEntity *item = [media objectAtIndex:i];
+        if(item.uploader){
+            [self loadAvatarForUploader:item.uploader onSuccess:nil onFailure:nil];
+            continue;
+        }
+        OlapicUploaderEntity *embedded = [self embeddedUploaderForMedia:item];
+        NSString *URL = [OlapicUploaderPrefetcher uploaderURLForMedia:item];
+        OlapicUploaderEntity *known = embedded ? embedded : (URL ? [uploaders objectForKey:URL] : nil);
+        if(known){
+            item.uploader = known;
+            [self loadAvatarForUploader:known onSuccess:nil onFailure:nil];
+            continue;
+        }
+        if(URL && [self waitForUploaderWithURL:URL media:item handler:nil]){
+            [URLs addObject:URL];
+        }
+    }
+    [self fetchUploaderURLs:URLs];
+}
+/**
+ *  Get the uploader of a media. If it was already prefetched, or it's
+ *  being prefetched, no new request is made
+ *
+ *  @param media   The media object
+ *  @param success A callback with the uploader
+ *  @param failure A callback for when the uploader can't be loaded
+ */
+-(void)getUploaderForMedia:(OlapicMediaEntity *)media onSuccess:(void (^)(OlapicUploaderEntity *uploader))success onFailure:(void (^)(NSError *error))failure{
+    OlapicUploaderEntity *known = media.uploader ? media.uploader : [self embeddedUploaderForMedia:media];
+    NSString *URL = [OlapicUploaderPrefetcher uploaderURLForMedia:media];
+    if(!known && URL){
+        known = [uploaders objectForKey:URL];
+    }
+    if(known){
+        media.uploader = known;
+        if(success) success(known);
+        return;
+    }
+    if(!URL){
+        // There's no link to follow, so the SDK has to find it
+        [media getUploader:^(OlapicUploaderEntity *uploader){
+            media.uploader = [[OlapicEntityIdentityMap sharedIdentityMap] resolveEntity:uploader];
+            if(success) success(media.uploader);
+        } onFailure:failure];
+        return;
+    }
+    BOOL request = [self waitForUploaderWithURL:URL media:media handler:^(OlapicUploaderEntity *uploader, NSError *error){
+        if(uploader){
+            if(success) success(uploader);
+        }else if(failure){
+            failure(error);
+        }
+    }];
+    if(request){
+        [self fetchUploaderURL:URL];
+    }
+}
+/**
+ *  Get the avatar of an uploader, resized to the avatar size
+ *
+ *  @param uploader The uploader object
+ *  @param success  A callback with the resized avatar
+ *  @param failure  A callback for when the avatar can't be loaded
+ */
+-(void)loadAvatarForUploader:(OlapicUploaderEntity *)uploader onSuccess:(void (^)(UIImage *avatar))success onFailure:(void (^)(NSError *error))failure{
+    id URL = [uploader get:@"avatar_url"];
+    if(![URL isKindOfClass:[NSString class]]){
+        if(failure) failure([NSError errorWithDomain:@"OlapicUploaderPrefetcher" code:0 userInfo:@{NSLocalizedDescriptionKey: @"The uploader doesn't have an avatar"}]);
+        return;
+    }
+    CGSize size = avatarSize;
+    NSString *key = [OlapicAsyncImageView cacheKeyForURL:URL resizedTo:size];
+    OlapicImageCache *cache = [[OlapicImageLoader sharedImageLoader] cache];
+    UIImage *cached = [cache imageForKey:key];
+    if(cached){
+        if(success) success(cached);
+        return;
+    }
+    [[OlapicImageLoader sharedImageLoader] loadImageFromURL:URL onSuccess:^(UIImage *image){
+        dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+            UIImage *avatar = [OlapicAsyncImageView resizeImage:image to:size detectingRetina:YES];
+            dispatch_async(dispatch_get_main_queue(), ^{
+                // Only the resized version is kept
+                [cache setImage:avatar forKey:key];
+                [cache removeImageForKey:URL];
+                if(success) success(avatar);
+            });
+        });
+    } onFailure:failure];
+}
+/**
+ *  Get the URL of the uploader of a media
+ *
+ *  @param media The media object
+ *
+ *  @return The uploader URL or nil
+ */
++(NSString *)uploaderURLForMedia:(OlapicMediaEntity *)media{
+    NSDictionary *data = [media data];
+    NSString *URL = [OlapicMediaListSync URLFromLink:[data valueForKeyPath:@"_links.uploader"]];
+    if(!URL){
+        URL = [OlapicMediaListSync URLFromLink:[data valueForKeyPath:@"_embedded.uploader._links.self"]];
+    }
+    return URL;
+}
+
+#pragma mark - Requests
+/**
+ *  Get the uploader a media already has embedded
+ *
+ *  @param media The media object
+ *
+ *  @return The uploader object or nil if the media doesn't have its data
+ */
+-(OlapicUploaderEntity *)embeddedUploaderForMedia:(OlapicMediaEntity *)media{
+    id data = [[media data] valueForKeyPath:@"_embedded.uploader"];
+    // Some responses only embed the links
+    if(![data isKindOfClass:[NSDictionary class]] || ![data objectForKey:@"name"]) return nil;
+    OlapicUploaderEntity *uploader = [[OlapicEntityIdentityMap sharedIdentityMap] resolveEntity:[[OlapicUploaderEntity alloc] initWithData:data]];
+    NSString *URL = [OlapicUploaderPrefetcher uploaderURLForMedia:media];
+    if(URL){
+        [uploaders setObject:uploader forKey:URL];
+    }
+    return uploader;
+}
+/**
+ *  Add a media (and a handler) to the ones waiting for an uploader
+ *
+ *  @param media   The media object
+ *  @param URL     The uploader URL
+ *  @param handler A block to call with the uploader or the error (it can be nil)
+ *
+ *  @return YES if the uploader needs to be requested
+ */
+-(BOOL)waitForUploaderWithURL:(NSString *)URL media:(OlapicMediaEntity *)media handler:(void (^)(OlapicUploaderEntity *uploader, NSError *error))handler{
+    NSMutableDictionary *waiting = [pending objectForKey:URL];
+    BOOL request = NO;
+    if(!waiting){
+        waiting = [[NSMutableDictionary alloc] init];
+        [waiting setObject:[[NSMutableArray alloc] init] forKey:@"media"];
+        [waiting setObject:[[NSMutableArray alloc] init] forKey:@"handlers"];
+        [pending setObject:waiting forKey:URL];
+        request = YES;
+    }
+    if(media) [[waiting objectForKey:@"media"] addObject:media];
+    if(handler) [[waiting objectForKey:@"handlers"] addObject:[handler copy]];
+    return request;
+}
+/**
+ *  Request a group of uploaders. More than one go on bulk requests
+ *
+ *  @param URLs The uploader URLs
+ */
+-(void)fetchUploaderURLs:(NSArray *)URLs{
+    if([URLs count] == 0) return;
+    if([URLs count] == 1){
+        [self fetchUploaderURL:[URLs firstObject]];
+        return;
+    }
+    NSDictionary *defaults = [[[OlapicSDK sharedOlapicSDK] rest] getDefaultParametersForBulkRequestsToTheAPI];
+    for(NSUInteger start = 0; start < [URLs count]; start += kUploaderPrefetcherBulkLimit){
+        NSArray *batch = [URLs subarrayWithRange:NSMakeRange(start, MIN((NSUInteger)kUploaderPrefetcherBulkLimit, [URLs count] - start))];
+        OlapicBulkRequest *bulk = [[[OlapicSDK sharedOlapicSDK] uploaders] getBulkRequest];
+        for(int i = 0; i < [batch count]; i++){
+            [bulk addRequestToURL:[batch objectAtIndex:i] withParameters:defaults];
+        }
+        [bulk process:^(NSArray *responses){
+            for(int i = 0; i < [batch count]; i++){
+                NSString *URL = [batch objectAtIndex:i];
+                NSError *error = nil;
+                NSDictionary *data = [OlapicUploaderPrefetcher uploaderDataFromBulkResponse:(i < [responses count] ? [responses objectAtIndex:i] : nil) error:&error];
+                if(data){
+                    OlapicUploaderEntity *uploader = [[[OlapicSDK sharedOlapicSDK] uploaders] createEntityFromJSON:data];
+                    [self finishUploader:[[OlapicEntityIdentityMap sharedIdentityMap] resolveEntity:uploader] error:nil forURL:URL];
+                }else{
+                    [self finishUploader:nil error:error forURL:URL];
+                }
+            }
+        } onFailure:^(NSError *error){
+            for(int i = 0; i < [batch count]; i++){
+                [self fetchUploaderURL:[batch objectAtIndex:i]];
+            }
+        }];
+    }
+}
+/**
+ *  Request a single uploader
+ *
+ *  @param URL The uploader URL
+ */
+-(void)fetchUploaderURL:(NSString *)URL{
+    [[[OlapicSDK sharedOlapicSDK] uploaders] getUploaderFromURL:URL onSuccess:^(OlapicUploaderEntity *uploader){
+        [self finishUploader:[[OlapicEntityIdentityMap sharedIdentityMap] resolveEntity:uploader] error:nil forURL:URL];
+    } onFailure:^(NSError *error){
+        [self finishUploader:nil error:error forURL:URL];
+    }];
+}
+/**
+ *  Set the uploader on the media waiting for it and call the handlers
+ *
+ *  @param uploader The uploader object (or nil, if it failed)
+ *  @param error    The error, if it failed
+ *  @param URL      The uploader URL
+ */
+-(void)finishUploader:(OlapicUploaderEntity *)uploader error:(NSError *)error forURL:(NSString *)URL{
+    NSDictionary *waiting = [pending objectForKey:URL];
+    [pending removeObjectForKey:URL];
+    if(uploader){
+        [uploaders setObject:uploader forKey:URL];
+        NSArray *media = [waiting objectForKey:@"media"];
+        for(int i = 0; i < [media count]; i++){
+            [[media objectAtIndex:i] setUploader:uploader];
+        }
+        [self loadAvatarForUploader:uploader onSuccess:nil onFailure:nil];
+    }
+    NSArray *handlers = [waiting objectForKey:@"handlers"];
+    for(int i = 0; i < [handlers count]; i++){
+        void (^handler)(OlapicUploaderEntity *, NSError *) = [handlers objectAtIndex:i];
+        handler(uploader, error);
+    }
+}
+/**
+ *  Read the uploader data from a response of a bulk request. Each
+ *  response of the batch is a dictionary with the status 'code', the
+ *  'headers' and the 'body' the API sent, as a JSON string
+ *
+ *  @param item  The response
+ *  @param error Set when the request failed or the response doesn't have the bulk format
+ *
+ *  @return The uploader data or nil if the request failed
+ */
++(NSDictionary *)uploaderDataFromBulkResponse:(id)item error:(NSError **)error{
+    id code = [item isKindOfClass:[NSDictionary class]] ? [item objectForKey:@"code"] : nil;
+    id body = [item isKindOfClass:[NSDictionary class]] ? [item objectForKey:@"body"] : nil;
+    id JSON = [body isKindOfClass:[NSString class]] ? [NSJSONSerialization JSONObjectWithData:[body dataUsingEncoding:NSUTF8StringEncoding] options:0 error:nil] : nil;
+    if(![code isKindOfClass:[NSNumber class]] || ![JSON isKindOfClass:[NSDictionary class]] || ![[JSON objectForKey:@"metadata"] isKindOfClass:[NSDictionary class]]){
+        if(error) *error = [NSError errorWithDomain:@"OlapicUploaderPrefetcher" code:1 userInfo:@{NSLocalizedDescriptionKey: @"The bulk response doesn't have the expected format"}];
+        return nil;
+    }
+    if([code integerValue] >= 400 || [[JSON valueForKeyPath:@"metadata.code"] integerValue] >= 400){
+        if(error) *error = [[[OlapicSDK sharedOlapicSDK] rest] getErrorFromResponseMetadata:JSON];
+        return nil;
+    }
+    id data = [JSON objectForKey:@"data"];
+    if(![data isKindOfClass:[NSDictionary class]]){
+        if(error) *error = [NSError errorWithDomain:@"OlapicUploaderPrefetcher" code:1 userInfo:@{NSLocalizedDescriptionKey: @"The bulk response doesn't have the uploader data"}];
+        return nil;
+    }
+    return data;
+}
+
+@end
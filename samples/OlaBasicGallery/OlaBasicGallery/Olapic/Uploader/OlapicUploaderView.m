@@ -8,6 +8,7 @@
 
 #import "OlapicUploaderView.h"
 #import "OlapicAsyncImageView.h"
+#import "OlapicUploaderPrefetcher.h"
 
 @interface OlapicUploaderView(){
     /**
@@ -116,19 +117,20 @@
     
     // Data
     // - Set the source and the caption (which we already have, from the media object)
-    lblSource.text = [NSString stringWithFormat:@"From %@",[media get:@"source"]];
-    txtCaption.text = [media get:@"caption"];
-    // - Start downloading the uploaders information
-    [media getUploader:^(OlapicUploaderEntity *up){
-        // - - Set the uploaders reference
+    id source = [media get:@"source"];
+    lblSource.text = [source isKindOfClass:[NSString class]] ? [NSString stringWithFormat:@"From %@",source] : nil;
+    id caption = [media get:@"caption"];
+    txtCaption.text = [caption isKindOfClass:[NSString class]] ? caption : nil;
+    // - Get the uploaders information (it's usually prefetched with the rest of the page)
+    [[OlapicUploaderPrefetcher sharedPrefetcher] getUploaderForMedia:media onSuccess:^(OlapicUploaderEntity *up){
+        // - - Set the uploaders reference (the same instance for all the media from this uploader)
         uploader = up;
         // - - Show the name on the UI
         lblName.text = [uploader get:@"name"];
-        OlapicSDK *olapic = [OlapicSDK sharedOlapicSDK];
-        // - - Download the avatar
-        [[olapic rest] getData:[uploader get:@"avatar_url"] parameters:nil onSuccess:^(NSData *response){
+        // - - Get the avatar, already resized for the UI
+        [[OlapicUploaderPrefetcher sharedPrefetcher] loadAvatarForUploader:uploader onSuccess:^(UIImage *avatar){
             // - - - Set it on the image
-            imgAvatar.image = [OlapicAsyncImageView resizeImage:[UIImage imageWithData:response] to:CGSizeMake(54, 54) detectingRetina:YES];
+            imgAvatar.image = avatar;
             [self done];
         } onFailure:^(NSError *error){
             NSLog(@"ERROR ON THE UPLOADER AVATAR");
@@ -185,14 +187,19 @@
  */
 -(void)openShareWindow{
     NSMutableArray *items = [[NSMutableArray alloc] init];
-    [items addObject:txtCaption.text];
-    if(image){
+    if([txtCaption.text length] > 0){
+        [items addObject:txtCaption.text];
+    }
+    if(image.image){
         [items addObject:image.image];
     }
-    NSString *url = [media get:@"share_url"];
-    if(url != (id)[NSNull null]){
-        [items addObject:[NSURL URLWithString:url]];
+    // The media can come without the link, or with one that isn't valid
+    id url = [media get:@"share_url"];
+    NSURL *shareURL = [url isKindOfClass:[NSString class]] ? [NSURL URLWithString:url] : nil;
+    if(shareURL){
+        [items addObject:shareURL];
     }
+    if([items count] == 0) return;
     UIActivityViewController *shareView = [[UIActivityViewController alloc] initWithActivityItems:items applicationActivities:nil];
     shareView.completionHandler = ^(NSString *activityType, BOOL completed){
         if(activityType == nil) return;
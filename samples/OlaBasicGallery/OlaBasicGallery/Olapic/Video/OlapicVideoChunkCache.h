@@ -0,0 +1,131 @@
+//
+//  OlapicVideoChunkCache.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+/**
+ *  A disk cache for the pieces (chunks) of the videos, so seeking back
+ *  and replaying a video don't download it again:
+ *
+ *  - Each video has a directory with a file per chunk, plus the total
+ *    length and the content type once they are known.
+ *  - The cache has a limit of bytes. When it's exceeded, the chunks that
+ *    were used the longest time ago are removed.
+ *
+ *  All the methods can be called from any thread.
+ */
+@interface OlapicVideoChunkCache : NSObject{
+    /**
+     *  The directory where the chunks are saved
+     */
+    NSString *directory;
+    /**
+     *  The size of each chunk, in bytes (the last one can be smaller)
+     */
+    NSUInteger chunkSize;
+    /**
+     *  The maximum number of bytes the chunks can use
+     */
+    unsigned long long capacity;
+    /**
+     *  The number of bytes the chunks are using now
+     */
+    unsigned long long size;
+}
+
+@property (nonatomic,strong,readonly) NSString *directory;
+@property (nonatomic,readonly) NSUInteger chunkSize;
+@property (nonatomic,readonly) unsigned long long capacity;
+@property (nonatomic,readonly) unsigned long long size;
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared cache
+ */
++(instancetype)sharedChunkCache;
+/**
+ *  Class constructor
+ *
+ *  @param path  The directory where the chunks are saved
+ *  @param chunk The size of each chunk, in bytes
+ *  @param limit The maximum number of bytes the chunks can use
+ *
+ *  @return An instance of this object (OlapicVideoChunkCache)
+ */
+-(id)initWithDirectory:(NSString *)path chunkSize:(NSUInteger)chunk capacity:(unsigned long long)limit;
+/**
+ *  Get a chunk of a video
+ *
+ *  @param index The chunk index
+ *  @param URL   The video URL
+ *
+ *  @return The chunk data (memory mapped) or nil if it's not on the cache
+ */
+-(NSData *)dataForChunk:(NSUInteger)index ofURL:(NSURL *)URL;
+/**
+ *  Check if a chunk of a video is on the cache, without reading it
+ *
+ *  @param index The chunk index
+ *  @param URL   The video URL
+ *
+ *  @return If the chunk is on the cache
+ */
+-(BOOL)hasChunk:(NSUInteger)index ofURL:(NSURL *)URL;
+/**
+ *  Save a chunk of a video
+ *
+ *  @param data  The chunk data
+ *  @param index The chunk index
+ *  @param URL   The video URL
+ */
+-(void)storeData:(NSData *)data forChunk:(NSUInteger)index ofURL:(NSURL *)URL;
+/**
+ *  Get the total length and the content type of a video
+ *
+ *  @param URL The video URL
+ *
+ *  @return A dictionary with the 'length' and the 'type', or nil if they are not known yet
+ */
+-(NSDictionary *)contentInfoForURL:(NSURL *)URL;
+/**
+ *  Save the total length and the content type of a video
+ *
+ *  @param length The total length, in bytes
+ *  @param type   The MIME type
+ *  @param URL    The video URL
+ */
+-(void)setContentLength:(unsigned long long)length type:(NSString *)type forURL:(NSURL *)URL;
+/**
+ *  Remove all the chunks
+ */
+-(void)removeAllChunks;
+
+@end
@@ -0,0 +1,270 @@
+//
+//  OlapicVideoChunkCache.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+// 512KB chunks: the first one is enough for the player to show the first frame
+#define kVideoChunkSize (512 * 1024)
+// The chunks can use up to 200MB on the disk
+#define kVideoChunkCacheCapacity (200 * 1024 * 1024)
+#define kVideoChunkCacheDirectory @"OlapicSDK/VideoChunks"
+#define kVideoChunkInfoFile @"info.plist"
+
+#import "OlapicVideoChunkCache.h"
+#import <CommonCrypto/CommonDigest.h>
+
+@interface OlapicVideoChunkCache()
+/**
+ *  Get the directory of a video
+ *
+ *  @param URL The video URL
+ *
+ *  @return The directory path
+ */
+-(NSString *)directoryForURL:(NSURL *)URL;
+/**
+ *  Get the path of a chunk
+ *
+ *  @param index The chunk index
+ *  @param URL   The video URL
+ *
+ *  @return The file path
+ */
+-(NSString *)pathForChunk:(NSUInteger)index ofURL:(NSURL *)URL;
+/**
+ *  Get all the chunk files on the cache
+ *
+ *  @return An array of dictionaries with the 'path', the 'size' and the 'date' of each file
+ */
+-(NSArray *)chunkFiles;
+/**
+ *  Remove the chunks that were used the longest time ago, until the
+ *  cache is under its capacity
+ */
+-(void)trimToCapacity;
+
+@end
+
+@implementation OlapicVideoChunkCache
+@synthesize directory,chunkSize,capacity,size;
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared cache
+ */
++(instancetype)sharedChunkCache{
+    static OlapicVideoChunkCache *sharedCache = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        NSString *caches = [NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES) firstObject];
+        sharedCache = [[OlapicVideoChunkCache alloc] initWithDirectory:[caches stringByAppendingPathComponent:kVideoChunkCacheDirectory] chunkSize:kVideoChunkSize capacity:kVideoChunkCacheCapacity];
+    });
+    return sharedCache;
+}
+/**
+ *  Class constructor
+ *
+ *  @param path  The directory where the chunks are saved
+ *  @param chunk The size of each chunk, in bytes
+ *  @param limit The maximum number of bytes the chunks can use
+ *
+ *  @return An instance of this object (OlapicVideoChunkCache)
+ */
+-(id)initWithDirectory:(NSString *)path chunkSize:(NSUInteger)chunk capacity:(unsigned long long)limit{
+    self = [super init];
+    if(self){
+        directory = path;
+        chunkSize = chunk;
+        capacity = limit;
+        [[NSFileManager defaultManager] createDirectoryAtPath:directory withIntermediateDirectories:YES attributes:nil error:nil];
+        // The chunks from the previous sessions count too
+        size = 0;
+        NSArray *files = [self chunkFiles];
+        for(int i = 0; i < [files count]; i++){
+            size += [[[files objectAtIndex:i] objectForKey:@"size"] unsignedLongLongValue];
+        }
+    }
+    return self;
+}
+/**
+ *  Get a chunk of a video
+ *
+ *  @param index The chunk index
+ *  @param URL   The video URL
+ *
+ *  @return The chunk data (memory mapped) or nil if it's not on the cache
+ */
+-(NSData *)dataForChunk:(NSUInteger)index ofURL:(NSURL *)URL{
+    NSString *path = [self pathForChunk:index ofURL:URL];
+    @synchronized(self){
+        NSData *data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedIfSafe error:nil];
+        if(data){
+            // The date is used to know which chunks to remove first
+            [[NSFileManager defaultManager] setAttributes:@{NSFileModificationDate: [NSDate date]} ofItemAtPath:path error:nil];
+        }
+        return data;
+    }
+}
+/**
+ *  Check if a chunk of a video is on the cache, without reading it
+ *
+ *  @param index The chunk index
+ *  @param URL   The video URL
+ *
+ *  @return If the chunk is on the cache
+ */
+-(BOOL)hasChunk:(NSUInteger)index ofURL:(NSURL *)URL{
+    @synchronized(self){
+        return [[NSFileManager defaultManager] fileExistsAtPath:[self pathForChunk:index ofURL:URL]];
+    }
+}
+/**
+ *  Save a chunk of a video
+ *
+ *  @param data  The chunk data
+ *  @param index The chunk index
+ *  @param URL   The video URL
+ */
+-(void)storeData:(NSData *)data forChunk:(NSUInteger)index ofURL:(NSURL *)URL{
+    if([data length] == 0) return;
+    NSString *path = [self pathForChunk:index ofURL:URL];
+    @synchronized(self){
+        NSFileManager *manager = [NSFileManager defaultManager];
+        unsigned long long previous = [[manager attributesOfItemAtPath:path error:nil] fileSize];
+        [manager createDirectoryAtPath:[path stringByDeletingLastPathComponent] withIntermediateDirectories:YES attributes:nil error:nil];
+        if([data writeToFile:path atomically:YES]){
+            size = size - MIN(size, previous) + [data length];
+            [self trimToCapacity];
+        }
+    }
+}
+/**
+ *  Get the total length and the content type of a video
+ *
+ *  @param URL The video URL
+ *
+ *  @return A dictionary with the 'length' and the 'type', or nil if they are not known yet
+ */
+-(NSDictionary *)contentInfoForURL:(NSURL *)URL{
+    @synchronized(self){
+        return [NSDictionary dictionaryWithContentsOfFile:[[self directoryForURL:URL] stringByAppendingPathComponent:kVideoChunkInfoFile]];
+    }
+}
+/**
+ *  Save the total length and the content type of a video
+ *
+ *  @param length The total length, in bytes
+ *  @param type   The MIME type
+ *  @param URL    The video URL
+ */
+-(void)setContentLength:(unsigned long long)length type:(NSString *)type forURL:(NSURL *)URL{
+    NSString *videoDirectory = [self directoryForURL:URL];
+    @synchronized(self){
+        [[NSFileManager defaultManager] createDirectoryAtPath:videoDirectory withIntermediateDirectories:YES attributes:nil error:nil];
+        [@{@"length": @(length), @"type": type ? type : @"video/mp4"} writeToFile:[videoDirectory stringByAppendingPathComponent:kVideoChunkInfoFile] atomically:YES];
+    }
+}
+/**
+ *  Remove all the chunks
+ */
+-(void)removeAllChunks{
+    @synchronized(self){
+        NSFileManager *manager = [NSFileManager defaultManager];
+        [manager removeItemAtPath:directory error:nil];
+        [manager createDirectoryAtPath:directory withIntermediateDirectories:YES attributes:nil error:nil];
+        size = 0;
+    }
+}
+/**
+ *  Get the directory of a video
+ *
+ *  @param URL The video URL
+ *
+ *  @return The directory path
+ */
+-(NSString *)directoryForURL:(NSURL *)URL{
+    const char *string = [[URL absoluteString] UTF8String];
+    unsigned char digest[CC_SHA1_DIGEST_LENGTH];
+    CC_SHA1(string, (CC_LONG)strlen(string), digest);
+    NSMutableString *name = [[NSMutableString alloc] initWithCapacity:(CC_SHA1_DIGEST_LENGTH * 2)];
+    for(int i = 0; i < CC_SHA1_DIGEST_LENGTH; i++){
+        [name appendFormat:@"%02x", digest[i]];
+    }
+    return [directory stringByAppendingPathComponent:name];
+}
+/**
+ *  Get the path of a chunk
+ *
+ *  @param index The chunk index
+ *  @param URL   The video URL
+ *
+ *  @return The file path
+ */
+-(NSString *)pathForChunk:(NSUInteger)index ofURL:(NSURL *)URL{
+    return [[self directoryForURL:URL] stringByAppendingPathComponent:[NSString stringWithFormat:@"%lu.chunk", (unsigned long)index]];
+}
+/**
+ *  Get all the chunk files on the cache
+ *
+ *  @return An array of dictionaries with the 'path', the 'size' and the 'date' of each file
+ */
+-(NSArray *)chunkFiles{
+    NSMutableArray *files = [[NSMutableArray alloc] init];
+    NSFileManager *manager = [NSFileManager defaultManager];
+    NSDirectoryEnumerator *enumerator = [manager enumeratorAtPath:directory];
+    NSString *file;
+    while((file = [enumerator nextObject])){
+        if(![[file pathExtension] isEqualToString:@"chunk"]) continue;
+        NSDictionary *attributes = [enumerator fileAttributes];
+        [files addObject:@{@"path": [directory stringByAppendingPathComponent:file],
+                           @"size": @([attributes fileSize]),
+                           @"date": [attributes fileModificationDate] ? [attributes fileModificationDate] : [NSDate distantPast]}];
+    }
+    return files;
+}
+/**
+ *  Remove the chunks that were used the longest time ago, until the
+ *  cache is under its capacity
+ */
+-(void)trimToCapacity{
+    if(size <= capacity) return;
+    NSArray *files = [[self chunkFiles] sortedArrayUsingComparator:^NSComparisonResult(NSDictionary *a, NSDictionary *b){
+        return [[a objectForKey:@"date"] compare:[b objectForKey:@"date"]];
+    }];
+    NSFileManager *manager = [NSFileManager defaultManager];
+    for(int i = 0; i < [files count] && size > capacity; i++){
+        NSDictionary *file = [files objectAtIndex:i];
+        if([manager removeItemAtPath:[file objectForKey:@"path"] error:nil]){
+            size -= MIN(size, [[file objectForKey:@"size"] unsignedLongLongValue]);
+        }
+    }
+}
+
+@end
@@ -0,0 +1,124 @@
+//
+//  OlapicVideoStreamLoader.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <AVFoundation/AVFoundation.h>
+#import "OlapicVideoChunkCache.h"
+/**
+ *  Feeds the player with the bytes of a video using HTTP range requests,
+ *  so the playback starts after the first chunk instead of after the
+ *  whole file:
+ *
+ *  - The assets it creates use a custom scheme, so the player asks this
+ *    object (its resource loader delegate) for every range it needs.
+ *  - The ranges are served from an OlapicVideoChunkCache; the chunks
+ *    that are missing are downloaded with a 'Range' header, and the
+ *    next ones are fetched ahead of the position being played.
+ *  - Downloads of the same chunk are merged.
+ *  - The responses are downloaded to a file, so a server that ignores
+ *    the range and sends the whole video doesn't fill the memory: the
+ *    file is split into chunks from the disk.
+ *
+ *  It uses the shared HTTP session, and all its work is done on
+ *  a serial queue.
+ */
+@interface OlapicVideoStreamLoader : NSObject <AVAssetResourceLoaderDelegate>{
+    /**
+     *  The session used for the range requests
+     */
+    NSURLSession *session;
+    /**
+     *  The cache for the chunks
+     */
+    OlapicVideoChunkCache *cache;
+    /**
+     *  The queue where the resource loader calls this object
+     */
+    dispatch_queue_t queue;
+    /**
+     *  The loading requests of the player being served
+     */
+    NSMutableArray *loadingRequests;
+    /**
+     *  The chunks being downloaded, with the callbacks waiting for them,
+     *  by 'URL#index'
+     */
+    NSMutableDictionary *chunkFetches;
+    /**
+     *  The number of chunks fetched ahead of the one being played
+     */
+    NSUInteger readAheadChunks;
+}
+
+@property (nonatomic,strong,readonly) OlapicVideoChunkCache *cache;
+@property (nonatomic) NSUInteger readAheadChunks;
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared loader
+ */
++(instancetype)sharedStreamLoader;
+/**
+ *  Class constructor
+ *
+ *  @param urlSession The session for the range requests
+ *  @param chunkCache The cache for the chunks
+ *
+ *  @return An instance of this object (OlapicVideoStreamLoader)
+ */
+-(id)initWithSession:(NSURLSession *)urlSession andCache:(OlapicVideoChunkCache *)chunkCache;
+/**
+ *  Get an asset for a video that is loaded through this object
+ *
+ *  @param URL The video URL (http or https)
+ *
+ *  @return The asset object
+ */
+-(AVURLAsset *)assetForURL:(NSURL *)URL;
+/**
+ *  Get the URL with the custom scheme the player uses for a video
+ *
+ *  @param URL The video URL (http or https)
+ *
+ *  @return The URL for the player
+ */
++(NSURL *)streamURLForURL:(NSURL *)URL;
+/**
+ *  Get the real URL of a video from the one the player uses
+ *
+ *  @param URL The URL with the custom scheme
+ *
+ *  @return The video URL, or nil if the URL doesn't use the custom scheme
+ */
++(NSURL *)originalURLForStreamURL:(NSURL *)URL;
+
+@end
@@ -0,0 +1,374 @@
+//
+//  OlapicVideoStreamLoader.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+// The prefix added to the scheme, so the player can't load the URL by itself
+#define kVideoStreamSchemePrefix @"olapic-"
+#define kVideoStreamReadAheadChunks 2
+
+#import <MobileCoreServices/MobileCoreServices.h>
+#import "OlapicVideoStreamLoader.h"
+#import "OlapicHTTPSession.h"
+
+@interface OlapicVideoStreamLoader()
+/**
+ *  Serve everything a loading request needs that is on the cache, and
+ *  download the next chunk it needs. It's called again when the chunk
+ *  is ready, until the request is finished
+ *
+ *  @param loadingRequest The loading request
+ */
+-(void)continueLoadingRequest:(AVAssetResourceLoadingRequest *)loadingRequest;
+/**
+ *  Finish a loading request with an error
+ *
+ *  @param loadingRequest The loading request
+ *  @param error          The error
+ */
+-(void)failLoadingRequest:(AVAssetResourceLoadingRequest *)loadingRequest withError:(NSError *)error;
+/**
+ *  Download a chunk of a video, unless it's already being downloaded
+ *
+ *  @param index    The chunk index
+ *  @param URL      The video URL
+ *  @param complete A callback for when the chunk is on the cache (or it failed), called on the queue
+ */
+-(void)fetchChunk:(NSUInteger)index ofURL:(NSURL *)URL onComplete:(void (^)(NSError *error))complete;
+/**
+ *  Download the chunks that follow the one being played
+ *
+ *  @param index The first chunk to read ahead
+ *  @param URL   The video URL
+ */
+-(void)readAheadFromChunk:(NSUInteger)index ofURL:(NSURL *)URL;
+/**
+ *  Save the response of a range request on the cache
+ *
+ *  @param location The file with the response body
+ *  @param response The response
+ *  @param index    The requested chunk index
+ *  @param URL      The video URL
+ *
+ *  @return An error if the response isn't valid, or nil
+ */
+-(NSError *)storeFileAtURL:(NSURL *)location withResponse:(NSURLResponse *)response forChunk:(NSUInteger)index ofURL:(NSURL *)URL;
+
+@end
+
+@implementation OlapicVideoStreamLoader
+@synthesize cache,readAheadChunks;
+/**
+ *  Get the shared instance
+ *
+ *  @return The shared loader
+ */
++(instancetype)sharedStreamLoader{
+    static OlapicVideoStreamLoader *sharedLoader = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedLoader = [[OlapicVideoStreamLoader alloc] initWithSession:[[OlapicHTTPSession sharedHTTPSession] session] andCache:[OlapicVideoChunkCache sharedChunkCache]];
+    });
+    return sharedLoader;
+}
+/**
+ *  Class constructor
+ *
+ *  @param urlSession The session for the range requests
+ *  @param chunkCache The cache for the chunks
+ *
+ *  @return An instance of this object (OlapicVideoStreamLoader)
+ */
+-(id)initWithSession:(NSURLSession *)urlSession andCache:(OlapicVideoChunkCache *)chunkCache{
+    self = [super init];
+    if(self){
+        session = urlSession;
+        cache = chunkCache;
+        queue = dispatch_queue_create("com.olapic.video.loader", DISPATCH_QUEUE_SERIAL);
+        loadingRequests = [[NSMutableArray alloc] init];
+        chunkFetches = [[NSMutableDictionary alloc] init];
+        readAheadChunks = kVideoStreamReadAheadChunks;
+    }
+    return self;
+}
+/**
+ *  Get an asset for a video that is loaded through this object
+ *
+ *  @param URL The video URL (http or https)
+ *
+ *  @return The asset object
+ */
+-(AVURLAsset *)assetForURL:(NSURL *)URL{
+    AVURLAsset *asset = [AVURLAsset URLAssetWithURL:[OlapicVideoStreamLoader streamURLForURL:URL] options:nil];
+    [asset.resourceLoader setDelegate:self queue:queue];
+    return asset;
+}
+/**
+ *  Get the URL with the custom scheme the player uses for a video
+ *
+ *  @param URL The video URL (http or https)
+ *
+ *  @return The URL for the player
+ */
++(NSURL *)streamURLForURL:(NSURL *)URL{
+    NSURLComponents *components = [NSURLComponents componentsWithURL:URL resolvingAgainstBaseURL:NO];
+    components.scheme = [kVideoStreamSchemePrefix stringByAppendingString:components.scheme];
+    return [components URL];
+}
+/**
+ *  Get the real URL of a video from the one the player uses
+ *
+ *  @param URL The URL with the custom scheme
+ *
+ *  @return The video URL, or nil if the URL doesn't use the custom scheme
+ */
++(NSURL *)originalURLForStreamURL:(NSURL *)URL{
+    NSURLComponents *components = [NSURLComponents componentsWithURL:URL resolvingAgainstBaseURL:NO];
+    if(![components.scheme hasPrefix:kVideoStreamSchemePrefix]) return nil;
+    components.scheme = [components.scheme substringFromIndex:[kVideoStreamSchemePrefix length]];
+    return [components URL];
+}
+/**
+ *  Serve everything a loading request needs that is on the cache, and
+ *  download the next chunk it needs. It's called again when the chunk
+ *  is ready, until the request is finished
+ *
+ *  @param loadingRequest The loading request
+ */
+-(void)continueLoadingRequest:(AVAssetResourceLoadingRequest *)loadingRequest{
+    if(![loadingRequests containsObject:loadingRequest]) return;
+    if(loadingRequest.isCancelled || loadingRequest.isFinished){
+        [loadingRequests removeObject:loadingRequest];
+        return;
+    }
+    NSURL *URL = [OlapicVideoStreamLoader originalURLForStreamURL:loadingRequest.request.URL];
+    NSDictionary *info = [cache contentInfoForURL:URL];
+    if(!info){
+        // The first chunk tells the length of the video
+        [self fetchChunk:0 ofURL:URL onComplete:^(NSError *error){
+            if(error){
+                [self failLoadingRequest:loadingRequest withError:error];
+            }else{
+                [self continueLoadingRequest:loadingRequest];
+            }
+        }];
+        return;
+    }
+    unsigned long long length = [[info objectForKey:@"length"] unsignedLongLongValue];
+    AVAssetResourceLoadingContentInformationRequest *contentRequest = loadingRequest.contentInformationRequest;
+    if(contentRequest && !contentRequest.contentType){
+        CFStringRef type = UTTypeCreatePreferredIdentifierForTag(kUTTagClassMIMEType, (__bridge CFStringRef)[info objectForKey:@"type"], NULL);
+        contentRequest.contentType = type ? (__bridge_transfer NSString *)type : AVFileTypeMPEG4;
+        contentRequest.contentLength = length;
+        contentRequest.byteRangeAccessSupported = YES;
+    }
+    AVAssetResourceLoadingDataRequest *dataRequest = loadingRequest.dataRequest;
+    if(dataRequest){
+        unsigned long long chunkSize = cache.chunkSize;
+        unsigned long long end = dataRequest.requestsAllDataToEndOfResource ? length : MIN(length, (unsigned long long)(dataRequest.requestedOffset + dataRequest.requestedLength));
+        unsigned long long offset = dataRequest.currentOffset;
+        while(offset < end){
+            NSUInteger index = (NSUInteger)(offset / chunkSize);
+            NSData *chunk = [cache dataForChunk:index ofURL:URL];
+            if(!chunk){
+                [self fetchChunk:index ofURL:URL onComplete:^(NSError *error){
+                    if(error){
+                        [self failLoadingRequest:loadingRequest withError:error];
+                    }else{
+                        [self continueLoadingRequest:loadingRequest];
+                    }
+                }];
+                [self readAheadFromChunk:(index + 1) ofURL:URL];
+                return;
+            }
+            unsigned long long chunkStart = index * chunkSize;
+            unsigned long long from = offset - chunkStart;
+            unsigned long long to = MIN((unsigned long long)[chunk length], end - chunkStart);
+            if(from >= to){
+                // The chunk is shorter than the length says: the file changed on the server
+                [self failLoadingRequest:loadingRequest withError:[NSError errorWithDomain:@"OlapicVideoStreamLoader" code:0 userInfo:@{NSLocalizedDescriptionKey: @"The cached video doesn't match its length"}]];
+                return;
+            }
+            [dataRequest respondWithData:[chunk subdataWithRange:NSMakeRange((NSUInteger)from, (NSUInteger)(to - from))]];
+            offset += to - from;
+        }
+        if(end > 0){
+            [self readAheadFromChunk:(NSUInteger)((end - 1) / chunkSize) + 1 ofURL:URL];
+        }
+    }
+    [loadingRequest finishLoading];
+    [loadingRequests removeObject:loadingRequest];
+}
+/**
+ *  Finish a loading request with an error
+ *
+ *  @param loadingRequest The loading request
+ *  @param error          The error
+ */
+-(void)failLoadingRequest:(AVAssetResourceLoadingRequest *)loadingRequest withError:(NSError *)error{
+    if(![loadingRequests containsObject:loadingRequest]) return;
+    if(!loadingRequest.isCancelled && !loadingRequest.isFinished){
+        [loadingRequest finishLoadingWithError:error];
+    }
+    [loadingRequests removeObject:loadingRequest];
+}
+/**
+ *  Download a chunk of a video, unless it's already being downloaded
+ *
+ *  @param index    The chunk index
+ *  @param URL      The video URL
+ *  @param complete A callback for when the chunk is on the cache (or it failed), called on the queue
+ */
+-(void)fetchChunk:(NSUInteger)index ofURL:(NSURL *)URL onComplete:(void (^)(NSError *error))complete{
+    NSString *key = [NSString stringWithFormat:@"%@#%lu", [URL absoluteString], (unsigned long)index];
+    NSMutableArray *callbacks = [chunkFetches objectForKey:key];
+    if(callbacks){
+        if(complete) [callbacks addObject:[complete copy]];
+        return;
+    }
+    callbacks = [[NSMutableArray alloc] init];
+    if(complete) [callbacks addObject:[complete copy]];
+    [chunkFetches setObject:callbacks forKey:key];
+    unsigned long long start = index * (unsigned long long)cache.chunkSize;
+    unsigned long long last = start + cache.chunkSize - 1;
+    NSDictionary *info = [cache contentInfoForURL:URL];
+    if(info){
+        last = MIN(last, [[info objectForKey:@"length"] unsignedLongLongValue] - 1);
+    }
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:URL];
+    // The chunks have their own cache, the HTTP one would only duplicate them
+    request.cachePolicy = NSURLRequestReloadIgnoringLocalCacheData;
+    [request setValue:[NSString stringWithFormat:@"bytes=%llu-%llu", start, last] forHTTPHeaderField:@"Range"];
+    // The body goes to a file, in case the server ignores the range and sends the whole video
+    NSURLSessionDownloadTask *task = [session downloadTaskWithRequest:request completionHandler:^(NSURL *location, NSURLResponse *response, NSError *error){
+        // The chunk is written here (the file is removed when this block returns), so the loader queue is free while it happens
+        NSError *result = error ? error : [self storeFileAtURL:location withResponse:response forChunk:index ofURL:URL];
+        dispatch_async(queue, ^{
+            NSArray *waiting = [chunkFetches objectForKey:key];
+            [chunkFetches removeObjectForKey:key];
+            for(int i = 0; i < [waiting count]; i++){
+                void (^callback)(NSError *) = [waiting objectAtIndex:i];
+                callback(result);
+            }
+        });
+    }];
+    [task resume];
+}
+/**
+ *  Download the chunks that follow the one being played
+ *
+ *  @param index The first chunk to read ahead
+ *  @param URL   The video URL
+ */
+-(void)readAheadFromChunk:(NSUInteger)index ofURL:(NSURL *)URL{
+    NSDictionary *info = [cache contentInfoForURL:URL];
+    if(!info) return;
+    unsigned long long length = [[info objectForKey:@"length"] unsignedLongLongValue];
+    NSUInteger chunks = (NSUInteger)((length + cache.chunkSize - 1) / cache.chunkSize);
+    for(NSUInteger i = index; i < MIN(chunks, index + readAheadChunks); i++){
+        if(![cache hasChunk:i ofURL:URL]){
+            [self fetchChunk:i ofURL:URL onComplete:nil];
+        }
+    }
+}
+/**
+ *  Save the response of a range request on the cache
+ *
+ *  @param location The file with the response body
+ *  @param response The response
+ *  @param index    The requested chunk index
+ *  @param URL      The video URL
+ *
+ *  @return An error if the response isn't valid, or nil
+ */
+-(NSError *)storeFileAtURL:(NSURL *)location withResponse:(NSURLResponse *)response forChunk:(NSUInteger)index ofURL:(NSURL *)URL{
+    NSInteger statusCode = [response isKindOfClass:[NSHTTPURLResponse class]] ? [(NSHTTPURLResponse *)response statusCode] : 0;
+    // Mapped, so only the pages being copied to the cache are in memory
+    NSData *data = location ? [NSData dataWithContentsOfURL:location options:NSDataReadingMappedAlways error:nil] : nil;
+    if(!data && (statusCode == 200 || statusCode == 206)){
+        return [NSError errorWithDomain:@"OlapicVideoStreamLoader" code:statusCode userInfo:@{NSLocalizedDescriptionKey: @"The downloaded video couldn't be read"}];
+    }
+    if(statusCode == 206){
+        // 'Content-Range: bytes 0-524287/12345678'
+        NSString *range = [[(NSHTTPURLResponse *)response allHeaderFields] objectForKey:@"Content-Range"];
+        NSRange slash = range ? [range rangeOfString:@"/"] : NSMakeRange(NSNotFound, 0);
+        if(slash.location != NSNotFound){
+            long long length = [[range substringFromIndex:(slash.location + 1)] longLongValue];
+            if(length > 0 && ![cache contentInfoForURL:URL]){
+                [cache setContentLength:length type:[response MIMEType] forURL:URL];
+            }
+        }
+        if(![cache contentInfoForURL:URL]){
+            return [NSError errorWithDomain:@"OlapicVideoStreamLoader" code:statusCode userInfo:@{NSLocalizedDescriptionKey: @"The server didn't send the length of the video"}];
+        }
+        [cache storeData:data forChunk:index ofURL:URL];
+        return nil;
+    }
+    if(statusCode == 200){
+        // The server ignored the range and sent the whole file: split it into chunks, one at a time
+        [cache setContentLength:[data length] type:[response MIMEType] forURL:URL];
+        NSUInteger chunkSize = cache.chunkSize;
+        for(NSUInteger offset = 0; offset < [data length]; offset += chunkSize){
+            @autoreleasepool{
+                [cache storeData:[data subdataWithRange:NSMakeRange(offset, MIN(chunkSize, [data length] - offset))] forChunk:(offset / chunkSize) ofURL:URL];
+            }
+        }
+        return nil;
+    }
+    return [NSError errorWithDomain:@"OlapicVideoStreamLoader" code:statusCode userInfo:@{NSLocalizedDescriptionKey: @"The video couldn't be downloaded"}];
+}
+
+#pragma mark - Resource loader delegate
+/**
+ *  The player needs a range of the video (or its information)
+ *
+ *  @param resourceLoader The resource loader of the asset
+ *  @param loadingRequest The loading request
+ *
+ *  @return If the request is going to be served
+ */
+-(BOOL)resourceLoader:(AVAssetResourceLoader *)resourceLoader shouldWaitForLoadingOfRequestedResource:(AVAssetResourceLoadingRequest *)loadingRequest{
+    if(![OlapicVideoStreamLoader originalURLForStreamURL:loadingRequest.request.URL]) return NO;
+    [loadingRequests addObject:loadingRequest];
+    [self continueLoadingRequest:loadingRequest];
+    return YES;
+}
+/**
+ *  The player doesn't need a range anymore (it seeked, for example). The
+ *  chunk being downloaded for it is still saved on the cache
+ *
+ *  @param resourceLoader The resource loader of the asset
+ *  @param loadingRequest The loading request
+ */
+-(void)resourceLoader:(AVAssetResourceLoader *)resourceLoader didCancelLoadingRequest:(AVAssetResourceLoadingRequest *)loadingRequest{
+    [loadingRequests removeObject:loadingRequest];
+}
+
+@end
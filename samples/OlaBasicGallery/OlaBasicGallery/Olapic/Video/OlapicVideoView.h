@@ -0,0 +1,72 @@
+//
+//  OlapicVideoView.h
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <UIKit/UIKit.h>
+#import <AVFoundation/AVFoundation.h>
+#import <OlapicSDK/OlapicSDK.h>
+/**
+ *  Plays the video of a media. The video is streamed by chunks with the
+ *  OlapicVideoStreamLoader, so it starts as soon as the first one arrives
+ *  and seeking back or replaying doesn't download it again.
+ */
+@interface OlapicVideoView : UIView{
+    /**
+     *  The media object
+     */
+    OlapicMediaEntity *media;
+    /**
+     *  The player
+     */
+    AVPlayer *player;
+}
+
+@property (nonatomic,strong,readonly) OlapicMediaEntity *media;
+@property (nonatomic,strong,readonly) AVPlayer *player;
+/**
+ *  Class constructor
+ *
+ *  @param frame The view frame
+ *  @param med   The media object (a video)
+ *
+ *  @return An instance of this object (OlapicVideoView)
+ */
+-(id)initWithFrame:(CGRect)frame andMedia:(OlapicMediaEntity *)med;
+/**
+ *  Start (or continue) the playback
+ */
+-(void)play;
+/**
+ *  Pause the playback
+ */
+-(void)pause;
+
+@end
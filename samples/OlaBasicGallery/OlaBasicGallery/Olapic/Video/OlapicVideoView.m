@@ -0,0 +1,112 @@
+//
+//  OlapicVideoView.m
+//  OlaBasicGallery
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "OlapicVideoView.h"
+#import "OlapicVideoStreamLoader.h"
+#import "OlapicFileDownloader.h"
+
+@interface OlapicVideoView()
+/**
+ *  The video reached the end: go back to the start, from the chunk cache
+ *
+ *  @param notification The notification object
+ */
+-(void)playerItemDidReachEnd:(NSNotification *)notification;
+
+@end
+
+@implementation OlapicVideoView
+@synthesize media,player;
+/**
+ *  The view is backed by the player layer, so it follows the view size
+ *
+ *  @return The layer class
+ */
++(Class)layerClass{
+    return [AVPlayerLayer class];
+}
+/**
+ *  Class constructor
+ *
+ *  @param frame The view frame
+ *  @param med   The media object (a video)
+ *
+ *  @return An instance of this object (OlapicVideoView)
+ */
+-(id)initWithFrame:(CGRect)frame andMedia:(OlapicMediaEntity *)med{
+    self = [super initWithFrame:frame];
+    if(self){
+        media = med;
+        self.backgroundColor = [UIColor clearColor];
+        // A video without a video URL has nothing to play
+        NSString *videoURL = [OlapicFileDownloader fileURLForMedia:media];
+        NSURL *URL = videoURL ? [NSURL URLWithString:videoURL] : nil;
+        if(URL){
+            AVPlayerItem *item = [AVPlayerItem playerItemWithAsset:[[OlapicVideoStreamLoader sharedStreamLoader] assetForURL:URL]];
+            player = [AVPlayer playerWithPlayerItem:item];
+            player.actionAtItemEnd = AVPlayerActionAtItemEndNone;
+            [(AVPlayerLayer *)self.layer setPlayer:player];
+            [(AVPlayerLayer *)self.layer setVideoGravity:AVLayerVideoGravityResizeAspect];
+            [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(playerItemDidReachEnd:) name:AVPlayerItemDidPlayToEndTimeNotification object:item];
+        }
+    }
+    return self;
+}
+/**
+ *  Start (or continue) the playback
+ */
+-(void)play{
+    [player play];
+}
+/**
+ *  Pause the playback
+ */
+-(void)pause{
+    [player pause];
+}
+/**
+ *  The video reached the end: go back to the start, from the chunk cache
+ *
+ *  @param notification The notification object
+ */
+-(void)playerItemDidReachEnd:(NSNotification *)notification{
+    [player seekToTime:kCMTimeZero];
+}
+/**
+ *  Stop the playback and the observers
+ */
+-(void)dealloc{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+    [player pause];
+}
+
+@end
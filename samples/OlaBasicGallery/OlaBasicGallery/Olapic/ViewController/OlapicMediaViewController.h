@@ -33,17 +33,20 @@
 #import <Foundation/Foundation.h>
 #import <OlapicSDK/OlapicSDK.h>
 #import "OlapicAsyncImageView.h"
+#import "OlapicTiledImageView.h"
 #import "OlapicUploaderView.h"
+#import "OlapicVideoView.h"
 /**
  *  Show a single media entity in detail, with a zoom
  *  controller and the information about its uploader
  */
 @interface OlapicMediaViewController : UIViewController <UIScrollViewDelegate,UIGestureRecognizerDelegate>{
     /**
-     *  A reference to the thumbnail from which this
-     *  screen is loaded
+     *  A copy of the thumbnail from which this screen is loaded. The
+     *  screen owns it, so the gallery can reuse the thumbnail for other
+     *  media while this screen is open
      */
-    OlapicAsyncImageView *__weak mimage;
+    OlapicAsyncImageView *mimage;
     /**
      *  The image object for the zoom
      */
@@ -78,9 +81,26 @@
      *  The real object with the uploader detail
      */
     OlapicUploaderView *detail;
+    /**
+     *  A flag to know if a bigger version of the image is being downloaded
+     */
+    BOOL loadingImage;
+    /**
+     *  How many times in a row the download of a bigger version failed
+     */
+    NSInteger imageFailures;
+    /**
+     *  The tiled version of the original image, on top of the image
+     *  object, used when the zoom needs the original size
+     */
+    OlapicTiledImageView *tiledImage;
+    /**
+     *  The player for the video media, on top of the image object
+     */
+    OlapicVideoView *videoView;
 }
 
-@property (nonatomic,weak) OlapicAsyncImageView *__weak mimage;
+@property (nonatomic,strong,readonly) OlapicAsyncImageView *mimage;
 @property (nonatomic,strong) UIImageView *image;
 @property (nonatomic,strong) UIScrollView *zoomView;
 @property (nonatomic) BOOL firstLoad;
@@ -89,6 +109,9 @@
 @property (nonatomic,strong) UIView *uploaderArrowLine;
 @property (nonatomic) BOOL uploaderViewOpen;
 @property (nonatomic,strong) OlapicUploaderView *detail;
+@property (nonatomic) BOOL loadingImage;
+@property (nonatomic,strong) OlapicTiledImageView *tiledImage;
+@property (nonatomic,strong) OlapicVideoView *videoView;
 
 /**
  *  Class constructor
@@ -97,6 +120,6 @@
  *
  *  @return An instance of this object (OlapicMediaViewController)
  */
--(id)initWithImage:(OlapicAsyncImageView *__weak)img;
+-(id)initWithImage:(OlapicAsyncImageView *)img;
 
 @end
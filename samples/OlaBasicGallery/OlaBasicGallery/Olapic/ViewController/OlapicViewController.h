@@ -32,6 +32,9 @@
 
 #import <Foundation/Foundation.h>
 #import <OlapicSDK/OlapicCustomerMediaList.h>
+#import "OlapicMediaListSync.h"
+#import "OlapicGridView.h"
+#import "OlapicMemoryGovernor.h"
 
 @class OlapicCustomerMediaList;
 @class OlapicAsyncImageView;
@@ -39,7 +42,7 @@
  *  Connects with the Olapic API and shows the
  *  thumbnail gallery on the screen
  */
-@interface OlapicViewController : UIViewController <OlapicMediaListDelegate>{
+@interface OlapicViewController : UIViewController <OlapicMediaListDelegate,OlapicMediaListSyncDelegate,OlapicGridViewDataSource,OlapicGridViewDelegate,OlapicMemoryConsumer>{
     /**
      *  The loading indicator to show while the app is downloading the content
      */
@@ -54,27 +57,45 @@
      */
     OlapicCustomerMediaList *list;
     /**
-     *  A container view for the thumbnails
+     *  A container view for the thumbnails. It only keeps the
+     *  thumbnails that are on the screen
      */
-    UIScrollView *scroll;
+    OlapicGridView *grid;
     /**
-     *  An array with the already generated thumbnails
+     *  An array with all the media downloaded so far, in order. The
+     *  objects are the shared instances of the identity map, the same
+     *  ones the list pages hold
      */
-    NSMutableArray *thumbnails;
+    NSMutableArray *mediaItems;
+    /**
+     *  The object that keeps the list up to date with the new media
+     */
+    OlapicMediaListSync *sync;
+    /**
+     *  A flag to know if the next page is being loaded
+     */
+    BOOL loadingPage;
+    /**
+     *  The callbacks of the API client attempt that's loading the next
+     *  page, called from the list delegate methods
+     */
+    void (^pageSuccess)(id response);
+    void (^pageFailure)(NSError *error);
 }
 
 @property (nonatomic,strong) UIActivityIndicatorView *loader;
 @property (nonatomic) BOOL firstLoad;
 @property (nonatomic,strong) OlapicCustomerMediaList *list;
-@property (nonatomic,strong) UIScrollView *scroll;
-@property (nonatomic,strong) NSMutableArray *thumbnails;
+@property (nonatomic,strong) OlapicGridView *grid;
+@property (nonatomic,strong) NSMutableArray *mediaItems;
+@property (nonatomic,strong) OlapicMediaListSync *sync;
+@property (nonatomic,readonly) BOOL loadingPage;
 /**
- *  Take an array of media and, using the OlapicAsyncImageView,
- *  generate the final thumbnail list
+ *  Add an array of media at the end of the gallery
  *
  *  @param media An array of OlapicMediaEntity objects
  */
--(void)createThumbnailsFromMedia:(NSArray *)media;
+-(void)addMedia:(NSArray *)media;
 /**
  *  Updates the thumbnails position, using the current controller
  *  view size as reference
@@ -86,12 +107,5 @@
  *  @param size The size to use as reference
  */
 -(void)reorderThumbnails:(CGSize)size;
-/**
- *  A simple shorthand method to move a thumbnail to a new position
- *
- *  @param img The thumbnail to move
- *  @param pos The new position
- */
--(void)changeImage:(OlapicAsyncImageView *)img atPosition:(CGPoint)pos;
 
 @end
@@ -30,10 +30,22 @@
 //  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 //  THE SOFTWARE.
 
+// The memory the list pages can use before the far ones are dropped (8MB)
+#define kGalleryPagesMemoryBudget (8 * 1024 * 1024)
+// The media fields the gallery, the detail screen and its uploader view read, the rest isn't requested
+#define kGalleryMediaFields @[@"id", @"images", @"original_image_width", @"original_image_height", @"original_source", @"video_url", @"caption", @"source", @"share_url", @"_embedded.uploader"]
+
 #import "OlapicViewController.h"
 #import <OlapicSDK/OlapicSDK.h>
 #import "OlapicAsyncImageView.h"
 #import "OlapicMediaViewController.h"
+#import "OlapicEntityIdentityMap.h"
+#import "OlapicImageLoader.h"
+#import "OlapicUploaderPrefetcher.h"
+#import "OlapicReachability.h"
+#import "OlapicCachedOAuthForSecretKey.h"
+#import "OlapicFieldSelection.h"
+#import "OlapicAPIClient.h"
 
 @interface OlapicViewController()
 /**
@@ -48,11 +60,50 @@
  *  @param size The size to use as reference
  */
 -(void)centerLoader:(CGSize)size;
+/**
+ *  Create a thumbnail that can be used (and reused) by the grid
+ *
+ *  @return The thumbnail, without media
+ */
+-(OlapicAsyncImageView *)createThumbnail;
+/**
+ *  Get the media objects for a set of indexes
+ *
+ *  @param indexes The indexes
+ *
+ *  @return An array of OlapicMediaEntity objects
+ */
+-(NSArray *)mediaAtIndexes:(NSIndexSet *)indexes;
+/**
+ *  Adapt the number of prefetched rows to the connection: less on a
+ *  cellular connection, and none while offline
+ *
+ *  @param notification The notification object
+ */
+-(void)connectionDidChange:(NSNotification *)notification;
+/**
+ *  Use a single instance per media and share the embedded resources
+ *  (uploaders, streams, etc.) between the pages. The list page that
+ *  holds the media gets the shared instances too, so the list and the
+ *  gallery never use different objects for the same media
+ *
+ *  @param media     The media objects of the page that was loaded
+ *  @param mediaList The list that loaded them
+ *
+ *  @return The shared instances, in the same order
+ */
+-(NSArray *)resolveMedia:(NSArray *)media ofList:(OlapicMediaList *)mediaList;
+/**
+ *  Load the next page of the list through the API client, so it's
+ *  retried, rate limited and held while offline. The list still loads
+ *  the page itself
+ */
+-(void)loadNextPage;
 
 @end
 
 @implementation OlapicViewController
-@synthesize loader,firstLoad,list,scroll,thumbnails;
+@synthesize loader,firstLoad,list,grid,mediaItems,sync,loadingPage;
 /**
  *  Class constructor
  *
@@ -61,13 +112,18 @@
 -(id)init{
     self = [super init];
     if(self){
-        scroll = [[UIScrollView alloc] initWithFrame:CGRectZero];
+        grid = [[OlapicGridView alloc] initWithFrame:CGRectZero];
+        grid.dataSource = self;
+        grid.delegate = self;
         loader = [[UIActivityIndicatorView alloc] initWithFrame:CGRectZero];
         loader.activityIndicatorViewStyle = UIActivityIndicatorViewStyleGray;
-        [self.view addSubview:scroll];
+        [self.view addSubview:grid];
         [self.view addSubview:loader];
         firstLoad = NO;
-        thumbnails = [[NSMutableArray alloc] init];
+        mediaItems = [[NSMutableArray alloc] init];
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(connectionDidChange:) name:OlapicReachabilityDidChangeNotification object:[OlapicReachability sharedReachability]];
+        [self connectionDidChange:nil];
+        [[OlapicMemoryGovernor sharedGovernor] addConsumer:self withName:@"pages" level:OlapicMemoryPurgeLevelPages budget:kGalleryPagesMemoryBudget];
     }
     return self;
 }
@@ -90,11 +146,15 @@
         // Setup the OAuth client ID and secret key
         NSString *clientID = @"YOUR_CLIENT_ID";
         NSString *secretKey = @"YOUR_SECRET_KEY";
-        // Instantiate the OAuth handler
-        OlapicOAuthForSecretKey *oauth = [[OlapicOAuthForSecretKey alloc] initWithClientId:clientID andSecretKey:secretKey];
+        // Instantiate the OAuth handler (it keeps the credentials in memory, so
+        // the requests don't have to read them from the keychain)
+        OlapicOAuthForSecretKey *oauth = [[OlapicCachedOAuthForSecretKey alloc] initWithClientId:clientID andSecretKey:secretKey];
         // Connect the SDK to our API using your OAuth method
         [[OlapicSDK sharedOlapicSDK] connectWithOAuthMethod:oauth onSuccess:^(OlapicCustomerEntity *customer) {
-            list = [[OlapicCustomerMediaList alloc] initForCustomer:customer delegate:self sort:OlapicMediaListSortingTypePhotorank mediaPerPage:32];
+            // Sorted by recent, so the sync can add the new media at the head
+            list = [[OlapicCustomerMediaList alloc] initForCustomer:customer delegate:self sort:OlapicMediaListSortingTypeRecent mediaPerPage:32];
+            // Only request what the screens use, on the pages and on the sync
+            [[OlapicFieldSelection selectionWithPaths:kGalleryMediaFields] applyToList:list];
             [list startFetching];
         } onFailure:^(NSError *error) {
             UIAlertView *alert = [[UIAlertView alloc] initWithTitle:@"Error" message:error.description delegate:nil cancelButtonTitle:@"Accept" otherButtonTitles:nil];
@@ -119,21 +179,120 @@
     loader.frame = CGRectMake((size.width / 2) - 10, (size.height / 2) - 10, 20, 20);
 }
 /**
- *  Take an array of media and, using the OlapicAsyncImageView,
- *  generate the final thumbnail list
+ *  Add an array of media at the end of the gallery
  *
  *  @param media An array of OlapicMediaEntity objects
  */
--(void)createThumbnailsFromMedia:(NSArray *)media{
-    for (int i = 0; i < [media count]; i++){
-        OlapicAsyncImageView *thumb = [[OlapicAsyncImageView alloc] initWithMedia:[media objectAtIndex:i] callback:^(OlapicAsyncImageView *image){
-            OlapicMediaViewController *mediaController = [[OlapicMediaViewController alloc] initWithImage:image];
-            [self.navigationController pushViewController:mediaController animated:YES];
-        } andFrame:CGRectMake(0, 0, 74, 74)];
-        [thumbnails addObject:thumb];
-        [scroll addSubview:thumb];
-        [thumb download];
+-(void)addMedia:(NSArray *)media{
+    NSIndexSet *added = [NSIndexSet indexSetWithIndexesInRange:NSMakeRange([mediaItems count], [media count])];
+    [mediaItems addObjectsFromArray:media];
+    // The thumbnails on the screen are kept, only the new ones are created
+    [grid insertItemsAtIndexes:added];
+}
+/**
+ *  Create a thumbnail that can be used (and reused) by the grid
+ *
+ *  @return The thumbnail, without media
+ */
+-(OlapicAsyncImageView *)createThumbnail{
+    return [[OlapicAsyncImageView alloc] initWithMedia:nil callback:^(OlapicAsyncImageView *image){
+        OlapicMediaViewController *mediaController = [[OlapicMediaViewController alloc] initWithImage:image];
+        [self.navigationController pushViewController:mediaController animated:YES];
+    } andFrame:CGRectMake(0, 0, 74, 74)];
+}
+/**
+ *  Get the media objects for a set of indexes
+ *
+ *  @param indexes The indexes
+ *
+ *  @return An array of OlapicMediaEntity objects
+ */
+-(NSArray *)mediaAtIndexes:(NSIndexSet *)indexes{
+    NSMutableArray *media = [[NSMutableArray alloc] initWithCapacity:[indexes count]];
+    [indexes enumerateIndexesUsingBlock:^(NSUInteger idx, BOOL *stop){
+        if(idx < [mediaItems count]){
+            [media addObject:[mediaItems objectAtIndex:idx]];
+        }
+    }];
+    return media;
+}
+/**
+ *  Use a single instance per media and share the embedded resources
+ *  (uploaders, streams, etc.) between the pages. The list page that
+ *  holds the media gets the shared instances too, so the list and the
+ *  gallery never use different objects for the same media
+ *
+ *  @param media     The media objects of the page that was loaded
+ *  @param mediaList The list that loaded them
+ *
+ *  @return The shared instances, in the same order
+ */
+-(NSArray *)resolveMedia:(NSArray *)media ofList:(OlapicMediaList *)mediaList{
+    NSArray *resolved = [[OlapicEntityIdentityMap sharedIdentityMap] resolveEntities:media];
+    if([media count] == 0) return resolved;
+    // The page was just added, so it's looked for from the end
+    NSMutableArray *pages = [mediaList pages];
+    for(NSInteger p = (NSInteger)[pages count] - 1; p >= 0; p--){
+        NSDictionary *page = [pages objectAtIndex:p];
+        NSArray *pageMedia = [page valueForKey:@"media"];
+        if([pageMedia count] > 0 && [pageMedia objectAtIndex:0] == [media objectAtIndex:0]){
+            NSMutableDictionary *resolvedPage = [[NSMutableDictionary alloc] initWithDictionary:page];
+            [resolvedPage setValue:[[NSMutableArray alloc] initWithArray:resolved] forKey:@"media"];
+            [pages replaceObjectAtIndex:p withObject:resolvedPage];
+            break;
+        }
     }
+    return resolved;
+}
+/**
+ *  Load the next page of the list through the API client, so it's
+ *  retried after temporary errors, rate limited and held while offline
+ *  (the SDK sends it only once). Every attempt asks the list to load its
+ *  next page itself, and the list delegate methods end the attempt, so
+ *  the list keeps its own pages and links
+ */
+-(void)loadNextPage{
+    if(loadingPage || ![list canLoadNextPage]) return;
+    loadingPage = YES;
+    __weak OlapicViewController *weakSelf = self;
+    [[OlapicAPIClient sharedClient] performRequestForURL:[list.nextURL copy] priority:OlapicRequestPriorityHigh withBlock:^(void (^success)(id response), void (^failure)(NSError *error)){
+        OlapicViewController *strongSelf = weakSelf;
+        if(!strongSelf){
+            failure([NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorCancelled userInfo:nil]);
+            return;
+        }
+        strongSelf->pageSuccess = success;
+        strongSelf->pageFailure = failure;
+        [strongSelf->list loadNextPage];
+    } policy:nil onSuccess:^(id response){
+        OlapicViewController *strongSelf = weakSelf;
+        if(strongSelf) strongSelf->loadingPage = NO;
+    } onFailure:^(NSError *error){
+        OlapicViewController *strongSelf = weakSelf;
+        if(!strongSelf) return;
+        strongSelf->loadingPage = NO;
+        NSLog(@"LIST ERROR : %@",error);
+    }];
+}
+/**
+ *  Adapt the number of prefetched rows to the connection: less on a
+ *  cellular connection, and none while offline
+ *
+ *  @param notification The notification object
+ */
+-(void)connectionDidChange:(NSNotification *)notification{
+    switch([[OlapicReachability sharedReachability] connectionType]){
+        case OlapicConnectionTypeWiFi:
+            grid.prefetchRows = 3;
+            break;
+        case OlapicConnectionTypeCellular:
+            grid.prefetchRows = 1;
+            break;
+        case OlapicConnectionTypeNone:
+            grid.prefetchRows = 0;
+            break;
+    }
+    [grid setNeedsLayout];
 }
 /**
  *  Updates the thumbnails position, using the current controller
@@ -143,76 +302,37 @@
     [self reorderThumbnails:self.view.frame.size];
 }
 /**
- *  Updates the thumbnails position, using a given size as reference
+ *  Updates the thumbnails position, using a given size as reference.
+ *  The grid only moves the thumbnails that are on the screen
  *
  *  @param size The size to use as reference
  */
 -(void)reorderThumbnails:(CGSize)size{
-    // Set the scroll size to fullscreen
-    scroll.frame = CGRectMake(0, 0, size.width, size.height);
-    // Get the area width
-    int areaWidth = size.width;
-    // Define the width and height of the thumbnails
-    CGSize thumbsSize = CGSizeMake(74, 74);
-    // If the area width its 0, don't render, get out
-    if(areaWidth == 0) return;
-    // This var will have the number of pixels between photos
-    int separator = 0;
-    // This var will have the number of photos that can be shown per line
-    int perline = 0;
-    // These two vars are loop helpers
-    int currentColumn = 0;
-    int currentRow = 0;
-    // Check the thumbnails width agains the area width, in order
-    // to determine how many of them are going per line
-    if([thumbnails count] > 0){
-        for(int sep = 0; sep < [thumbnails count]; sep++){
-            if((sep * thumbsSize.width) > areaWidth){
-                perline = (sep - 1);
-                break;
-            }
-        }
-    }
-    // If there's only enough for one line, it will use all the remaining space as separation
-    if(perline == 0){
-        separator = (areaWidth - (thumbsSize.width * [thumbnails count])) / ([thumbnails count]+1);
-    }else{
-        // calculate the separation
-        separator = round((areaWidth - (thumbsSize.width * perline)) / (perline+1));
-    }
-    // Loop the photos
-    for(int img = 0; img < [thumbnails count]; img++){
-        // Move one column
-        currentColumn++;
-        // Calculate the new position
-        float newX = ((currentColumn-1) * (thumbsSize.width + separator)) + separator;
-        float newY = (currentRow * (thumbsSize.height + separator)) + separator;
-        CGPoint newPosition = CGPointMake(newX,newY);
-        // Tell the controller to change the thumbnail position
-        [self changeImage:[thumbnails objectAtIndex:img] atPosition:newPosition];
-        // If the current column is the last one, reset the flag and move one row
-        if(currentColumn == perline){
-            currentColumn = 0;
-            currentRow++;
-        }
+    grid.frame = CGRectMake(0, 0, size.width, size.height);
+    [grid layoutIfNeeded];
+}
+
+#pragma mark - Default cycle
+/**
+ *  Resume the sync when the gallery is back on the screen
+ *
+ *  @param animated If the transition is animated
+ */
+-(void)viewWillAppear:(BOOL)animated{
+    [super viewWillAppear:animated];
+    if(sync && ![sync running]){
+        [sync start];
     }
-    // Calculate the heigth of the scroll
-    if(currentColumn > 0 && currentColumn != perline) currentRow++;
-    int newScrollHeight = (currentRow * (thumbsSize.height + separator)) + separator;
-    CGSize newScrollSize = CGSizeMake(areaWidth, MAX(newScrollHeight, (size.height-64)));
-    scroll.contentSize = newScrollSize;
 }
 /**
- *  A simple shorthand method to move a thumbnail to a new position
+ *  Pause the sync while the gallery is not on the screen
  *
- *  @param img The thumbnail to move
- *  @param pos The new position
+ *  @param animated If the transition is animated
  */
--(void)changeImage:(OlapicAsyncImageView *)img atPosition:(CGPoint)pos{
-    img.frame = CGRectMake(pos.x, pos.y, img.frame.size.width, img.frame.size.height);
+-(void)viewWillDisappear:(BOOL)animated{
+    [super viewWillDisappear:animated];
+    [sync stop];
 }
-
-#pragma mark - Default cycle
 /**
  *  When the app is rotating to a new orientation, this method will resize the UI
  *  using a CGSize with the values inverted (the vc width as height and the heigth
@@ -251,9 +371,28 @@
  *  @param links     The links to the API from where this media objects were downloaded
  */
 -(void)OlapicMediaList:(OlapicMediaList *)mediaList didLoadMedia:(NSArray *)media withLinks:(NSDictionary *)links{
-    [self createThumbnailsFromMedia:media];
+    // The client attempt that asked for this page worked
+    if(pageSuccess){
+        void (^success)(id) = pageSuccess;
+        pageSuccess = nil;
+        pageFailure = nil;
+        success(links);
+    }
+    media = [self resolveMedia:media ofList:mediaList];
     [self reorderThumbnails];
+    [self addMedia:media];
     [loader stopAnimating];
+    // Get the uploaders of the whole page at once, so they are ready for the detail view
+    [[OlapicUploaderPrefetcher sharedPrefetcher] prefetchUploadersForMedia:media];
+    // Every page makes the list bigger, so it's a good moment to check the budgets
+    [[OlapicMemoryGovernor sharedGovernor] enforceBudgets];
+    // Once the first page is here, start polling for the new media
+    if(!sync){
+        sync = [[OlapicMediaListSync alloc] initWithList:mediaList delegate:self];
+    }
+    if(![sync running]){
+        [sync start];
+    }
 }
 /**
  *  In case the media list object finds an error while downloading the content
@@ -262,7 +401,164 @@
  *  @param error     The error it found
  */
 -(void)OlapicMediaList:(OlapicMediaList *)mediaList didReceiveAnError:(NSError *)error{
+    // The client decides if the page is asked again, and logs the error after the last attempt
+    if(pageFailure){
+        void (^failure)(NSError *) = pageFailure;
+        pageSuccess = nil;
+        pageFailure = nil;
+        failure(error);
+        return;
+    }
     NSLog(@"LIST ERROR : %@",error);
 }
 
+#pragma mark - Sync Delegate
+/**
+ *  The list contents changed. The thumbnails on the screen are moved
+ *  to their new positions, and only the new and updated media is
+ *  asked to the data source
+ *
+ *  @param listSync The sync object
+ *  @param media    All the media on the list, after the change
+ *  @param diff     The changes between the previous contents and the new ones
+ */
+-(void)mediaListSync:(OlapicMediaListSync *)listSync didChangeMedia:(NSArray *)media withDiff:(OlapicMediaListDiff *)diff{
+    mediaItems = [[NSMutableArray alloc] initWithArray:media];
+    [grid updateWithDeletedIndexes:diff.deletes insertedIndexes:diff.inserts movedIndexes:diff.moves reloadedIndexes:diff.updates];
+}
+
+#pragma mark - Grid Data Source
+/**
+ *  Get the number of thumbnails
+ *
+ *  @param gridView The grid view object
+ *
+ *  @return The number of media downloaded so far
+ */
+-(NSUInteger)numberOfItemsInGridView:(OlapicGridView *)gridView{
+    return [mediaItems count];
+}
+/**
+ *  Get the thumbnail for a media, reusing one that left the screen
+ *  if it's possible
+ *
+ *  @param gridView The grid view object
+ *  @param index    The media index
+ *
+ *  @return The thumbnail
+ */
+-(UIView *)gridView:(OlapicGridView *)gridView cellForItemAtIndex:(NSUInteger)index{
+    OlapicAsyncImageView *thumb = [gridView dequeueReusableCell];
+    if(!thumb){
+        thumb = [self createThumbnail];
+    }
+    thumb.media = [mediaItems objectAtIndex:index];
+    [thumb download];
+    return thumb;
+}
+/**
+ *  Start downloading the thumbnails that are close to the screen
+ *
+ *  @param gridView The grid view object
+ *  @param indexes  The media indexes
+ */
+-(void)gridView:(OlapicGridView *)gridView prefetchItemsAtIndexes:(NSIndexSet *)indexes{
+    [[OlapicImageLoader sharedImageLoader] prefetchImagesWithSize:OlapicMediaImageSizeThumbnail forMedia:[self mediaAtIndexes:indexes]];
+}
+/**
+ *  Stop downloading the thumbnails that are not close to the screen anymore
+ *
+ *  @param gridView The grid view object
+ *  @param indexes  The media indexes
+ */
+-(void)gridView:(OlapicGridView *)gridView cancelPrefetchingItemsAtIndexes:(NSIndexSet *)indexes{
+    [[OlapicImageLoader sharedImageLoader] cancelPrefetchingImagesWithSize:OlapicMediaImageSizeThumbnail forMedia:[self mediaAtIndexes:indexes]];
+}
+
+#pragma mark - Grid Delegate
+/**
+ *  The user is close to the end of the gallery, so the next page is loaded
+ *
+ *  @param gridView The grid view object
+ */
+-(void)gridViewDidReachTheEnd:(OlapicGridView *)gridView{
+    // The list loads its pages, the client only sends the attempts
+    if(![list fetching]){
+        [self loadNextPage];
+    }
+}
+
+#pragma mark - Memory consumer
+/**
+ *  Get the number of bytes the list pages are using
+ *
+ *  @return The estimated number of bytes
+ */
+-(unsigned long long)memoryUsage{
+    return [OlapicMemoryGovernor estimatedSizeOfObject:[list pages]];
+}
+/**
+ *  Drop the pages after the screen (plus one page of margin), from the
+ *  last one, until the list uses at most a number of bytes. The list
+ *  state (the current page, its URL and the links) goes back to the last
+ *  page kept, so the dropped pages are requested again when the user
+ *  scrolls to them
+ *
+ *  @param size The number of bytes the pages can keep
+ */
+-(void)purgeMemoryToSize:(unsigned long long)size{
+    NSMutableArray *pages = [list pages];
+    if([list fetching] || loadingPage || [pages count] < 2) return;
+    // Find the page with the last item on the screen
+    NSUInteger lastVisible = NSMaxRange([grid rangeOfItemsInRect:grid.bounds]);
+    NSUInteger keptPages = 0;
+    NSUInteger keptMedia = 0;
+    while(keptPages < [pages count] && keptMedia <= lastVisible){
+        keptMedia += [[[pages objectAtIndex:keptPages] valueForKey:@"media"] count];
+        keptPages++;
+    }
+    keptPages = MIN([pages count], keptPages + 1);
+    unsigned long long usage = [self memoryUsage];
+    BOOL dropped = NO;
+    while([pages count] > keptPages && usage > size){
+        usage -= MIN(usage, [OlapicMemoryGovernor estimatedSizeOfObject:[pages lastObject]]);
+        [pages removeLastObject];
+        dropped = YES;
+    }
+    if(!dropped) return;
+    // The list state points to the last page kept, like after loading it
+    NSDictionary *links = [[pages lastObject] valueForKey:@"links"];
+    NSString *current = [OlapicMediaListSync URLFromLink:[links valueForKey:@"self"]];
+    if(!current){
+        // Each page is the next one of the page before it
+        current = [pages count] > 1 ? [OlapicMediaListSync URLFromLink:[[[pages objectAtIndex:([pages count] - 2)] valueForKey:@"links"] valueForKey:@"next"]] : list.initialURL;
+    }
+    if(current){
+        list.currentURL = [[NSMutableString alloc] initWithString:current];
+    }
+    list.currentOffset = [pages count] - 1;
+    NSString *prev = [OlapicMediaListSync URLFromLink:[links valueForKey:@"prev"]];
+    list.prevURL = prev ? [[NSMutableString alloc] initWithString:prev] : nil;
+    NSString *next = [OlapicMediaListSync URLFromLink:[links valueForKey:@"next"]];
+    list.nextURL = next ? [[NSMutableString alloc] initWithString:next] : nil;
+    // The items follow the order of the pages
+    NSUInteger remaining = 0;
+    for(int p = 0; p < [pages count]; p++){
+        remaining += [[[pages objectAtIndex:p] valueForKey:@"media"] count];
+    }
+    if(remaining < [mediaItems count]){
+        NSRange removed = NSMakeRange(remaining, [mediaItems count] - remaining);
+        [mediaItems removeObjectsInRange:removed];
+        [grid deleteItemsAtIndexes:[NSIndexSet indexSetWithIndexesInRange:removed]];
+    }
+}
+/**
+ *  Stop the sync and remove the observer and the memory consumer
+ */
+-(void)dealloc{
+    [sync stop];
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+    [[OlapicMemoryGovernor sharedGovernor] removeConsumerWithName:@"pages"];
+}
+
 @end
\ No newline at end of file
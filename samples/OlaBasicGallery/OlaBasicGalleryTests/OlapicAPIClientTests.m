@@ -0,0 +1,152 @@
+//
+//  OlapicAPIClientTests.m
+//  OlaBasicGalleryTests
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <OlapicSDK/OlapicSDK.h>
+#import "OlapicAPIClient+Futures.h"
+
+@interface OlapicAPIClient (Testing)
+-(void)reachabilityDidChange:(NSNotification *)notification;
+@end
+
+/**
+ *  A reachability object that says what the tests want
+ */
+@interface OlapicStubReachability : OlapicReachability
+
+@property (nonatomic) BOOL reachable;
+
+@end
+
+@implementation OlapicStubReachability
+
+-(BOOL)isReachable{
+    return self.reachable;
+}
+
+@end
+
+/**
+ *  A client with a reachability object of the tests
+ */
+@interface OlapicStubAPIClient : OlapicAPIClient
+
+-(void)useReachability:(OlapicReachability *)stubReachability;
+
+@end
+
+@implementation OlapicStubAPIClient
+
+-(void)useReachability:(OlapicReachability *)stubReachability{
+    reachability = stubReachability;
+}
+
+@end
+
+@interface OlapicAPIClientTests : XCTestCase{
+    OlapicStubAPIClient *client;
+    OlapicStubReachability *stubReachability;
+}
+
+@end
+
+@implementation OlapicAPIClientTests
+
+-(void)setUp{
+    [super setUp];
+    client = [[OlapicStubAPIClient alloc] init];
+    client.rateLimiter = nil;
+    OlapicRetryPolicy *policy = [OlapicRetryPolicy defaultPolicy];
+    policy.maximumAttempts = 5;
+    policy.baseDelay = 0.02;
+    policy.maximumDelay = 0.02;
+    client.retryPolicy = policy;
+    stubReachability = [[OlapicStubReachability alloc] initWithHost:@"api.olapic.test"];
+    stubReachability.reachable = YES;
+    [client useReachability:stubReachability];
+}
+/**
+ *  Run the main run loop for a while, so the retries scheduled on it run
+ *
+ *  @param seconds The time to wait
+ */
+-(void)spinRunLoop:(NSTimeInterval)seconds{
+    [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:seconds]];
+}
+/**
+ *  Create an error the client retries
+ *
+ *  @return The error object
+ */
+-(NSError *)temporaryError{
+    return [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorTimedOut userInfo:nil];
+}
+
+-(void)testFailedRequestsAreRetried{
+    __block NSUInteger attempts = 0;
+    __block NSError *received = nil;
+    [client performRequestForURL:@"https://api.olapic.test/media/1" priority:OlapicRequestPriorityNormal withBlock:^(void (^success)(id response), void (^failure)(NSError *error)){
+        attempts++;
+        failure([self temporaryError]);
+    } policy:nil onSuccess:nil onFailure:^(NSError *error){
+        received = error;
+    }];
+    [self spinRunLoop:0.5];
+    XCTAssertEqual(attempts, (NSUInteger)5);
+    XCTAssertNotNil(received);
+}
+
+-(void)testCancelledFuturesAreNotRetried{
+    __block NSUInteger attempts = 0;
+    OlapicFuture *future = [client futureForURL:@"https://api.olapic.test/media/1" endpoint:nil priority:OlapicRequestPriorityNormal withBlock:^(void (^success)(id response), void (^failure)(NSError *error)){
+        attempts++;
+        failure([self temporaryError]);
+    }];
+    XCTAssertEqual(attempts, (NSUInteger)1);
+    [future cancel];
+    [self spinRunLoop:0.5];
+    XCTAssertEqual(attempts, (NSUInteger)1);
+    XCTAssertTrue([future isCancelled]);
+}
+
+-(void)testCancelledFuturesLeaveTheHeldRequests{
+    __block NSUInteger attempts = 0;
+    stubReachability.reachable = NO;
+    OlapicFuture *future = [client futureForURL:@"https://api.olapic.test/media/1" endpoint:nil priority:OlapicRequestPriorityNormal withBlock:^(void (^success)(id response), void (^failure)(NSError *error)){
+        attempts++;
+        success(@{});
+    }];
+    XCTAssertEqual([client heldRequestCount], (NSUInteger)1);
+    [future cancel];
+    XCTAssertEqual([client heldRequestCount], (NSUInteger)0);
+    stubReachability.reachable = YES;
+    [client reachabilityDidChange:nil];
+    [self spinRunLoop:0.1];
+    XCTAssertEqual(attempts, (NSUInteger)0);
+}
+
+-(void)testCancelledRequestsDontCallTheCallbacks{
+    __block void (^pendingSuccess)(id) = nil;
+    __block BOOL called = NO;
+    NSString *identifier = [client performRequestForURL:@"https://api.olapic.test/media/1" priority:OlapicRequestPriorityNormal withBlock:^(void (^success)(id response), void (^failure)(NSError *error)){
+        pendingSuccess = success;
+    } policy:nil onSuccess:^(id response){
+        called = YES;
+    } onFailure:^(NSError *error){
+        called = YES;
+    }];
+    XCTAssertNotNil(identifier);
+    XCTAssertNotNil(pendingSuccess);
+    [client cancelRequest:identifier];
+    // The attempt was already sent, so its response arrives anyway
+    pendingSuccess(@{});
+    [self spinRunLoop:0.1];
+    XCTAssertFalse(called);
+}
+
+@end
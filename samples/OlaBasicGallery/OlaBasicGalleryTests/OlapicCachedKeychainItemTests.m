@@ -0,0 +1,166 @@
+//
+//  OlapicCachedKeychainItemTests.m
+//  OlaBasicGalleryTests
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic. All rights reserved.
+//
+
+// The number of reads on every measured run, like the checks of a page of requests
+#define kReadsPerRun 1000
+
+#import <XCTest/XCTest.h>
+#import "OlapicCachedKeychainItem.h"
+
+/**
+ *  A keychain item that keeps its values in a dictionary and counts
+ *  the reads, so the tests don't touch the real keychain
+ */
+@interface OlapicStubKeychainItem : KeychainItemWrapper{
+    NSMutableDictionary *stored;
+}
+
+@property (nonatomic) NSUInteger reads;
+@property (nonatomic) NSUInteger writes;
+
+@end
+
+@implementation OlapicStubKeychainItem
+
+-(id)init{
+    self = [super init];
+    if(self){
+        stored = [[NSMutableDictionary alloc] init];
+    }
+    return self;
+}
+
+-(id)objectForKey:(id)key{
+    // A keychain query is not free, so the stub isn't either
+    [NSThread sleepForTimeInterval:0.0005];
+    self.reads++;
+    return [stored objectForKey:key];
+}
+
+-(void)setObject:(id)inObject forKey:(id)key{
+    self.writes++;
+    if(inObject){
+        [stored setObject:inObject forKey:key];
+    }else{
+        [stored removeObjectForKey:key];
+    }
+}
+
+-(NSDictionary *)getDataDictionary{
+    self.reads++;
+    return [stored copy];
+}
+
+-(void)saveDataDictionary:(NSDictionary *)dict{
+    self.writes++;
+    stored = [dict mutableCopy];
+}
+
+-(void)resetKeychainItem{
+    [stored removeAllObjects];
+}
+
+@end
+
+@interface OlapicCachedKeychainItemTests : XCTestCase
+
+@end
+
+@implementation OlapicCachedKeychainItemTests
+
+-(void)testReadsTheWrappedItemOnce{
+    OlapicStubKeychainItem *stub = [[OlapicStubKeychainItem alloc] init];
+    [stub setObject:@"token" forKey:@"access_token"];
+    OlapicCachedKeychainItem *item = [[OlapicCachedKeychainItem alloc] initWithKeychainItem:stub];
+    XCTAssertEqual([item keychainItem], (KeychainItemWrapper *)stub);
+    for(int i = 0; i < 10; i++){
+        XCTAssertEqualObjects([item objectForKey:@"access_token"], @"token");
+    }
+    XCTAssertEqual(stub.reads, (NSUInteger)1);
+}
+
+-(void)testMissingValuesAreCachedToo{
+    OlapicStubKeychainItem *stub = [[OlapicStubKeychainItem alloc] init];
+    OlapicCachedKeychainItem *item = [[OlapicCachedKeychainItem alloc] initWithKeychainItem:stub];
+    XCTAssertNil([item objectForKey:@"scope"]);
+    XCTAssertNil([item objectForKey:@"scope"]);
+    XCTAssertEqual(stub.reads, (NSUInteger)1);
+}
+
+-(void)testWritesAreReadBackAndReachTheWrappedItem{
+    OlapicStubKeychainItem *stub = [[OlapicStubKeychainItem alloc] init];
+    OlapicCachedKeychainItem *item = [[OlapicCachedKeychainItem alloc] initWithKeychainItem:stub];
+    [item setObject:@"first" forKey:@"access_token"];
+    [item setObject:@"second" forKey:@"access_token"];
+    XCTAssertEqualObjects([item objectForKey:@"access_token"], @"second");
+    [item flush];
+    XCTAssertEqual(stub.writes, (NSUInteger)2);
+    XCTAssertEqualObjects([stub objectForKey:@"access_token"], @"second");
+}
+
+-(void)testDataDictionaryIsCached{
+    OlapicStubKeychainItem *stub = [[OlapicStubKeychainItem alloc] init];
+    [stub saveDataDictionary:@{@"scope": @"read"}];
+    OlapicCachedKeychainItem *item = [[OlapicCachedKeychainItem alloc] initWithKeychainItem:stub];
+    XCTAssertEqualObjects([[item getDataDictionary] objectForKey:@"scope"], @"read");
+    XCTAssertEqualObjects([[item getDataDictionary] objectForKey:@"scope"], @"read");
+    XCTAssertEqual(stub.reads, (NSUInteger)1);
+}
+
+-(void)testValueWritesAreSeenByTheDataDictionary{
+    OlapicStubKeychainItem *stub = [[OlapicStubKeychainItem alloc] init];
+    [stub saveDataDictionary:@{@"scope": @"read"}];
+    OlapicCachedKeychainItem *item = [[OlapicCachedKeychainItem alloc] initWithKeychainItem:stub];
+    XCTAssertEqualObjects([[item getDataDictionary] objectForKey:@"scope"], @"read");
+    [item setObject:@"write" forKey:@"scope"];
+    XCTAssertEqualObjects([[item getDataDictionary] objectForKey:@"scope"], @"write");
+}
+
+-(void)testDataDictionaryWritesAreSeenByTheValues{
+    OlapicStubKeychainItem *stub = [[OlapicStubKeychainItem alloc] init];
+    [stub setObject:@"token" forKey:@"access_token"];
+    OlapicCachedKeychainItem *item = [[OlapicCachedKeychainItem alloc] initWithKeychainItem:stub];
+    XCTAssertEqualObjects([item objectForKey:@"access_token"], @"token");
+    XCTAssertNil([item objectForKey:@"scope"]);
+    [item saveDataDictionary:@{@"access_token": @"other", @"scope": @"read"}];
+    XCTAssertEqualObjects([item objectForKey:@"access_token"], @"other");
+    XCTAssertEqualObjects([item objectForKey:@"scope"], @"read");
+}
+
+-(void)testResetClearsTheMemory{
+    OlapicStubKeychainItem *stub = [[OlapicStubKeychainItem alloc] init];
+    OlapicCachedKeychainItem *item = [[OlapicCachedKeychainItem alloc] initWithKeychainItem:stub];
+    [item setObject:@"token" forKey:@"access_token"];
+    [item resetKeychainItem];
+    XCTAssertNil([item objectForKey:@"access_token"]);
+    XCTAssertNil([stub objectForKey:@"access_token"]);
+}
+
+-(void)testCachedReadsPerformance{
+    OlapicStubKeychainItem *stub = [[OlapicStubKeychainItem alloc] init];
+    [stub setObject:@"token" forKey:@"access_token"];
+    OlapicCachedKeychainItem *item = [[OlapicCachedKeychainItem alloc] initWithKeychainItem:stub];
+    [self measureBlock:^{
+        for(int i = 0; i < kReadsPerRun; i++){
+            [item objectForKey:@"access_token"];
+        }
+    }];
+    XCTAssertEqual(stub.reads, (NSUInteger)1);
+}
+
+-(void)testUncachedReadsPerformance{
+    OlapicStubKeychainItem *stub = [[OlapicStubKeychainItem alloc] init];
+    [stub setObject:@"token" forKey:@"access_token"];
+    [self measureBlock:^{
+        for(int i = 0; i < kReadsPerRun; i++){
+            [stub objectForKey:@"access_token"];
+        }
+    }];
+}
+
+@end
@@ -0,0 +1,111 @@
+//
+//  OlapicCircuitBreakerTests.m
+//  OlaBasicGalleryTests
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "OlapicCircuitBreaker.h"
+
+@interface OlapicCircuitBreakerTests : XCTestCase
+
+@end
+
+@implementation OlapicCircuitBreakerTests
+/**
+ *  Open a circuit with a short reset time and wait until it's half open
+ *
+ *  @return The circuit breaker
+ */
+-(OlapicCircuitBreaker *)halfOpenBreaker{
+    OlapicCircuitBreaker *breaker = [[OlapicCircuitBreaker alloc] initWithName:@"test" failureThreshold:1 resetTimeout:0.05];
+    [breaker recordFailure];
+    [NSThread sleepForTimeInterval:0.1];
+    return breaker;
+}
+
+-(void)testStartsClosed{
+    OlapicCircuitBreaker *breaker = [[OlapicCircuitBreaker alloc] initWithName:@"test" failureThreshold:3 resetTimeout:30];
+    XCTAssertEqual([breaker state], OlapicCircuitBreakerStateClosed);
+    XCTAssertTrue([breaker allowRequest]);
+    XCTAssertEqual([breaker timeUntilRetry], (NSTimeInterval)0);
+}
+
+-(void)testOpensAfterTheThreshold{
+    OlapicCircuitBreaker *breaker = [[OlapicCircuitBreaker alloc] initWithName:@"test" failureThreshold:3 resetTimeout:30];
+    [breaker recordFailure];
+    [breaker recordFailure];
+    XCTAssertEqual([breaker state], OlapicCircuitBreakerStateClosed);
+    XCTAssertTrue([breaker allowRequest]);
+    [breaker recordFailure];
+    XCTAssertEqual([breaker state], OlapicCircuitBreakerStateOpen);
+    XCTAssertFalse([breaker allowRequest]);
+    XCTAssertTrue([breaker timeUntilRetry] > 29 && [breaker timeUntilRetry] <= 30);
+}
+
+-(void)testSuccessForgetsTheFailures{
+    OlapicCircuitBreaker *breaker = [[OlapicCircuitBreaker alloc] initWithName:@"test" failureThreshold:2 resetTimeout:30];
+    [breaker recordFailure];
+    [breaker recordSuccess];
+    XCTAssertEqual([breaker consecutiveFailures], (NSUInteger)0);
+    [breaker recordFailure];
+    XCTAssertEqual([breaker state], OlapicCircuitBreakerStateClosed);
+}
+
+-(void)testHalfOpenAllowsASingleRequest{
+    OlapicCircuitBreaker *breaker = [self halfOpenBreaker];
+    XCTAssertEqual([breaker state], OlapicCircuitBreakerStateHalfOpen);
+    XCTAssertTrue([breaker allowRequest]);
+    XCTAssertFalse([breaker allowRequest]);
+    [breaker recordSuccess];
+    XCTAssertEqual([breaker state], OlapicCircuitBreakerStateClosed);
+    XCTAssertTrue([breaker allowRequest]);
+}
+
+-(void)testFailedTestRequestOpensAgain{
+    OlapicCircuitBreaker *breaker = [self halfOpenBreaker];
+    XCTAssertTrue([breaker allowRequest]);
+    [breaker recordFailure];
+    XCTAssertEqual([breaker state], OlapicCircuitBreakerStateOpen);
+    XCTAssertFalse([breaker allowRequest]);
+}
+
+-(void)testCancelledTestRequestLetsAnotherOne{
+    OlapicCircuitBreaker *breaker = [self halfOpenBreaker];
+    XCTAssertTrue([breaker allowRequest]);
+    [breaker recordCancellation];
+    XCTAssertEqual([breaker state], OlapicCircuitBreakerStateHalfOpen);
+    XCTAssertTrue([breaker allowRequest]);
+}
+
+-(void)testResetClosesTheCircuit{
+    OlapicCircuitBreaker *breaker = [[OlapicCircuitBreaker alloc] initWithName:@"test" failureThreshold:1 resetTimeout:30];
+    [breaker recordFailure];
+    [breaker reset];
+    XCTAssertEqual([breaker state], OlapicCircuitBreakerStateClosed);
+    XCTAssertTrue([breaker allowRequest]);
+}
+
+-(void)testStateChangesArePosted{
+    OlapicCircuitBreaker *breaker = [[OlapicCircuitBreaker alloc] initWithName:@"test" failureThreshold:1 resetTimeout:30];
+    __block NSUInteger changes = 0;
+    id observer = [[NSNotificationCenter defaultCenter] addObserverForName:OlapicCircuitBreakerDidChangeStateNotification object:breaker queue:nil usingBlock:^(NSNotification *notification){
+        changes++;
+    }];
+    [breaker recordFailure];
+    [breaker recordFailure];
+    [breaker recordSuccess];
+    [[NSNotificationCenter defaultCenter] removeObserver:observer];
+    // Closed to open, and open to closed
+    XCTAssertEqual(changes, (NSUInteger)2);
+}
+
+-(void)testStateNames{
+    XCTAssertEqualObjects([OlapicCircuitBreaker nameForState:OlapicCircuitBreakerStateClosed], @"closed");
+    XCTAssertEqualObjects([OlapicCircuitBreaker nameForState:OlapicCircuitBreakerStateOpen], @"open");
+    XCTAssertEqualObjects([OlapicCircuitBreaker nameForState:OlapicCircuitBreakerStateHalfOpen], @"half-open");
+}
+
+@end
@@ -0,0 +1,238 @@
+//
+//  OlapicCurationBatchTests.m
+//  OlaBasicGalleryTests
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <OlapicSDK/OlapicSDK.h>
+#import "OlapicCurationBatch.h"
+
+@interface OlapicCurationBatch (Testing)
+-(void)sendChunk:(NSArray *)chunk;
+-(void)finishChunk:(NSArray *)chunk withResult:(NSArray *)result error:(NSError *)error;
+@end
+
+/**
+ *  Keeps the chunks instead of sending them, so the tests decide how
+ *  each request ends
+ */
+@interface OlapicStubCurationBatch : OlapicCurationBatch
+
+@property (nonatomic,strong) NSMutableArray *sentChunks;
+
+@end
+
+@implementation OlapicStubCurationBatch
+
+-(void)sendChunk:(NSArray *)chunk{
+    if(!self.sentChunks) self.sentChunks = [[NSMutableArray alloc] init];
+    for(int i = 0; i < [chunk count]; i++){
+        NSMutableDictionary *item = [chunk objectAtIndex:i];
+        [item setObject:@(OlapicCurationBatchItemStateRunning) forKey:@"state"];
+        [item setObject:@([[item objectForKey:@"attempts"] unsignedIntegerValue] + 1) forKey:@"attempts"];
+    }
+    [self.sentChunks addObject:chunk];
+}
+
+@end
+
+@interface OlapicCurationBatchTests : XCTestCase <OlapicCurationBatchDelegate>{
+    NSArray *finishedFailedItems;
+    float lastProgress;
+}
+
+@end
+
+@implementation OlapicCurationBatchTests
+
+-(void)setUp{
+    [super setUp];
+    finishedFailedItems = nil;
+    lastProgress = -1;
+}
+/**
+ *  Create media objects
+ *
+ *  @param count The number of media
+ *
+ *  @return An array of OlapicCurationMediaEntity objects
+ */
+-(NSArray *)media:(NSUInteger)count{
+    NSMutableArray *media = [[NSMutableArray alloc] init];
+    for(int i = 0; i < count; i++){
+        [media addObject:[[OlapicCurationMediaEntity alloc] initWithData:@{@"id": [NSString stringWithFormat:@"batch-media-%d", i]}]];
+    }
+    return media;
+}
+/**
+ *  Create stream objects
+ *
+ *  @param count The number of streams
+ *
+ *  @return An array of OlapicStreamEntity objects
+ */
+-(NSArray *)streams:(NSUInteger)count{
+    NSMutableArray *streams = [[NSMutableArray alloc] init];
+    for(int i = 0; i < count; i++){
+        [streams addObject:[[OlapicStreamEntity alloc] initWithData:@{@"id": [NSString stringWithFormat:@"batch-stream-%d", i]}]];
+    }
+    return streams;
+}
+/**
+ *  Create the result of a link or unlink request
+ *
+ *  @param flags The 'done' flag of each stream
+ *
+ *  @return The result, as the SDK sends it
+ */
+-(NSArray *)linkResultWithFlags:(NSArray *)flags{
+    NSMutableArray *result = [[NSMutableArray alloc] init];
+    for(int i = 0; i < [flags count]; i++){
+        [result addObject:@{@"done": [flags objectAtIndex:i]}];
+    }
+    return result;
+}
+/**
+ *  Get the number of items of every chunk that was sent
+ *
+ *  @param batch The batch
+ *
+ *  @return An array of numbers
+ */
+-(NSArray *)chunkSizesOfBatch:(OlapicStubCurationBatch *)batch{
+    NSMutableArray *sizes = [[NSMutableArray alloc] init];
+    for(int i = 0; i < [batch.sentChunks count]; i++){
+        [sizes addObject:@([[batch.sentChunks objectAtIndex:i] count])];
+    }
+    return sizes;
+}
+/**
+ *  Run the main run loop for a while, so the retries scheduled on it run
+ *
+ *  @param seconds The time to wait
+ */
+-(void)spinRunLoop:(NSTimeInterval)seconds{
+    [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:seconds]];
+}
+
+-(void)curationBatch:(OlapicCurationBatch *)batch didChangeProgress:(float)progress{
+    lastProgress = progress;
+}
+
+-(void)curationBatch:(OlapicCurationBatch *)batch didFinishWithFailedItems:(NSArray *)failed{
+    finishedFailedItems = failed;
+}
+
+-(void)testStatusesAreSplitInChunks{
+    OlapicStubCurationBatch *batch = [[OlapicStubCurationBatch alloc] initForSettingStatus:nil forMedia:[self media:60] delegate:self];
+    batch.chunkSize = 25;
+    [batch start];
+    XCTAssertEqualObjects([self chunkSizesOfBatch:batch], (@[@25, @25, @10]));
+}
+
+-(void)testLinksAreSplitPerMedia{
+    OlapicStubCurationBatch *batch = [[OlapicStubCurationBatch alloc] initForLinkingMedia:[self media:3] toStreams:[self streams:2] delegate:self];
+    [batch start];
+    XCTAssertEqualObjects([self chunkSizesOfBatch:batch], (@[@2, @2, @2]));
+    for(int i = 0; i < [batch.sentChunks count]; i++){
+        NSArray *chunk = [batch.sentChunks objectAtIndex:i];
+        XCTAssertEqual([[chunk firstObject] objectForKey:@"media"], [[chunk lastObject] objectForKey:@"media"]);
+    }
+}
+
+-(void)testLinksOfAMediaAreSplitByChunkSize{
+    OlapicStubCurationBatch *batch = [[OlapicStubCurationBatch alloc] initForUnlinkingMedia:[self media:1] fromStreams:[self streams:5] delegate:self];
+    batch.chunkSize = 2;
+    [batch start];
+    XCTAssertEqualObjects([self chunkSizesOfBatch:batch], (@[@2, @2, @1]));
+}
+
+-(void)testOnlyTheConcurrentChunksAreSent{
+    OlapicStubCurationBatch *batch = [[OlapicStubCurationBatch alloc] initForSettingStatus:nil forMedia:[self media:10] delegate:self];
+    batch.chunkSize = 2;
+    batch.maximumConcurrentChunks = 2;
+    [batch start];
+    XCTAssertEqual([batch.sentChunks count], (NSUInteger)2);
+    [batch finishChunk:[batch.sentChunks firstObject] withResult:@[] error:nil];
+    XCTAssertEqual([batch.sentChunks count], (NSUInteger)3);
+    XCTAssertEqualWithAccuracy(lastProgress, 0.2, 0.001);
+    XCTAssertTrue([batch isRunning]);
+}
+
+-(void)testTheBatchFinishesWhenEveryChunkIsDone{
+    OlapicStubCurationBatch *batch = [[OlapicStubCurationBatch alloc] initForSettingStatus:nil forMedia:[self media:3] delegate:self];
+    batch.chunkSize = 2;
+    [batch start];
+    for(int i = 0; i < [batch.sentChunks count]; i++){
+        [batch finishChunk:[batch.sentChunks objectAtIndex:i] withResult:@[] error:nil];
+    }
+    XCTAssertFalse([batch isRunning]);
+    XCTAssertEqual([[batch completedItems] count], (NSUInteger)3);
+    XCTAssertEqual([finishedFailedItems count], (NSUInteger)0);
+    XCTAssertEqualWithAccuracy([batch progress], 1, 0.001);
+}
+
+-(void)testEachLinkGetsItsOwnResult{
+    OlapicStubCurationBatch *batch = [[OlapicStubCurationBatch alloc] initForLinkingMedia:[self media:1] toStreams:[self streams:2] delegate:self];
+    batch.retryPolicy = [OlapicRetryPolicy noRetryPolicy];
+    [batch start];
+    [batch finishChunk:[batch.sentChunks firstObject] withResult:[self linkResultWithFlags:@[@YES, @NO]] error:nil];
+    XCTAssertEqual([[batch completedItems] count], (NSUInteger)1);
+    XCTAssertEqual([[batch failedItems] count], (NSUInteger)1);
+    XCTAssertEqual([[[[batch failedItems] firstObject] objectForKey:@"error"] code], 0);
+    XCTAssertEqual([finishedFailedItems count], (NSUInteger)1);
+}
+
+-(void)testAnUnexpectedResultFailsTheItems{
+    OlapicStubCurationBatch *batch = [[OlapicStubCurationBatch alloc] initForLinkingMedia:[self media:1] toStreams:[self streams:2] delegate:self];
+    [batch start];
+    // A flag per stream, without the entry dictionaries
+    [batch finishChunk:[batch.sentChunks firstObject] withResult:@[@YES, @YES] error:nil];
+    XCTAssertEqual([[batch completedItems] count], (NSUInteger)0);
+    XCTAssertEqual([finishedFailedItems count], (NSUInteger)2);
+    XCTAssertEqual([[[finishedFailedItems firstObject] objectForKey:@"error"] code], 1);
+    // They aren't sent again, even with attempts left
+    XCTAssertEqual([batch.sentChunks count], (NSUInteger)1);
+}
+
+-(void)testAMissingEntryFailsTheItems{
+    OlapicStubCurationBatch *batch = [[OlapicStubCurationBatch alloc] initForLinkingMedia:[self media:1] toStreams:[self streams:2] delegate:self];
+    [batch start];
+    [batch finishChunk:[batch.sentChunks firstObject] withResult:[self linkResultWithFlags:@[@YES]] error:nil];
+    XCTAssertEqual([finishedFailedItems count], (NSUInteger)2);
+}
+
+-(void)testOnlyTheItemsNotDoneAreRetried{
+    OlapicStubCurationBatch *batch = [[OlapicStubCurationBatch alloc] initForLinkingMedia:[self media:1] toStreams:[self streams:3] delegate:self];
+    OlapicRetryPolicy *policy = [OlapicRetryPolicy defaultPolicy];
+    policy.maximumDelay = 0;
+    batch.retryPolicy = policy;
+    [batch start];
+    NSArray *chunk = [batch.sentChunks firstObject];
+    [batch finishChunk:chunk withResult:[self linkResultWithFlags:@[@YES, @NO, @YES]] error:nil];
+    [self spinRunLoop:0.1];
+    XCTAssertEqual([batch.sentChunks count], (NSUInteger)2);
+    NSArray *retry = [batch.sentChunks lastObject];
+    XCTAssertEqual([retry count], (NSUInteger)1);
+    XCTAssertEqual([retry firstObject], [chunk objectAtIndex:1]);
+    XCTAssertEqualObjects([[retry firstObject] objectForKey:@"attempts"], @2);
+}
+
+-(void)testRetryFailedItemsSendsOnlyTheFailedOnes{
+    OlapicStubCurationBatch *batch = [[OlapicStubCurationBatch alloc] initForSettingStatus:nil forMedia:[self media:4] delegate:self];
+    batch.chunkSize = 2;
+    batch.retryPolicy = [OlapicRetryPolicy noRetryPolicy];
+    [batch start];
+    [batch finishChunk:[batch.sentChunks objectAtIndex:0] withResult:@[] error:nil];
+    [batch finishChunk:[batch.sentChunks objectAtIndex:1] withResult:nil error:[NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorTimedOut userInfo:nil]];
+    XCTAssertEqual([finishedFailedItems count], (NSUInteger)2);
+    [batch retryFailedItems];
+    XCTAssertEqual([batch.sentChunks count], (NSUInteger)3);
+    XCTAssertEqualObjects([batch.sentChunks lastObject], [batch.sentChunks objectAtIndex:1]);
+    XCTAssertEqualWithAccuracy([batch progress], 0.5, 0.001);
+}
+
+@end
@@ -0,0 +1,207 @@
+//
+//  OlapicCurationSearchSessionTests.m
+//  OlaBasicGalleryTests
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <OlapicSDK/OlapicSDK.h>
+#import "OlapicCurationSearchSession.h"
+
+@interface OlapicCurationSearchSession (Testing)
+-(void)startSearchForQuery:(OlapicCurationSearchQuery *)query;
+@end
+
+/**
+ *  Keeps the searches instead of sending them, so the tests decide
+ *  the results of each one
+ */
+@interface OlapicStubCurationSearchSession : OlapicCurationSearchSession
+
+@property (nonatomic,strong) NSMutableArray *startedQueries;
+
+-(void)finishSearchWithMedia:(NSArray *)media;
+
+@end
+
+@implementation OlapicStubCurationSearchSession
+
+-(void)startSearchForQuery:(OlapicCurationSearchQuery *)query{
+    if(!self.startedQueries) self.startedQueries = [[NSMutableArray alloc] init];
+    [self.startedQueries addObject:query];
+    currentList = [[OlapicCurationMediaList alloc] init];
+}
+
+-(void)finishSearchWithMedia:(NSArray *)media{
+    [self OlapicMediaList:currentList didLoadMedia:media withLinks:@{}];
+}
+
+@end
+
+@interface OlapicCurationSearchSessionTests : XCTestCase <OlapicCurationSearchSessionDelegate>{
+    NSMutableArray *foundMedia;
+    NSMutableArray *finalFlags;
+}
+
+@end
+
+@implementation OlapicCurationSearchSessionTests
+
+-(void)setUp{
+    [super setUp];
+    foundMedia = [[NSMutableArray alloc] init];
+    finalFlags = [[NSMutableArray alloc] init];
+}
+/**
+ *  Create a query
+ *
+ *  @param text The query text
+ *
+ *  @return The query
+ */
+-(OlapicCurationSearchQuery *)queryWithText:(NSString *)text{
+    return [[OlapicCurationSearchQuery alloc] initWithText:text];
+}
+/**
+ *  Create media objects with a caption
+ *
+ *  @param captions The caption of each media
+ *
+ *  @return An array of OlapicMediaEntity objects
+ */
+-(NSArray *)mediaWithCaptions:(NSArray *)captions{
+    NSMutableArray *media = [[NSMutableArray alloc] init];
+    for(int i = 0; i < [captions count]; i++){
+        [media addObject:[[OlapicMediaEntity alloc] initWithData:@{@"id": [NSString stringWithFormat:@"search-media-%d", i], @"caption": [captions objectAtIndex:i]}]];
+    }
+    return media;
+}
+/**
+ *  Run the main run loop for a while, so the debounce timer can fire
+ *
+ *  @param seconds The time to wait
+ */
+-(void)spinRunLoop:(NSTimeInterval)seconds{
+    [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:seconds]];
+}
+
+-(void)searchSession:(OlapicCurationSearchSession *)session didFindMedia:(NSArray *)media forQuery:(OlapicCurationSearchQuery *)query final:(BOOL)final{
+    [foundMedia addObject:media];
+    [finalFlags addObject:@(final)];
+}
+
+-(void)testKeyIsNormalized{
+    XCTAssertEqualObjects([[self queryWithText:@"  Summer   BEACH\n"] key], [[self queryWithText:@"summer beach"] key]);
+    XCTAssertEqualObjects([[self queryWithText:@" Summer  Beach "] normalizedText], @"summer beach");
+    OlapicCurationSearchQuery *first = [self queryWithText:@"summer"];
+    OlapicCurationSearchQuery *second = [self queryWithText:@"summer"];
+    first.sources = @[@"twitter", @"instagram"];
+    second.sources = @[@"instagram", @"twitter"];
+    XCTAssertEqualObjects([first key], [second key]);
+    second.status = OlapicCurationMediaListStatusFilterTypeApproved;
+    XCTAssertNotEqualObjects([first key], [second key]);
+}
+
+-(void)testEmptyQueriesAndFilters{
+    OlapicCurationSearchQuery *query = [self queryWithText:@"   "];
+    XCTAssertTrue([query isEmpty]);
+    XCTAssertFalse([query hasFilters]);
+    query.favorited = OlapicCurationMediaListFavoritesFilterTypeSaved;
+    XCTAssertTrue([query isEmpty]);
+    XCTAssertTrue([query hasFilters]);
+}
+
+-(void)testNarrowsQuery{
+    OlapicCurationSearchQuery *broader = [self queryWithText:@"summer"];
+    XCTAssertTrue([[self queryWithText:@"summer beach"] narrowsQuery:broader]);
+    XCTAssertTrue([[self queryWithText:@"summers"] narrowsQuery:broader]);
+    XCTAssertFalse([[self queryWithText:@"Summer "] narrowsQuery:broader]);
+    XCTAssertFalse([[self queryWithText:@"winter"] narrowsQuery:broader]);
+    XCTAssertFalse([broader narrowsQuery:[self queryWithText:@"summer beach"]]);
+    OlapicCurationSearchQuery *approved = [self queryWithText:@"summer beach"];
+    approved.status = OlapicCurationMediaListStatusFilterTypeApproved;
+    XCTAssertFalse([approved narrowsQuery:broader]);
+    // A text narrows the search with only the same filters
+    OlapicCurationSearchQuery *filters = [self queryWithText:@""];
+    filters.status = OlapicCurationMediaListStatusFilterTypeApproved;
+    XCTAssertTrue([approved narrowsQuery:filters]);
+}
+
+-(void)testCachedQueriesDontSearchAgain{
+    OlapicStubCurationSearchSession *session = [[OlapicStubCurationSearchSession alloc] initWithDelegate:self];
+    [session searchQueryNow:[self queryWithText:@"summer"]];
+    NSArray *summerMedia = [self mediaWithCaptions:@[@"Summer beach", @"Summer city"]];
+    [session finishSearchWithMedia:summerMedia];
+    [session searchQueryNow:[self queryWithText:@"winter"]];
+    [session finishSearchWithMedia:[self mediaWithCaptions:@[@"Winter"]]];
+    XCTAssertEqual([session.startedQueries count], (NSUInteger)2);
+    // The same query, written in another way, comes from the cache
+    [session searchQueryNow:[self queryWithText:@" SUMMER"]];
+    XCTAssertEqual([session.startedQueries count], (NSUInteger)2);
+    XCTAssertEqualObjects([foundMedia lastObject], summerMedia);
+    XCTAssertEqualObjects([finalFlags lastObject], @YES);
+    // After clearing the cache it's searched again
+    [session clearCache];
+    [session searchQueryNow:[self queryWithText:@"winter"]];
+    XCTAssertEqual([session.startedQueries count], (NSUInteger)3);
+}
+
+-(void)testNarrowerQueriesGetProvisionalResults{
+    OlapicStubCurationSearchSession *session = [[OlapicStubCurationSearchSession alloc] initWithDelegate:self];
+    [session searchQueryNow:[self queryWithText:@"summer"]];
+    [session finishSearchWithMedia:[self mediaWithCaptions:@[@"Summer beach", @"Summer city"]]];
+    [session searchQueryNow:[self queryWithText:@"summer beach"]];
+    XCTAssertEqual([session.startedQueries count], (NSUInteger)2);
+    XCTAssertEqualObjects([finalFlags lastObject], @NO);
+    XCTAssertEqual([[foundMedia lastObject] count], (NSUInteger)1);
+    XCTAssertEqualObjects([[[foundMedia lastObject] firstObject] get:@"caption"], @"Summer beach");
+}
+
+-(void)testQueriesWithOnlyFiltersAreSearched{
+    OlapicStubCurationSearchSession *session = [[OlapicStubCurationSearchSession alloc] initWithDelegate:self];
+    [session searchQueryNow:[self queryWithText:@""]];
+    XCTAssertEqual([session.startedQueries count], (NSUInteger)0);
+    XCTAssertEqualObjects([foundMedia lastObject], @[]);
+    OlapicCurationSearchQuery *query = [self queryWithText:@""];
+    query.favorited = OlapicCurationMediaListFavoritesFilterTypeSaved;
+    [session searchQueryNow:query];
+    XCTAssertEqual([session.startedQueries count], (NSUInteger)1);
+}
+
+-(void)testInputIsDebounced{
+    OlapicStubCurationSearchSession *session = [[OlapicStubCurationSearchSession alloc] initWithDelegate:self];
+    session.debounceInterval = 0.1;
+    [session searchQuery:[self queryWithText:@"s"]];
+    [session searchQuery:[self queryWithText:@"su"]];
+    [session searchQuery:[self queryWithText:@"sum"]];
+    XCTAssertEqual([session.startedQueries count], (NSUInteger)0);
+    [self spinRunLoop:0.3];
+    XCTAssertEqual([session.startedQueries count], (NSUInteger)1);
+    XCTAssertEqualObjects([[session.startedQueries firstObject] text], @"sum");
+}
+
+-(void)testCancelStopsTheDebounce{
+    OlapicStubCurationSearchSession *session = [[OlapicStubCurationSearchSession alloc] initWithDelegate:self];
+    session.debounceInterval = 0.1;
+    [session searchQuery:[self queryWithText:@"summer"]];
+    [session cancel];
+    [self spinRunLoop:0.3];
+    XCTAssertEqual([session.startedQueries count], (NSUInteger)0);
+    XCTAssertNil([session currentQuery]);
+}
+
+-(void)testSessionIsReleasedWhileDebouncing{
+    __weak OlapicStubCurationSearchSession *weakSession = nil;
+    @autoreleasepool{
+        OlapicStubCurationSearchSession *session = [[OlapicStubCurationSearchSession alloc] initWithDelegate:self];
+        session.debounceInterval = 0.1;
+        [session searchQuery:[self queryWithText:@"summer"]];
+        weakSession = session;
+    }
+    XCTAssertNil(weakSession);
+    [self spinRunLoop:0.3];
+}
+
+@end
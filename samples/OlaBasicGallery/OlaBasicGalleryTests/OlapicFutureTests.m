@@ -0,0 +1,180 @@
+//
+//  OlapicFutureTests.m
+//  OlaBasicGalleryTests
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "OlapicFuture.h"
+
+@interface OlapicFutureTests : XCTestCase
+
+@end
+
+@implementation OlapicFutureTests
+/**
+ *  Run the main run loop until a future settles, as the callbacks are
+ *  called on the main queue
+ *
+ *  @param future The future
+ *
+ *  @return If it settled before the time limit
+ */
+-(BOOL)waitForFuture:(OlapicFuture *)future{
+    NSDate *limit = [NSDate dateWithTimeIntervalSinceNow:2];
+    while([future state] == OlapicFutureStatePending && [limit timeIntervalSinceNow] > 0){
+        [[NSRunLoop currentRunLoop] runMode:NSDefaultRunLoopMode beforeDate:[NSDate dateWithTimeIntervalSinceNow:0.01]];
+    }
+    // The callbacks of the settled future can still be on the queue
+    [[NSRunLoop currentRunLoop] runMode:NSDefaultRunLoopMode beforeDate:[NSDate dateWithTimeIntervalSinceNow:0.05]];
+    return [future state] != OlapicFutureStatePending;
+}
+/**
+ *  Create an error for the tests
+ *
+ *  @param code The error code
+ *
+ *  @return The error object
+ */
+-(NSError *)errorWithCode:(NSInteger)code{
+    return [NSError errorWithDomain:@"OlapicFutureTests" code:code userInfo:nil];
+}
+
+-(void)testSettlesOnlyOnce{
+    OlapicFuture *future = [[OlapicFuture alloc] init];
+    XCTAssertTrue([future fulfillWithValue:@1]);
+    XCTAssertFalse([future fulfillWithValue:@2]);
+    XCTAssertFalse([future rejectWithError:[self errorWithCode:1]]);
+    XCTAssertEqual([future state], OlapicFutureStateFulfilled);
+    XCTAssertEqualObjects([future value], @1);
+}
+
+-(void)testCallbacksAfterSettling{
+    __block id received = nil;
+    [[OlapicFuture futureWithValue:@"done"] onSuccess:^(id futureValue){
+        received = futureValue;
+    } onFailure:nil];
+    [[NSRunLoop currentRunLoop] runMode:NSDefaultRunLoopMode beforeDate:[NSDate dateWithTimeIntervalSinceNow:0.05]];
+    XCTAssertEqualObjects(received, @"done");
+}
+
+-(void)testThenChainsTheSteps{
+    OlapicFuture *result = [[[OlapicFuture futureWithValue:@2] then:^OlapicFuture *(id futureValue){
+        return [OlapicFuture futureWithValue:@([futureValue integerValue] * 3)];
+    }] map:^id(id futureValue){
+        return @([futureValue integerValue] + 1);
+    }];
+    XCTAssertTrue([self waitForFuture:result]);
+    XCTAssertEqualObjects([result value], @7);
+}
+
+-(void)testThenSkipsTheStepsAfterAnError{
+    __block BOOL called = NO;
+    OlapicFuture *result = [[OlapicFuture futureWithError:[self errorWithCode:5]] then:^OlapicFuture *(id futureValue){
+        called = YES;
+        return nil;
+    }];
+    XCTAssertTrue([self waitForFuture:result]);
+    XCTAssertFalse(called);
+    XCTAssertEqual([[result error] code], (NSInteger)5);
+}
+
+-(void)testRecoverReplacesTheError{
+    OlapicFuture *result = [[OlapicFuture futureWithError:[self errorWithCode:5]] recover:^OlapicFuture *(NSError *futureError){
+        return [OlapicFuture futureWithValue:@"fallback"];
+    }];
+    XCTAssertTrue([self waitForFuture:result]);
+    XCTAssertEqualObjects([result value], @"fallback");
+}
+
+-(void)testCancelCallsTheHandlers{
+    __block BOOL cancelledWork = NO;
+    OlapicFuture *future = [OlapicFuture futureWithBlock:^(OlapicFuture *f){
+        [f onCancel:^{
+            cancelledWork = YES;
+        }];
+    }];
+    [future cancel];
+    XCTAssertTrue(cancelledWork);
+    XCTAssertTrue([future isCancelled]);
+    XCTAssertEqual([[future error] code], (NSInteger)OlapicFutureErrorCancelled);
+}
+
+-(void)testCancellingAChainCancelsTheStepItWaitsFor{
+    OlapicFuture *first = [[OlapicFuture alloc] init];
+    OlapicFuture *chained = [first map:^id(id futureValue){
+        return futureValue;
+    }];
+    [chained cancel];
+    XCTAssertTrue([first isCancelled]);
+}
+
+-(void)testAllKeepsTheOrder{
+    OlapicFuture *slow = [[OlapicFuture alloc] init];
+    OlapicFuture *fast = [OlapicFuture futureWithValue:@"fast"];
+    OlapicFuture *result = [OlapicFuture all:@[slow, fast]];
+    [slow fulfillWithValue:@"slow"];
+    XCTAssertTrue([self waitForFuture:result]);
+    XCTAssertEqualObjects([result value], (@[@"slow", @"fast"]));
+}
+
+-(void)testAllFailsWithTheFirstErrorAndCancelsTheRest{
+    OlapicFuture *pending = [[OlapicFuture alloc] init];
+    OlapicFuture *result = [OlapicFuture all:@[pending, [OlapicFuture futureWithError:[self errorWithCode:7]]]];
+    XCTAssertTrue([self waitForFuture:result]);
+    XCTAssertEqual([[result error] code], (NSInteger)7);
+    XCTAssertTrue([pending isCancelled]);
+}
+
+-(void)testAllWithoutFutures{
+    OlapicFuture *result = [OlapicFuture all:@[]];
+    XCTAssertEqual([result state], OlapicFutureStateFulfilled);
+    XCTAssertEqualObjects([result value], @[]);
+}
+
+-(void)testAnyUsesTheFirstValue{
+    OlapicFuture *result = [OlapicFuture any:@[[OlapicFuture futureWithError:[self errorWithCode:1]], [OlapicFuture futureWithValue:@"ok"]]];
+    XCTAssertTrue([self waitForFuture:result]);
+    XCTAssertEqualObjects([result value], @"ok");
+}
+
+-(void)testAnyFailsWhenAllFail{
+    OlapicFuture *result = [OlapicFuture any:@[[OlapicFuture futureWithError:[self errorWithCode:1]], [OlapicFuture futureWithError:[self errorWithCode:2]]]];
+    XCTAssertTrue([self waitForFuture:result]);
+    XCTAssertEqual([[result error] code], (NSInteger)OlapicFutureErrorAllFailed);
+    NSArray *errors = [[[result error] userInfo] objectForKey:@"errors"];
+    XCTAssertEqual([errors count], (NSUInteger)2);
+    XCTAssertEqual([[errors objectAtIndex:1] code], (NSInteger)2);
+}
+
+-(void)testRaceSettlesWithTheFirstAndCancelsTheRest{
+    OlapicFuture *pending = [[OlapicFuture alloc] init];
+    OlapicFuture *result = [OlapicFuture race:@[pending, [OlapicFuture futureWithError:[self errorWithCode:3]]]];
+    XCTAssertTrue([self waitForFuture:result]);
+    XCTAssertEqual([[result error] code], (NSInteger)3);
+    XCTAssertTrue([pending isCancelled]);
+}
+
+-(void)testRaceWithoutFuturesIsRejected{
+    OlapicFuture *result = [OlapicFuture race:@[]];
+    XCTAssertEqual([result state], OlapicFutureStateRejected);
+    XCTAssertEqual([[result error] code], (NSInteger)OlapicFutureErrorNoFutures);
+}
+
+-(void)testTimeoutRejectsAndCancels{
+    OlapicFuture *never = [[OlapicFuture alloc] init];
+    OlapicFuture *result = [never timeout:0.05];
+    XCTAssertTrue([self waitForFuture:result]);
+    XCTAssertEqual([[result error] code], (NSInteger)OlapicFutureErrorTimeout);
+    XCTAssertTrue([never isCancelled]);
+}
+
+-(void)testTimeoutKeepsAFastValue{
+    OlapicFuture *result = [[OlapicFuture futureWithValue:@"fast"] timeout:1];
+    XCTAssertTrue([self waitForFuture:result]);
+    XCTAssertEqualObjects([result value], @"fast");
+}
+
+@end
@@ -0,0 +1,95 @@
+//
+//  OlapicHTTPSessionTests.m
+//  OlaBasicGalleryTests
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic. All rights reserved.
+//
+
+// The number of requests on every burst, like a page of thumbnails
+#define kBurstSize 32
+
+#import <XCTest/XCTest.h>
+#import "OlapicHTTPSession.h"
+
+/**
+ *  Answers every request with a small image-sized body, so the
+ *  tests don't need the network
+ */
+@interface OlapicHTTPSessionStubProtocol : NSURLProtocol
+
+@end
+
+@implementation OlapicHTTPSessionStubProtocol
+
++(BOOL)canInitWithRequest:(NSURLRequest *)request{
+    return [[[request URL] host] isEqualToString:@"stub.olapic.test"];
+}
+
++(NSURLRequest *)canonicalRequestForRequest:(NSURLRequest *)request{
+    return request;
+}
+
+-(void)startLoading{
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:[[self request] URL] statusCode:200 HTTPVersion:@"HTTP/1.1" headerFields:@{@"Content-Type": @"image/jpeg", @"Cache-Control": @"no-store"}];
+    [[self client] URLProtocol:self didReceiveResponse:response cacheStoragePolicy:NSURLCacheStorageNotAllowed];
+    [[self client] URLProtocol:self didLoadData:[NSMutableData dataWithLength:8 * 1024]];
+    [[self client] URLProtocolDidFinishLoading:self];
+}
+
+-(void)stopLoading{
+}
+
+@end
+
+@interface OlapicHTTPSessionTests : XCTestCase
+
+@end
+
+@implementation OlapicHTTPSessionTests
+/**
+ *  A configuration that sends the requests to the stub
+ *
+ *  @param configuration The configuration to change
+ *
+ *  @return The same configuration
+ */
+-(NSURLSessionConfiguration *)stubbedConfiguration:(NSURLSessionConfiguration *)configuration{
+    configuration.protocolClasses = @[[OlapicHTTPSessionStubProtocol class]];
+    return configuration;
+}
+/**
+ *  Run a burst of requests and wait for all of them
+ *
+ *  @param sessionForRequest Gives the session for each request
+ */
+-(void)runBurstWithSessions:(NSURLSession *(^)(void))sessionForRequest{
+    dispatch_group_t group = dispatch_group_create();
+    for(int i = 0; i < kBurstSize; i++){
+        NSURL *URL = [NSURL URLWithString:[NSString stringWithFormat:@"https://stub.olapic.test/media/%d.jpg",i]];
+        NSURLSession *session = sessionForRequest();
+        dispatch_group_enter(group);
+        [[session dataTaskWithURL:URL completionHandler:^(NSData *data, NSURLResponse *response, NSError *error){
+            XCTAssertNil(error);
+            XCTAssertEqual([data length], (NSUInteger)(8 * 1024));
+            dispatch_group_leave(group);
+        }] resume];
+    }
+    long timedOut = dispatch_group_wait(group, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(10 * NSEC_PER_SEC)));
+    XCTAssertEqual(timedOut, 0L);
+}
+
+-(void)testSharedInstance{
+    XCTAssertEqual([OlapicHTTPSession sharedHTTPSession], [OlapicHTTPSession sharedHTTPSession]);
+    XCTAssertNotNil([[OlapicHTTPSession sharedHTTPSession] metrics]);
+    XCTAssertEqual([[OlapicHTTPSession defaultConfiguration] HTTPMaximumConnectionsPerHost], (NSInteger)4);
+}
+-(void)testBurstOnTheSharedSession{
+    OlapicHTTPSession *shared = [[OlapicHTTPSession alloc] initWithConfiguration:[self stubbedConfiguration:[OlapicHTTPSession defaultConfiguration]]];
+    [self runBurstWithSessions:^NSURLSession *{
+        return shared.session;
+    }];
+    [shared.session finishTasksAndInvalidate];
+}
+
+@end
@@ -0,0 +1,96 @@
+//
+//  OlapicMediaListDiffTests.m
+//  OlaBasicGalleryTests
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <OlapicSDK/OlapicSDK.h>
+#import "OlapicMediaListDiff.h"
+
+@interface OlapicMediaListDiffTests : XCTestCase
+
+@end
+
+@implementation OlapicMediaListDiffTests
+/**
+ *  Create a list of media objects using their IDs
+ *
+ *  @param keys The media IDs
+ *
+ *  @return An array of OlapicMediaEntity objects
+ */
+-(NSArray *)mediaWithKeys:(NSArray *)keys{
+    NSMutableArray *media = [[NSMutableArray alloc] init];
+    for(int i = 0; i < [keys count]; i++){
+        [media addObject:[[OlapicMediaEntity alloc] initWithData:@{@"id": [keys objectAtIndex:i]}]];
+    }
+    return media;
+}
+
+-(void)testSameContentsHaveNoChanges{
+    OlapicMediaListDiff *diff = [OlapicMediaListDiff diffFromMedia:[self mediaWithKeys:@[@"A", @"B", @"C"]] toMedia:[self mediaWithKeys:@[@"A", @"B", @"C"]]];
+    XCTAssertFalse([diff hasChanges]);
+}
+
+-(void)testInsertsAndDeletes{
+    OlapicMediaListDiff *diff = [OlapicMediaListDiff diffFromMedia:[self mediaWithKeys:@[@"A", @"B", @"C"]] toMedia:[self mediaWithKeys:@[@"X", @"A", @"C", @"Y"]]];
+    NSMutableIndexSet *inserts = [[NSMutableIndexSet alloc] initWithIndex:0];
+    [inserts addIndex:3];
+    XCTAssertEqualObjects(diff.inserts, inserts);
+    XCTAssertEqualObjects(diff.deletes, [NSIndexSet indexSetWithIndex:1]);
+    XCTAssertEqual([diff.moves count], (NSUInteger)0, @"Inserts and deletes explain the new positions");
+}
+
+-(void)testRotationIsASingleMove{
+    OlapicMediaListDiff *diff = [OlapicMediaListDiff diffFromMedia:[self mediaWithKeys:@[@"A", @"B", @"C"]] toMedia:[self mediaWithKeys:@[@"C", @"A", @"B"]]];
+    XCTAssertEqual([diff.moves count], (NSUInteger)1);
+    XCTAssertEqualObjects([diff.moves firstObject], (@[@2, @0]));
+    XCTAssertEqual([diff.inserts count], (NSUInteger)0);
+    XCTAssertEqual([diff.deletes count], (NSUInteger)0);
+}
+
+-(void)testReverseKeepsOneMediaInPlace{
+    OlapicMediaListDiff *diff = [OlapicMediaListDiff diffFromMedia:[self mediaWithKeys:@[@"A", @"B", @"C", @"D"]] toMedia:[self mediaWithKeys:@[@"D", @"C", @"B", @"A"]]];
+    XCTAssertEqual([diff.moves count], (NSUInteger)3);
+}
+
+-(void)testMovesAmongInsertsAndDeletes{
+    OlapicMediaListDiff *diff = [OlapicMediaListDiff diffFromMedia:[self mediaWithKeys:@[@"A", @"B", @"C", @"D", @"E"]] toMedia:[self mediaWithKeys:@[@"X", @"E", @"A", @"C", @"D"]]];
+    XCTAssertEqualObjects(diff.inserts, [NSIndexSet indexSetWithIndex:0]);
+    XCTAssertEqualObjects(diff.deletes, [NSIndexSet indexSetWithIndex:1]);
+    XCTAssertEqual([diff.moves count], (NSUInteger)1);
+    XCTAssertEqualObjects([diff.moves firstObject], (@[@4, @1]));
+}
+
+-(void)testPreviousIndexes{
+    OlapicMediaListDiff *diff = [OlapicMediaListDiff diffFromMedia:[self mediaWithKeys:@[@"A", @"B"]] toMedia:[self mediaWithKeys:@[@"B", @"X", @"A"]]];
+    XCTAssertEqual([diff previousIndexForIndex:0], (NSUInteger)1);
+    XCTAssertEqual([diff previousIndexForIndex:1], (NSUInteger)NSNotFound);
+    XCTAssertEqual([diff previousIndexForIndex:2], (NSUInteger)0);
+    XCTAssertEqual([diff previousIndexForIndex:3], (NSUInteger)NSNotFound);
+}
+
+-(void)testUpdatesWhenTheDataChanges{
+    NSArray *previous = @[[[OlapicMediaEntity alloc] initWithData:@{@"id": @"A", @"caption": @"old"}],
+                          [[OlapicMediaEntity alloc] initWithData:@{@"id": @"B", @"caption": @"same"}]];
+    NSArray *current = @[[[OlapicMediaEntity alloc] initWithData:@{@"id": @"A", @"caption": @"new"}],
+                         [[OlapicMediaEntity alloc] initWithData:@{@"id": @"B", @"caption": @"same"}]];
+    OlapicMediaListDiff *diff = [OlapicMediaListDiff diffFromMedia:previous toMedia:current];
+    XCTAssertEqualObjects(diff.updates, [NSIndexSet indexSetWithIndex:0]);
+    XCTAssertEqual([diff.moves count], (NSUInteger)0);
+}
+
+-(void)testDuplicatedKeysAreInserts{
+    OlapicMediaListDiff *diff = [OlapicMediaListDiff diffFromMedia:[self mediaWithKeys:@[@"A"]] toMedia:[self mediaWithKeys:@[@"A", @"A"]]];
+    XCTAssertEqualObjects(diff.inserts, [NSIndexSet indexSetWithIndex:1]);
+    XCTAssertEqual([diff.deletes count], (NSUInteger)0);
+}
+
+-(void)testNumericKeys{
+    XCTAssertEqualObjects([OlapicMediaListDiff keyForMedia:[[OlapicMediaEntity alloc] initWithData:@{@"id": @1234}]], @"1234");
+}
+
+@end
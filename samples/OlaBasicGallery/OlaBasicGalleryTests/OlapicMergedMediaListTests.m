@@ -0,0 +1,196 @@
+//
+//  OlapicMergedMediaListTests.m
+//  OlaBasicGalleryTests
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <OlapicSDK/OlapicSDK.h>
+#import "OlapicMergedMediaList.h"
+#import "OlapicFuture.h"
+
+/**
+ *  Answers the requests of the sources with fixed responses (or
+ *  errors) by URL, instead of calling the API
+ */
+@interface OlapicStubMergedMediaList : OlapicMergedMediaList
+
+@property (nonatomic,strong) NSDictionary *responses;
+@property (nonatomic,strong) NSMutableArray *requestedURLs;
+
+@end
+
+@implementation OlapicStubMergedMediaList
+
+-(OlapicFuture *)futureForMediaFromURL:(NSString *)URL parameters:(NSDictionary *)parameters{
+    @synchronized(self){
+        if(!self.requestedURLs) self.requestedURLs = [[NSMutableArray alloc] init];
+        [self.requestedURLs addObject:URL];
+    }
+    id response = [self.responses objectForKey:URL];
+    if([response isKindOfClass:[NSError class]]) return [OlapicFuture futureWithError:response];
+    return [OlapicFuture futureWithValue:response];
+}
+
+@end
+
+@interface OlapicMergedMediaListTests : XCTestCase <OlapicMediaListDelegate>{
+    NSMutableArray *loadedPages;
+    NSMutableArray *errors;
+}
+
+@end
+
+@implementation OlapicMergedMediaListTests
+
+-(void)setUp{
+    [super setUp];
+    loadedPages = [[NSMutableArray alloc] init];
+    errors = [[NSMutableArray alloc] init];
+}
+/**
+ *  Create a source list
+ *
+ *  @param URL The source URL
+ *
+ *  @return The list object
+ */
+-(OlapicMediaList *)sourceWithURL:(NSString *)URL{
+    OlapicMediaList *source = [[OlapicMediaList alloc] init];
+    source.initialURL = URL;
+    return source;
+}
+/**
+ *  Create a page response with media submitted at given hours
+ *
+ *  @param keys  The media IDs
+ *  @param hours The submission hour of each media (on the same day)
+ *  @param next  The URL of the next page (it can be nil)
+ *
+ *  @return The response dictionary
+ */
+-(NSDictionary *)responseWithKeys:(NSArray *)keys hours:(NSArray *)hours next:(NSString *)next{
+    NSMutableArray *media = [[NSMutableArray alloc] init];
+    for(int i = 0; i < [keys count]; i++){
+        NSString *date = [NSString stringWithFormat:@"2014-05-12T%02ld:00:00+00:00", (long)[[hours objectAtIndex:i] integerValue]];
+        [media addObject:[[OlapicMediaEntity alloc] initWithData:@{@"id": [keys objectAtIndex:i], @"date_submitted": date}]];
+    }
+    return @{@"media": media, @"links": (next ? @{@"next": @{@"href": next}} : @{})};
+}
+/**
+ *  Get the IDs of a list of media
+ *
+ *  @param media The media objects
+ *
+ *  @return The IDs
+ */
+-(NSArray *)keysOfMedia:(NSArray *)media{
+    NSMutableArray *keys = [[NSMutableArray alloc] init];
+    for(int i = 0; i < [media count]; i++){
+        [keys addObject:[[media objectAtIndex:i] get:@"id"]];
+    }
+    return keys;
+}
+/**
+ *  Run the main run loop until the list calls the delegate
+ *
+ *  @param list The list
+ */
+-(void)waitForList:(OlapicMergedMediaList *)list{
+    NSDate *limit = [NSDate dateWithTimeIntervalSinceNow:2];
+    while([list fetching] && [limit timeIntervalSinceNow] > 0){
+        [[NSRunLoop currentRunLoop] runMode:NSDefaultRunLoopMode beforeDate:[NSDate dateWithTimeIntervalSinceNow:0.01]];
+    }
+}
+
+-(void)OlapicMediaList:(OlapicMediaList *)mediaList didLoadMedia:(NSArray *)media withLinks:(NSDictionary *)links{
+    [loadedPages addObject:media];
+}
+
+-(void)OlapicMediaList:(OlapicMediaList *)mediaList didReceiveAnError:(NSError *)error{
+    [errors addObject:error];
+}
+
+-(void)testDatesAreParsedWithAnyLocale{
+    OlapicMediaEntity *media = [[OlapicMediaEntity alloc] initWithData:@{@"id": @"merged-date", @"date_submitted": @"2014-05-12T16:23:11+00:00"}];
+    NSNumber *value = [OlapicMergedMediaList sortValueForMedia:media sorting:OlapicMediaListSortingTypeRecent];
+    XCTAssertEqualWithAccuracy([value doubleValue], 1399911791, 0.5);
+}
+
+-(void)testMediaWithoutADateGoesLast{
+    OlapicMediaEntity *media = [[OlapicMediaEntity alloc] initWithData:@{@"id": @"merged-nodate"}];
+    XCTAssertEqual([[OlapicMergedMediaList sortValueForMedia:media sorting:OlapicMediaListSortingTypeRecent] doubleValue], -DBL_MAX);
+}
+
+-(void)testMergesTheSourcesByDate{
+    OlapicStubMergedMediaList *list = [[OlapicStubMergedMediaList alloc] initWithSources:@[[self sourceWithURL:@"http://a"], [self sourceWithURL:@"http://b"]] delegate:self sort:OlapicMediaListSortingTypeRecent mediaPerPage:4];
+    list.responses = @{@"http://a": [self responseWithKeys:@[@"merge-a1", @"merge-a2"] hours:@[@10, @8] next:nil],
+                       @"http://b": [self responseWithKeys:@[@"merge-b1", @"merge-b2"] hours:@[@9, @7] next:nil]};
+    [list startFetching];
+    [self waitForList:list];
+    XCTAssertEqual([loadedPages count], (NSUInteger)1);
+    XCTAssertEqualObjects([self keysOfMedia:[loadedPages firstObject]], (@[@"merge-a1", @"merge-b1", @"merge-a2", @"merge-b2"]));
+    XCTAssertFalse([list canLoadNextPage]);
+}
+
+-(void)testSharedMediaIsAddedOnce{
+    OlapicStubMergedMediaList *list = [[OlapicStubMergedMediaList alloc] initWithSources:@[[self sourceWithURL:@"http://a"], [self sourceWithURL:@"http://b"]] delegate:self sort:OlapicMediaListSortingTypeRecent mediaPerPage:10];
+    list.responses = @{@"http://a": [self responseWithKeys:@[@"shared-1", @"shared-2"] hours:@[@10, @8] next:nil],
+                       @"http://b": [self responseWithKeys:@[@"shared-1", @"shared-3"] hours:@[@10, @7] next:nil]};
+    [list startFetching];
+    [self waitForList:list];
+    XCTAssertEqualObjects([self keysOfMedia:[loadedPages firstObject]], (@[@"shared-1", @"shared-2", @"shared-3"]));
+}
+
+-(void)testSourcesArePagedOnlyWhenNeeded{
+    OlapicStubMergedMediaList *list = [[OlapicStubMergedMediaList alloc] initWithSources:@[[self sourceWithURL:@"http://a"], [self sourceWithURL:@"http://b"]] delegate:self sort:OlapicMediaListSortingTypeRecent mediaPerPage:2];
+    list.responses = @{@"http://a": [self responseWithKeys:@[@"paged-a1", @"paged-a2"] hours:@[@10, @9] next:@"http://a/2"],
+                       @"http://b": [self responseWithKeys:@[@"paged-b1"] hours:@[@1] next:@"http://b/2"]};
+    [list startFetching];
+    [self waitForList:list];
+    XCTAssertEqualObjects([self keysOfMedia:[loadedPages firstObject]], (@[@"paged-a1", @"paged-a2"]));
+    // The page is complete with the first responses, so the next ones wait for the next page
+    XCTAssertEqualObjects(list.requestedURLs, (@[@"http://a", @"http://b"]));
+    XCTAssertTrue([list canLoadNextPage]);
+}
+
+-(void)testAFailingSourceDoesntStopThePage{
+    OlapicStubMergedMediaList *list = [[OlapicStubMergedMediaList alloc] initWithSources:@[[self sourceWithURL:@"http://a"], [self sourceWithURL:@"http://b"]] delegate:self sort:OlapicMediaListSortingTypeRecent mediaPerPage:4];
+    list.responses = @{@"http://a": [NSError errorWithDomain:@"OlapicMergedMediaListTests" code:500 userInfo:nil],
+                       @"http://b": [self responseWithKeys:@[@"failing-b1", @"failing-b2"] hours:@[@9, @7] next:nil]};
+    [list startFetching];
+    [self waitForList:list];
+    XCTAssertEqual([errors count], (NSUInteger)0);
+    XCTAssertEqualObjects([self keysOfMedia:[loadedPages firstObject]], (@[@"failing-b1", @"failing-b2"]));
+    XCTAssertEqual([list stateOfSourceAtIndex:0], OlapicMergedSourceStateBackedOff);
+    XCTAssertEqual([list stateOfSourceAtIndex:1], OlapicMergedSourceStateFinished);
+    // The failed source still has media to give
+    XCTAssertTrue([list canLoadNextPage]);
+}
+
+-(void)testOnlyFailingSourcesReportTheError{
+    OlapicStubMergedMediaList *list = [[OlapicStubMergedMediaList alloc] initWithSources:@[[self sourceWithURL:@"http://a"], [self sourceWithURL:@"http://b"]] delegate:self sort:OlapicMediaListSortingTypeRecent mediaPerPage:4];
+    list.responses = @{@"http://a": [NSError errorWithDomain:@"OlapicMergedMediaListTests" code:500 userInfo:nil],
+                       @"http://b": [NSError errorWithDomain:@"OlapicMergedMediaListTests" code:503 userInfo:nil]};
+    [list startFetching];
+    [self waitForList:list];
+    XCTAssertEqual([loadedPages count], (NSUInteger)0);
+    XCTAssertEqual([errors count], (NSUInteger)1);
+    XCTAssertEqual([list stateOfSourceAtIndex:0], OlapicMergedSourceStateBackedOff);
+    XCTAssertEqual([list stateOfSourceAtIndex:1], OlapicMergedSourceStateBackedOff);
+}
+
+-(void)testBackedOffSourcesAreNotRequestedAgainRightAway{
+    OlapicStubMergedMediaList *list = [[OlapicStubMergedMediaList alloc] initWithSources:@[[self sourceWithURL:@"http://a"]] delegate:self sort:OlapicMediaListSortingTypeRecent mediaPerPage:4];
+    list.responses = @{@"http://a": [NSError errorWithDomain:@"OlapicMergedMediaListTests" code:500 userInfo:nil]};
+    [list startFetching];
+    [self waitForList:list];
+    [list loadNextPage];
+    [self waitForList:list];
+    XCTAssertEqual([list.requestedURLs count], (NSUInteger)1);
+    XCTAssertEqual([errors count], (NSUInteger)2);
+}
+
+@end
@@ -0,0 +1,113 @@
+//
+//  OlapicRetryPolicyTests.m
+//  OlaBasicGalleryTests
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "OlapicRetryPolicy.h"
+
+@interface OlapicRetryPolicyTests : XCTestCase
+
+@end
+
+@implementation OlapicRetryPolicyTests
+/**
+ *  Create the error of a request that got an HTTP response, like the
+ *  transport does it (with the response on the user info)
+ *
+ *  @param status  The HTTP status
+ *  @param headers The response headers
+ *
+ *  @return The error object
+ */
+-(NSError *)errorWithStatus:(NSInteger)status headers:(NSDictionary *)headers{
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:[NSURL URLWithString:@"https://api.olapic.com/media/1"] statusCode:status HTTPVersion:@"HTTP/1.1" headerFields:headers];
+    return [NSError errorWithDomain:@"OlapicRetryPolicyTests" code:status userInfo:@{@"response": response}];
+}
+
+-(void)testStatusCodesThatCanBeRetried{
+    OlapicRetryPolicy *policy = [OlapicRetryPolicy defaultPolicy];
+    XCTAssertTrue([policy isRetryableError:[self errorWithStatus:503 headers:nil]]);
+    XCTAssertTrue([policy isRetryableError:[self errorWithStatus:429 headers:nil]]);
+    XCTAssertFalse([policy isRetryableError:[self errorWithStatus:404 headers:nil]]);
+    XCTAssertFalse([policy isRetryableError:[self errorWithStatus:401 headers:nil]]);
+}
+
+-(void)testConnectionErrorsThatCanBeRetried{
+    OlapicRetryPolicy *policy = [OlapicRetryPolicy defaultPolicy];
+    XCTAssertTrue([policy isRetryableError:[NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorTimedOut userInfo:nil]]);
+    XCTAssertTrue([policy isRetryableError:[NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorNetworkConnectionLost userInfo:nil]]);
+    XCTAssertFalse([policy isRetryableError:[NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorCancelled userInfo:nil]]);
+    XCTAssertFalse([policy isRetryableError:nil]);
+}
+
+-(void)testUnderlyingErrorIsChecked{
+    NSError *underlying = [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorTimedOut userInfo:nil];
+    NSError *error = [NSError errorWithDomain:@"OlapicRetryPolicyTests" code:0 userInfo:@{NSUnderlyingErrorKey: underlying}];
+    XCTAssertTrue([[OlapicRetryPolicy defaultPolicy] isRetryableError:error]);
+}
+
+-(void)testStatusCodeIsReadFromTheResponse{
+    XCTAssertEqual([OlapicRetryPolicy statusCodeForError:[self errorWithStatus:502 headers:nil]], (NSInteger)502);
+    XCTAssertEqual([OlapicRetryPolicy statusCodeForError:[NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorTimedOut userInfo:nil]], (NSInteger)0);
+}
+
+-(void)testRetriesStopAtTheMaximumAttempts{
+    OlapicRetryPolicy *policy = [OlapicRetryPolicy defaultPolicy];
+    policy.maximumAttempts = 3;
+    NSError *error = [self errorWithStatus:503 headers:nil];
+    XCTAssertTrue([policy shouldRetryError:error afterAttempt:1]);
+    XCTAssertTrue([policy shouldRetryError:error afterAttempt:2]);
+    XCTAssertFalse([policy shouldRetryError:error afterAttempt:3]);
+    XCTAssertFalse([[OlapicRetryPolicy noRetryPolicy] shouldRetryError:error afterAttempt:1]);
+}
+
+-(void)testBackoffStaysUnderItsLimit{
+    OlapicRetryPolicy *policy = [OlapicRetryPolicy defaultPolicy];
+    policy.baseDelay = 1;
+    policy.multiplier = 2;
+    policy.maximumDelay = 5;
+    NSError *error = [self errorWithStatus:503 headers:nil];
+    for(int i = 0; i < 50; i++){
+        NSTimeInterval first = [policy delayAfterAttempt:1 forError:error];
+        NSTimeInterval third = [policy delayAfterAttempt:3 forError:error];
+        NSTimeInterval tenth = [policy delayAfterAttempt:10 forError:error];
+        XCTAssertTrue(first >= 0 && first <= 1);
+        XCTAssertTrue(third >= 0 && third <= 4);
+        XCTAssertTrue(tenth >= 0 && tenth <= 5);
+    }
+}
+
+-(void)testRetryAfterInSeconds{
+    OlapicRetryPolicy *policy = [OlapicRetryPolicy defaultPolicy];
+    NSError *error = [self errorWithStatus:429 headers:@{@"Retry-After": @"7"}];
+    XCTAssertEqualWithAccuracy([OlapicRetryPolicy retryAfterForError:error], 7, 0.001);
+    XCTAssertEqualWithAccuracy([policy delayAfterAttempt:1 forError:error], 7, 0.001);
+}
+
+-(void)testRetryAfterAsADate{
+    NSDateFormatter *formatter = [[NSDateFormatter alloc] init];
+    formatter.locale = [[NSLocale alloc] initWithLocaleIdentifier:@"en_US_POSIX"];
+    formatter.timeZone = [NSTimeZone timeZoneWithAbbreviation:@"GMT"];
+    formatter.dateFormat = @"EEE, dd MMM yyyy HH:mm:ss zzz";
+    NSString *date = [formatter stringFromDate:[NSDate dateWithTimeIntervalSinceNow:60]];
+    NSTimeInterval retryAfter = [OlapicRetryPolicy retryAfterForError:[self errorWithStatus:503 headers:@{@"retry-after": date}]];
+    XCTAssertEqualWithAccuracy(retryAfter, 60, 2);
+}
+
+-(void)testRetryAfterIsMissing{
+    XCTAssertEqual([OlapicRetryPolicy retryAfterForError:[self errorWithStatus:503 headers:nil]], (NSTimeInterval)-1);
+    XCTAssertEqual([OlapicRetryPolicy retryAfterForError:[self errorWithStatus:503 headers:@{@"Retry-After": @"soon"}]], (NSTimeInterval)-1);
+}
+
+-(void)testLongRetryAfterIsNotWaited{
+    OlapicRetryPolicy *policy = [OlapicRetryPolicy defaultPolicy];
+    policy.maximumRetryAfter = 30;
+    XCTAssertTrue([policy shouldRetryError:[self errorWithStatus:503 headers:@{@"Retry-After": @"10"}] afterAttempt:1]);
+    XCTAssertFalse([policy shouldRetryError:[self errorWithStatus:503 headers:@{@"Retry-After": @"600"}] afterAttempt:1]);
+}
+
+@end
@@ -0,0 +1,92 @@
+//
+//  OlapicTokenBucketTests.m
+//  OlaBasicGalleryTests
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <libkern/OSAtomic.h>
+#import "OlapicTokenBucket.h"
+
+@interface OlapicTokenBucketTests : XCTestCase
+
+@end
+
+@implementation OlapicTokenBucketTests
+
+-(void)testStartsFull{
+    OlapicTokenBucket *bucket = [[OlapicTokenBucket alloc] initWithCapacity:5 refillRate:1];
+    XCTAssertEqualWithAccuracy([bucket tokens], 5, 0.01);
+    XCTAssertEqual([bucket timeUntilToken], (NSTimeInterval)0);
+}
+
+-(void)testBurstUsesTheWholeBucket{
+    OlapicTokenBucket *bucket = [[OlapicTokenBucket alloc] initWithCapacity:3 refillRate:0.01];
+    XCTAssertTrue([bucket consumeToken]);
+    XCTAssertTrue([bucket consumeToken]);
+    XCTAssertTrue([bucket consumeToken]);
+    XCTAssertFalse([bucket consumeToken]);
+    XCTAssertTrue([bucket timeUntilToken] > 0);
+}
+
+-(void)testRefillsOverTime{
+    OlapicTokenBucket *bucket = [[OlapicTokenBucket alloc] initWithCapacity:1 refillRate:20];
+    XCTAssertTrue([bucket consumeToken]);
+    XCTAssertFalse([bucket consumeToken]);
+    XCTAssertEqualWithAccuracy([bucket timeUntilToken], 0.05, 0.02);
+    [NSThread sleepForTimeInterval:0.1];
+    XCTAssertTrue([bucket consumeToken]);
+}
+
+-(void)testRefillStopsAtTheCapacity{
+    OlapicTokenBucket *bucket = [[OlapicTokenBucket alloc] initWithCapacity:2 refillRate:100];
+    [NSThread sleepForTimeInterval:0.05];
+    XCTAssertEqualWithAccuracy([bucket tokens], 2, 0.01);
+}
+
+-(void)testLimitToRemaining{
+    OlapicTokenBucket *bucket = [[OlapicTokenBucket alloc] initWithCapacity:10 refillRate:0.01];
+    [bucket limitToRemaining:2];
+    XCTAssertEqualWithAccuracy([bucket tokens], 2, 0.01);
+    // The server can't give more tokens than the bucket has
+    [bucket limitToRemaining:8];
+    XCTAssertEqualWithAccuracy([bucket tokens], 2, 0.01);
+}
+
+-(void)testPauseGivesNoTokensUntilItEnds{
+    OlapicTokenBucket *bucket = [[OlapicTokenBucket alloc] initWithCapacity:5 refillRate:100];
+    [bucket pauseUntil:[NSDate dateWithTimeIntervalSinceNow:0.1]];
+    XCTAssertFalse([bucket consumeToken]);
+    XCTAssertNotNil([bucket pausedUntil]);
+    XCTAssertTrue([bucket timeUntilToken] > 0.05);
+    [NSThread sleepForTimeInterval:0.15];
+    XCTAssertTrue([bucket consumeToken]);
+    XCTAssertNil([bucket pausedUntil]);
+}
+
+-(void)testLongerPauseWins{
+    OlapicTokenBucket *bucket = [[OlapicTokenBucket alloc] initWithCapacity:5 refillRate:1];
+    NSDate *later = [NSDate dateWithTimeIntervalSinceNow:60];
+    [bucket pauseUntil:later];
+    [bucket pauseUntil:[NSDate dateWithTimeIntervalSinceNow:1]];
+    XCTAssertEqualObjects([bucket pausedUntil], later);
+}
+
+-(void)testSmallerCapacityDropsTheExtraTokens{
+    OlapicTokenBucket *bucket = [[OlapicTokenBucket alloc] initWithCapacity:10 refillRate:1];
+    bucket.capacity = 3;
+    XCTAssertEqualWithAccuracy([bucket tokens], 3, 0.01);
+}
+
+-(void)testConcurrentConsumersNeverGetMoreThanTheCapacity{
+    OlapicTokenBucket *bucket = [[OlapicTokenBucket alloc] initWithCapacity:100 refillRate:0.01];
+    __block int32_t taken = 0;
+    dispatch_apply(1000, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t i){
+        if([bucket consumeToken]) OSAtomicIncrement32(&taken);
+    });
+    XCTAssertEqual(taken, (int32_t)100);
+}
+
+@end
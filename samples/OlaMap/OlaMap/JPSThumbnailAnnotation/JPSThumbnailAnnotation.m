@@ -10,7 +10,7 @@
 
 @interface JPSThumbnailAnnotation ()
 
-@property (nonatomic, readwrite) JPSThumbnailAnnotationView *view;
+@property (nonatomic, weak, readwrite) JPSThumbnailAnnotationView *view;
 @property (nonatomic, readonly) JPSThumbnail *thumbnail;
 
 @end
@@ -31,14 +31,16 @@
 }
 
 - (MKAnnotationView *)annotationViewInMap:(MKMapView *)mapView {
-    if (!self.view) {
-        self.view = (JPSThumbnailAnnotationView *)[mapView dequeueReusableAnnotationViewWithIdentifier:kJPSThumbnailAnnotationViewReuseID];
-        if (!self.view) self.view = [[JPSThumbnailAnnotationView alloc] initWithAnnotation:self];
+    // The map recycles the views, so the one from a previous time can belong to another annotation now
+    JPSThumbnailAnnotationView *view = (JPSThumbnailAnnotationView *)[mapView dequeueReusableAnnotationViewWithIdentifier:kJPSThumbnailAnnotationViewReuseID];
+    if (!view) {
+        view = [[JPSThumbnailAnnotationView alloc] initWithAnnotation:self];
     } else {
-        self.view.annotation = self;
+        view.annotation = self;
     }
+    self.view = view;
     [self updateThumbnail:self.thumbnail animated:NO];
-    return self.view;
+    return view;
 }
 
 - (void)updateThumbnail:(JPSThumbnail *)thumbnail animated:(BOOL)animated {
@@ -50,7 +52,8 @@
         _coordinate = thumbnail.coordinate; // use ivar to avoid triggering setter
     }
     
-    [self.view updateWithThumbnail:thumbnail];
+    // The view could be showing another annotation since the last time
+    if (self.view.annotation == self) [self.view updateWithThumbnail:thumbnail];
 }
 
 @end
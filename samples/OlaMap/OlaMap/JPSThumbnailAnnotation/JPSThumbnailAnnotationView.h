@@ -40,4 +40,8 @@ typedef NS_ENUM(NSInteger, JPSThumbnailAnnotationViewState) {
 - (OlapicMediaEntity *)media;
 - (OlapicAsyncImageView *)asyncImage;
 
+// The image is only downloaded when the map says the annotation is visible
+- (void)loadImage;
+- (void)cancelImageLoad;
+
 @end
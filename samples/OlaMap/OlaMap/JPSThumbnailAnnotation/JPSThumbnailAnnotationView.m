@@ -139,7 +139,22 @@ static CGFloat const kJPSThumbnailAnnotationViewAnimationDuration = 0.25f;
         // ....
     } andFrame:CGRectMake(0, 0, 50.0f, 47.0f)];
     [_imageView addSubview:_asyncImage];
-    [_asyncImage download];
+}
+
+#pragma mark - Image loading
+
+- (void)loadImage {
+    if (self.asyncImage.thumbImage || [self.asyncImage isDownloading]) return;
+    [self.asyncImage download];
+}
+
+- (void)cancelImageLoad {
+    [self.asyncImage cancelDownload];
+}
+
+- (void)prepareForReuse {
+    [super prepareForReuse];
+    [self.asyncImage prepareForReuse];
 }
 
 
@@ -149,6 +164,11 @@ static CGFloat const kJPSThumbnailAnnotationViewAnimationDuration = 0.25f;
     self.coordinate = thumbnail.coordinate;
     self.titleLabel.text = thumbnail.title;
     self.subtitleLabel.text = thumbnail.subtitle;
+    if(self.media != thumbnail.media){
+        // A recycled view can still have the image of its previous media
+        [self.asyncImage prepareForReuse];
+        self.asyncImage.media = thumbnail.media;
+    }
     self.media = thumbnail.media;
     if(!self.asyncImage){
         [self setupAsyncImage];
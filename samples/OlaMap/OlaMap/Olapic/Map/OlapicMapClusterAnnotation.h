@@ -0,0 +1,93 @@
+//
+//  OlapicMapClusterAnnotation.h
+//  OlaMap
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <MapKit/MapKit.h>
+/**
+ *  An annotation that represents a group of media that are too close
+ *  to be shown separately with the current zoom.
+ *
+ *  Two clusters are equal when they come from the same cell of the
+ *  clustering grid and have the same media count, so the map doesn't
+ *  have to replace them when the user only moves around.
+ */
+@interface OlapicMapClusterAnnotation : NSObject<MKAnnotation>{
+    /**
+     *  The center of the media positions
+     */
+    CLLocationCoordinate2D coordinate;
+    /**
+     *  The media entities on the cluster
+     */
+    NSArray *media;
+    /**
+     *  The area that contains all the media on the cluster
+     */
+    MKMapRect mediaRect;
+    /**
+     *  An identifier for the grid cell the cluster belongs to
+     */
+    NSString *cellKey;
+}
+
+@property (nonatomic,readonly) CLLocationCoordinate2D coordinate;
+@property (nonatomic,strong,readonly) NSArray *media;
+@property (nonatomic,readonly) MKMapRect mediaRect;
+@property (nonatomic,strong,readonly) NSString *cellKey;
+/**
+ *  Class constructor
+ *
+ *  @param clusterMedia The media entities on the cluster
+ *  @param rect         The area that contains all the media
+ *  @param center       The center of the media positions
+ *  @param key          An identifier for the grid cell
+ *
+ *  @return An instance of this object (OlapicMapClusterAnnotation)
+ */
+-(id)initWithMedia:(NSArray *)clusterMedia mediaRect:(MKMapRect)rect center:(MKMapPoint)center cellKey:(NSString *)key;
+/**
+ *  Get the title for the annotation
+ *
+ *  @return A text with the number of media
+ */
+-(NSString *)title;
+/**
+ *  Create (or reuse) the view for the annotation: a circle
+ *  with the number of media
+ *
+ *  @param mapView The map that's going to show it
+ *
+ *  @return The annotation view
+ */
+-(MKAnnotationView *)annotationViewInMap:(MKMapView *)mapView;
+
+@end
@@ -0,0 +1,126 @@
+//
+//  OlapicMapClusterAnnotation.m
+//  OlaMap
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+// The identifier to reuse the cluster views
+#define kClusterAnnotationViewIdentifier @"OlapicMapClusterAnnotationView"
+// The tag for the label with the count
+#define kClusterAnnotationLabelTag 1001
+
+#import "OlapicMapClusterAnnotation.h"
+#import <QuartzCore/QuartzCore.h>
+
+@implementation OlapicMapClusterAnnotation
+@synthesize coordinate,media,mediaRect,cellKey;
+/**
+ *  Class constructor
+ *
+ *  @param clusterMedia The media entities on the cluster
+ *  @param rect         The area that contains all the media
+ *  @param center       The center of the media positions
+ *  @param key          An identifier for the grid cell
+ *
+ *  @return An instance of this object (OlapicMapClusterAnnotation)
+ */
+-(id)initWithMedia:(NSArray *)clusterMedia mediaRect:(MKMapRect)rect center:(MKMapPoint)center cellKey:(NSString *)key{
+    self = [super init];
+    if(self){
+        media = clusterMedia;
+        mediaRect = rect;
+        coordinate = MKCoordinateForMapPoint(center);
+        cellKey = key;
+    }
+    return self;
+}
+/**
+ *  Get the title for the annotation
+ *
+ *  @return A text with the number of media
+ */
+-(NSString *)title{
+    return [NSString stringWithFormat:@"%lu photos",(unsigned long)[media count]];
+}
+/**
+ *  Create (or reuse) the view for the annotation: a circle
+ *  with the number of media
+ *
+ *  @param mapView The map that's going to show it
+ *
+ *  @return The annotation view
+ */
+-(MKAnnotationView *)annotationViewInMap:(MKMapView *)mapView{
+    MKAnnotationView *view = [mapView dequeueReusableAnnotationViewWithIdentifier:kClusterAnnotationViewIdentifier];
+    if(!view){
+        view = [[MKAnnotationView alloc] initWithAnnotation:self reuseIdentifier:kClusterAnnotationViewIdentifier];
+        view.canShowCallout = NO;
+        view.frame = CGRectMake(0, 0, 44, 44);
+        view.backgroundColor = [UIColor colorWithRed:0.11 green:0.53 blue:0.87 alpha:0.85];
+        view.layer.cornerRadius = 22;
+        view.layer.borderWidth = 2;
+        view.layer.borderColor = [UIColor whiteColor].CGColor;
+        UILabel *label = [[UILabel alloc] initWithFrame:view.bounds];
+        label.tag = kClusterAnnotationLabelTag;
+        label.backgroundColor = [UIColor clearColor];
+        label.textColor = [UIColor whiteColor];
+        label.textAlignment = NSTextAlignmentCenter;
+        label.font = [UIFont boldSystemFontOfSize:14];
+        label.adjustsFontSizeToFitWidth = YES;
+        [view addSubview:label];
+    }else{
+        view.annotation = self;
+    }
+    UILabel *label = (UILabel *)[view viewWithTag:kClusterAnnotationLabelTag];
+    label.text = [NSString stringWithFormat:@"%lu",(unsigned long)[media count]];
+    return view;
+}
+/**
+ *  Compare the cluster with another object
+ *
+ *  @param object The object to compare
+ *
+ *  @return YES if it's a cluster for the same cell and with the same count
+ */
+-(BOOL)isEqual:(id)object{
+    if(self == object) return YES;
+    if(![object isKindOfClass:[OlapicMapClusterAnnotation class]]) return NO;
+    OlapicMapClusterAnnotation *other = (OlapicMapClusterAnnotation *)object;
+    return [cellKey isEqualToString:other.cellKey] && [media count] == [other.media count];
+}
+/**
+ *  Get a hash for the cluster, based on its cell
+ *
+ *  @return The hash value
+ */
+-(NSUInteger)hash{
+    return [cellKey hash];
+}
+
+@end
@@ -33,13 +33,26 @@
 #import <Foundation/Foundation.h>
 #import <MapKit/MKAnnotation.h>
 #import <MapKit/MapKit.h>
+#import "OlapicMediaSpatialIndex.h"
 
 @class OlapicMediaEntity;
 @class OlapicAsyncImageView;
 @protocol OlapicMapObjectDelegate;
 /**
  *  Show a map object using MapKit and JPSThumbnailAnnotation
- *  to show the media entities
+ *  to show the media entities.
+ *
+ *  The media are saved on an OlapicMediaSpatialIndex, and every time the
+ *  region changes, only the visible area is read from it: the media that
+ *  are too close for the current zoom are grouped on a cluster annotation,
+ *  so the map never has more annotations than what fits on the screen.
+ *  The map creates its own index, but it can use the one of the list
+ *  that loads the media (see OlapicMediaList+SpatialIndex), so the media
+ *  are indexed only once.
+ *
+ *  The annotations views don't download their thumbnails by themselves:
+ *  the images are requested when the annotations enter the visible area
+ *  and cancelled when they leave it.
  */
 @interface OlapicMapObject : NSObject<MKMapViewDelegate>{
     /**
@@ -62,6 +75,20 @@
      *  The map size and position
      */
     CGRect frame;
+    /**
+     *  The spatial index with all the media entities. It can be the
+     *  index of the list that loads the media, so they are only saved once
+     */
+    OlapicMediaSpatialIndex *spatialIndex;
+    /**
+     *  The annotation for each media, created the first time
+     *  the media is shown alone
+     */
+    NSMapTable *thumbnailAnnotations;
+    /**
+     *  The size (in points) of the cells used to group the media
+     */
+    CGFloat clusterCellSize;
 }
 
 @property (nonatomic,weak) id  <OlapicMapObjectDelegate>__weak delegate;
@@ -69,6 +96,8 @@
 @property (nonatomic,strong) NSMutableArray *annotationsObjects;
 @property (nonatomic,strong) MKMapView *map;
 @property (nonatomic) CGRect frame;
+@property (nonatomic,strong) OlapicMediaSpatialIndex *spatialIndex;
+@property (nonatomic) CGFloat clusterCellSize;
 /**
  *  Set the media entities and the delegate object. This method will
  *  check the array and only save the ones with valid coordinates
@@ -77,6 +106,14 @@
  *  @param delegateObject An object implementing the OlapicMapObjectDelegate protocol
  */
 -(void)setMapAnnotations:(NSArray *)mapAnnotations andDelegate:(id<OlapicMapObjectDelegate>)delegateObject;
+/**
+ *  Add more media entities to a map that was already built, without
+ *  moving the region. Like setMapAnnotations:andDelegate:, only the
+ *  ones with valid coordinates are saved
+ *
+ *  @param mapAnnotations A list of OlapicMediaEntiy objects
+ */
+-(void)addMapAnnotations:(NSArray *)mapAnnotations;
 /**
  *  Add the map on a selected view
  *
@@ -84,10 +121,22 @@
  */
 -(void)addOnView:(UIView *)view;
 /**
- *  Read the annotations, create the objects and send
- *  them to the map
+ *  Read the annotations, save them on the spatial index, move
+ *  the map to show all of them and create the annotations
+ *  for the visible area. The media already on the index are
+ *  not saved again
  */
 -(void)build;
+/**
+ *  Read the visible area from the spatial index and update the
+ *  annotations on the map, grouping the media that are too close
+ */
+-(void)updateClusters;
+/**
+ *  Start downloading the thumbnails of the annotations on the
+ *  visible area, and cancel the ones that left it
+ */
+-(void)updateVisibleThumbnails;
 /**
  *  Change the map frame
  *
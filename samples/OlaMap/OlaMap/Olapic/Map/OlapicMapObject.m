@@ -30,13 +30,61 @@
 //  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 //  THE SOFTWARE.
 
+// The default size (in points) of the cells used to group the media
+#define kMapClusterCellSize 64
+// With this zoom (screen points per map point) or more, the media are never grouped
+#define kMapClusterMaximumZoomScale 0.5
+// The extra space around the media when the region is calculated
+#define kMapRegionPadding 1.2
+// The minimum span for the region, so a single media doesn't zoom to the street level
+#define kMapRegionMinimumSpan 0.02
+
 #import "OlapicMapObject.h"
 #import "OlapicAsyncImageView.h"
+#import "OlapicMapClusterAnnotation.h"
+#import "OlapicMediaSpatialIndex.h"
 #import "JPSThumbnailAnnotation.h"
 #import <OlapicSDK/OlapicSDK.h>
 
+@interface OlapicMapObject()
+/**
+ *  Read the coordinate of a media entity
+ *
+ *  @param media The media entity
+ *
+ *  @return The coordinate or kCLLocationCoordinate2DInvalid if the media doesn't have a valid one
+ */
+-(CLLocationCoordinate2D)coordinateForMedia:(OlapicMediaEntity *)media;
+/**
+ *  Get only the media entities with valid coordinates
+ *
+ *  @param mapAnnotations A list of OlapicMediaEntiy objects
+ *
+ *  @return The filtered list
+ */
+-(NSArray *)mediaWithCoordinates:(NSArray *)mapAnnotations;
+/**
+ *  Get the annotation to show a media alone. It's created
+ *  the first time, and then reused
+ *
+ *  @param media The media entity
+ *
+ *  @return The annotation object
+ */
+-(JPSThumbnailAnnotation *)annotationForMedia:(OlapicMediaEntity *)media;
+/**
+ *  Check if an annotation was created by this object
+ *
+ *  @param annotation The annotation object
+ *
+ *  @return YES if it's a media or a cluster annotation
+ */
+-(BOOL)isMediaAnnotation:(id<MKAnnotation>)annotation;
+
+@end
+
 @implementation OlapicMapObject
-@synthesize delegate,annotations,map,frame,annotationsObjects;
+@synthesize delegate,annotations,map,frame,annotationsObjects,spatialIndex,clusterCellSize;
 
 /**
  * Class constructor
@@ -44,7 +92,11 @@
 -(id)init{
     self = [super init];
     if(self){
+        annotations = [[NSArray alloc] init];
         annotationsObjects = [[NSMutableArray alloc] init];
+        spatialIndex = [[OlapicMediaSpatialIndex alloc] init];
+        thumbnailAnnotations = [NSMapTable mapTableWithKeyOptions:(NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality) valueOptions:NSPointerFunctionsStrongMemory];
+        clusterCellSize = kMapClusterCellSize;
         map = [[MKMapView alloc] initWithFrame:CGRectZero];
         [map setMapType:MKMapTypeStandard];
         [map setDelegate:self];
@@ -61,17 +113,22 @@
  *  @param delegateObject An object implementing the OlapicMapObjectDelegate protocol
  */
 -(void)setMapAnnotations:(NSArray *)mapAnnotations andDelegate:(id<OlapicMapObjectDelegate>)delegateObject{
-    NSMutableArray *cleanAnnotations = [[NSMutableArray alloc] init];
-    for(int i = 0; i < [mapAnnotations count]; i++){
-        OlapicMediaEntity *media = [mapAnnotations objectAtIndex:i];
-        NSDictionary *mediaLoc = [media get:@"location"];
-        if(mediaLoc != (id)[NSNull null]){
-            [cleanAnnotations addObject:media];
-        }
-    }
-    annotations = [[NSArray alloc] initWithArray:cleanAnnotations];
+    annotations = [self mediaWithCoordinates:mapAnnotations];
     delegate = delegateObject;
 }
+/**
+ *  Add more media entities to a map that was already built, without
+ *  moving the region. Like setMapAnnotations:andDelegate:, only the
+ *  ones with valid coordinates are saved
+ *
+ *  @param mapAnnotations A list of OlapicMediaEntiy objects
+ */
+-(void)addMapAnnotations:(NSArray *)mapAnnotations{
+    NSArray *newAnnotations = [self mediaWithCoordinates:mapAnnotations];
+    [spatialIndex addMedia:newAnnotations];
+    annotations = [annotations arrayByAddingObjectsFromArray:newAnnotations];
+    [self updateClusters];
+}
 /**
  *  Add the map on a selected view
  *
@@ -81,87 +138,130 @@
     [view addSubview:map];
 }
 /**
- *  Read the annotations, create the objects and send
- *  them to the map
+ *  Read the annotations, save them on the spatial index, move
+ *  the map to show all of them and create the annotations
+ *  for the visible area. The media already on the index are
+ *  not saved again
  */
 -(void)build{
-    CLLocationCoordinate2D startCoordinates;
-    startCoordinates.latitude = 0;
-    startCoordinates.longitude = 0;
-    NSMutableArray *lats = [[NSMutableArray alloc] init];
-    NSMutableArray *lngs = [[NSMutableArray alloc] init];
-    float latitude = 0;
-    float longitude = 0;
-    // Loop the entities
+    [spatialIndex addMedia:annotations];
+    if([annotations count] == 0){
+        [self updateClusters];
+        return;
+    }
+    // Find the limits of the media
+    CLLocationDegrees lowLat = 90;
+    CLLocationDegrees highLat = -90;
+    CLLocationDegrees lowLng = 180;
+    CLLocationDegrees highLng = -180;
     for(int i = 0; i < [annotations count]; i++){
         OlapicMediaEntity *media = [annotations objectAtIndex:i];
-        NSDictionary *mediaLocation = [media get:@"location"];
-        latitude = [[mediaLocation valueForKey:@"latitude"] floatValue];
-        longitude = [[mediaLocation valueForKey:@"longitude"] floatValue];
-        [lats addObject:[[mediaLocation valueForKey:@"latitude"] stringValue]];
-        [lngs addObject:[[mediaLocation valueForKey:@"longitude"] stringValue]];
-        
-        CLLocationCoordinate2D newCoordinates;
-        
-        newCoordinates.latitude = latitude;
-        newCoordinates.longitude = longitude;
-        
-        JPSThumbnail *npin = [[JPSThumbnail alloc] init];
-        npin.media = media;
-        npin.title = [media get:@"caption"];
-        npin.subtitle = [media get:@"source"];
-        npin.coordinate = newCoordinates;
-        npin.disclosureBlock = ^(JPSThumbnailAnnotationView *annotation){
-            if([delegate respondsToSelector:@selector(mapObject:didSelectMedia:fromImage:)]){
-                [delegate mapObject:self didSelectMedia:[annotation media] fromImage:[annotation asyncImage]];
+        CLLocationCoordinate2D coordinate = [self coordinateForMedia:media];
+        lowLat = MIN(lowLat, coordinate.latitude);
+        highLat = MAX(highLat, coordinate.latitude);
+        lowLng = MIN(lowLng, coordinate.longitude);
+        highLng = MAX(highLng, coordinate.longitude);
+    }
+    // Calculate a region to show all the annotations
+    MKCoordinateRegion startRegion;
+    startRegion.center.latitude = (lowLat + highLat) / 2.0;
+    startRegion.center.longitude = (lowLng + highLng) / 2.0;
+    startRegion.span.latitudeDelta = MIN(180, MAX(kMapRegionMinimumSpan, (highLat - lowLat) * kMapRegionPadding));
+    startRegion.span.longitudeDelta = MIN(360, MAX(kMapRegionMinimumSpan, (highLng - lowLng) * kMapRegionPadding));
+    // Set it on the map; when the region changes, the clusters are updated
+    [map setRegion:[map regionThatFits:startRegion] animated:TRUE];
+    [self updateClusters];
+}
+/**
+ *  Read the visible area from the spatial index and update the
+ *  annotations on the map, grouping the media that are too close
+ */
+-(void)updateClusters{
+    NSMutableSet *visibleAnnotations = [[NSMutableSet alloc] init];
+    MKMapRect visibleRect = map.visibleMapRect;
+    OlapicMapQuadTree *tree = [spatialIndex tree];
+    if(map.bounds.size.width > 0 && visibleRect.size.width > 0 && [tree count] > 0){
+        double zoomScale = map.bounds.size.width / visibleRect.size.width;
+        if(zoomScale >= kMapClusterMaximumZoomScale){
+            // Close enough to show every media alone
+            MKMapRect area = MKMapRectInset(visibleRect, -visibleRect.size.width / 2.0, -visibleRect.size.height / 2.0);
+            [tree enumerateItemsInMapRect:area usingBlock:^(id item, MKMapPoint point){
+                [visibleAnnotations addObject:[self annotationForMedia:item]];
+            }];
+        }else{
+            // The cells size is rounded to a power of two, so small zoom changes
+            // and scrolling don't move the clusters
+            double cellSize = pow(2, ceil(log2(clusterCellSize / zoomScale)));
+            NSInteger minX = (NSInteger)floor(MKMapRectGetMinX(visibleRect) / cellSize) - 1;
+            NSInteger maxX = (NSInteger)floor(MKMapRectGetMaxX(visibleRect) / cellSize) + 1;
+            NSInteger minY = MAX(0, (NSInteger)floor(MKMapRectGetMinY(visibleRect) / cellSize) - 1);
+            NSInteger maxY = (NSInteger)floor(MKMapRectGetMaxY(visibleRect) / cellSize) + 1;
+            for(NSInteger x = minX; x <= maxX; x++){
+                for(NSInteger y = minY; y <= maxY; y++){
+                    MKMapRect cell = MKMapRectMake(x * cellSize, y * cellSize, cellSize, cellSize);
+                    NSMutableArray *cellMedia = [[NSMutableArray alloc] init];
+                    __block double sumX = 0;
+                    __block double sumY = 0;
+                    __block MKMapRect mediaRect = MKMapRectNull;
+                    [tree enumerateItemsInMapRect:cell usingBlock:^(id item, MKMapPoint point){
+                        [cellMedia addObject:item];
+                        sumX += point.x;
+                        sumY += point.y;
+                        mediaRect = MKMapRectUnion(mediaRect, MKMapRectMake(point.x, point.y, 0, 0));
+                    }];
+                    if([cellMedia count] == 1){
+                        [visibleAnnotations addObject:[self annotationForMedia:[cellMedia objectAtIndex:0]]];
+                    }else if([cellMedia count] > 1){
+                        MKMapPoint center = MKMapPointMake(sumX / [cellMedia count], sumY / [cellMedia count]);
+                        NSString *key = [NSString stringWithFormat:@"%.0f:%ld:%ld",cellSize,(long)x,(long)y];
+                        [visibleAnnotations addObject:[[OlapicMapClusterAnnotation alloc] initWithMedia:cellMedia mediaRect:mediaRect center:center cellKey:key]];
+                    }
+                }
             }
-        };
-        [map addAnnotation:[JPSThumbnailAnnotation annotationWithThumbnail:npin]];
-        [annotationsObjects addObject:npin];
+        }
     }
-    
-    // Calculate a region to show the most annotations possible
-    // - Sort the latitudes
-    [lats sortUsingComparator:^NSComparisonResult(id obj1, id obj2) {
-        if ([obj1 floatValue] > [obj2 floatValue]){
-            return NSOrderedDescending;
-        }else if ([obj1 floatValue] < [obj2 floatValue]){
-            return NSOrderedAscending;
+    // The selected annotation stays, so its callout doesn't disappear
+    NSArray *selectedAnnotations = map.selectedAnnotations;
+    for(int i = 0; i < [selectedAnnotations count]; i++){
+        id<MKAnnotation> annotation = [selectedAnnotations objectAtIndex:i];
+        if([self isMediaAnnotation:annotation]){
+            [visibleAnnotations addObject:annotation];
         }
-        return NSOrderedSame;
-    }];
-    // - Sort the longitudes
-    [lngs sortUsingComparator:^NSComparisonResult(id obj1, id obj2) {
-        if ([obj1 floatValue] > [obj2 floatValue])
-            return NSOrderedDescending;
-        else if ([obj1 floatValue] < [obj2 floatValue])
-            return NSOrderedAscending;
-        return NSOrderedSame;
-    }];
-    // - Get the highest and lower latitudes and longitudes
-    float lowLat = [[lats objectAtIndex:0] floatValue];
-    float highLat = [[lats objectAtIndex:([lats count] - 1)] floatValue];
-    float lowLng = [[lngs objectAtIndex:0] floatValue];
-    float highLng = [[lngs objectAtIndex:([lngs count] - 1)] floatValue];
-    
-    // - Do the magic to calculate the distance and the scale
-    CLLocationCoordinate2D swCoordinates;
-    swCoordinates.latitude = lowLat;
-    swCoordinates.longitude = lowLng;
-    CLLocationCoordinate2D neCoordinates;
-    neCoordinates.latitude = highLat;
-    neCoordinates.longitude = highLng;
-    CLLocation *locSouthWest = [[CLLocation alloc] initWithLatitude:swCoordinates.latitude longitude:swCoordinates.longitude];
-    CLLocation *locNorthEast = [[CLLocation alloc] initWithLatitude:neCoordinates.latitude longitude:neCoordinates.longitude];
-    CLLocationDistance meters = [locSouthWest distanceFromLocation:locNorthEast];
-    MKCoordinateRegion startRegion;
-    startRegion.center.latitude = (swCoordinates.latitude + neCoordinates.latitude) / 2.0;
-    startRegion.center.longitude = (swCoordinates.longitude + neCoordinates.longitude) / 2.0;
-    startRegion.span.latitudeDelta = meters / 111319.5;
-    startRegion.span.longitudeDelta = meters / 111319.5;
-    // - Set it on the map
-    [map setRegion:startRegion animated:TRUE];
-    
+    }
+    // Only touch the annotations that changed
+    NSMutableSet *currentAnnotations = [[NSMutableSet alloc] init];
+    NSArray *mapAnnotations = map.annotations;
+    for(int i = 0; i < [mapAnnotations count]; i++){
+        id<MKAnnotation> annotation = [mapAnnotations objectAtIndex:i];
+        if([self isMediaAnnotation:annotation]){
+            [currentAnnotations addObject:annotation];
+        }
+    }
+    NSMutableSet *removedAnnotations = [[NSMutableSet alloc] initWithSet:currentAnnotations];
+    [removedAnnotations minusSet:visibleAnnotations];
+    [visibleAnnotations minusSet:currentAnnotations];
+    if([removedAnnotations count] > 0) [map removeAnnotations:[removedAnnotations allObjects]];
+    if([visibleAnnotations count] > 0) [map addAnnotations:[visibleAnnotations allObjects]];
+}
+/**
+ *  Start downloading the thumbnails of the annotations on the
+ *  visible area, and cancel the ones that left it
+ */
+-(void)updateVisibleThumbnails{
+    MKMapRect visibleRect = map.visibleMapRect;
+    NSArray *mapAnnotations = map.annotations;
+    for(int i = 0; i < [mapAnnotations count]; i++){
+        id<MKAnnotation> annotation = [mapAnnotations objectAtIndex:i];
+        if(![(NSObject *)annotation isKindOfClass:[JPSThumbnailAnnotation class]]) continue;
+        // Only the annotations that already have a view
+        JPSThumbnailAnnotationView *view = (JPSThumbnailAnnotationView *)[map viewForAnnotation:annotation];
+        if(!view) continue;
+        if(MKMapRectContainsPoint(visibleRect, MKMapPointForCoordinate(annotation.coordinate))){
+            [view loadImage];
+        }else{
+            [view cancelImageLoad];
+        }
+    }
 }
 /**
  *  Change the map frame
@@ -171,16 +271,92 @@
 -(void)setFrame:(CGRect)rect{
     map.frame = rect;
 }
+/**
+ *  Read the coordinate of a media entity
+ *
+ *  @param media The media entity
+ *
+ *  @return The coordinate or kCLLocationCoordinate2DInvalid if the media doesn't have a valid one
+ */
+-(CLLocationCoordinate2D)coordinateForMedia:(OlapicMediaEntity *)media{
+    return [OlapicMediaSpatialIndex coordinateForMedia:media];
+}
+/**
+ *  Get only the media entities with valid coordinates
+ *
+ *  @param mapAnnotations A list of OlapicMediaEntiy objects
+ *
+ *  @return The filtered list
+ */
+-(NSArray *)mediaWithCoordinates:(NSArray *)mapAnnotations{
+    NSMutableArray *cleanAnnotations = [[NSMutableArray alloc] init];
+    for(int i = 0; i < [mapAnnotations count]; i++){
+        OlapicMediaEntity *media = [mapAnnotations objectAtIndex:i];
+        if(CLLocationCoordinate2DIsValid([self coordinateForMedia:media])){
+            [cleanAnnotations addObject:media];
+        }
+    }
+    return [[NSArray alloc] initWithArray:cleanAnnotations];
+}
+/**
+ *  Get the annotation to show a media alone. It's created
+ *  the first time, and then reused
+ *
+ *  @param media The media entity
+ *
+ *  @return The annotation object
+ */
+-(JPSThumbnailAnnotation *)annotationForMedia:(OlapicMediaEntity *)media{
+    JPSThumbnailAnnotation *annotation = [thumbnailAnnotations objectForKey:media];
+    if(annotation) return annotation;
+    JPSThumbnail *npin = [[JPSThumbnail alloc] init];
+    npin.media = media;
+    npin.title = [media get:@"caption"];
+    npin.subtitle = [media get:@"source"];
+    npin.coordinate = [self coordinateForMedia:media];
+    __weak OlapicMapObject *weakSelf = self;
+    npin.disclosureBlock = ^(JPSThumbnailAnnotationView *annotationView){
+        OlapicMapObject *mapObject = weakSelf;
+        if([mapObject.delegate respondsToSelector:@selector(mapObject:didSelectMedia:fromImage:)]){
+            [mapObject.delegate mapObject:mapObject didSelectMedia:[annotationView media] fromImage:[annotationView asyncImage]];
+        }
+    };
+    annotation = [JPSThumbnailAnnotation annotationWithThumbnail:npin];
+    [thumbnailAnnotations setObject:annotation forKey:media];
+    [annotationsObjects addObject:npin];
+    return annotation;
+}
+/**
+ *  Check if an annotation was created by this object
+ *
+ *  @param annotation The annotation object
+ *
+ *  @return YES if it's a media or a cluster annotation
+ */
+-(BOOL)isMediaAnnotation:(id<MKAnnotation>)annotation{
+    return [(NSObject *)annotation isKindOfClass:[JPSThumbnailAnnotation class]] || [(NSObject *)annotation isKindOfClass:[OlapicMapClusterAnnotation class]];
+}
 
 #pragma mark - Map delegate
 /**
  *  An annotation was selected.
- *  In this case, JPSThumbnailAnnotationViewProtocol handles it.
+ *  A cluster zooms the map to its media; for the rest,
+ *  JPSThumbnailAnnotationViewProtocol handles it.
  *
  *  @param mapView The annotation map
  *  @param view    The annotation view
  */
 - (void)mapView:(MKMapView *)mapView didSelectAnnotationView:(MKAnnotationView *)view {
+    // Selecting a cluster zooms in to show its media
+    if ([view.annotation isKindOfClass:[OlapicMapClusterAnnotation class]]) {
+        OlapicMapClusterAnnotation *cluster = (OlapicMapClusterAnnotation *)view.annotation;
+        [mapView deselectAnnotation:cluster animated:NO];
+        MKMapRect rect = cluster.mediaRect;
+        double minimumSize = map.visibleMapRect.size.width / 8.0;
+        rect = MKMapRectInset(rect, -MAX(0, (minimumSize - rect.size.width) / 2.0), -MAX(0, (minimumSize - rect.size.height) / 2.0));
+        [mapView setVisibleMapRect:rect edgePadding:UIEdgeInsetsMake(40, 40, 40, 40) animated:YES];
+        return;
+    }
     if ([view conformsToProtocol:@protocol(JPSThumbnailAnnotationViewProtocol)]) {
         [((NSObject<JPSThumbnailAnnotationViewProtocol> *)view) didSelectAnnotationViewInMap:mapView];
     }
@@ -199,7 +375,8 @@
 }
 /**
  *  Create the view for the annotation object
- *  In this case, JPSThumbnailAnnotationViewProtocol handles it.
+ *  For the media, JPSThumbnailAnnotationViewProtocol handles it;
+ *  the clusters create their own.
  *
  *  @param mapView    The annotation map
  *  @param annotation The annotation object
@@ -207,16 +384,47 @@
  *  @return A view to be included on the map
  */
 - (MKAnnotationView *)mapView:(MKMapView *)mapView viewForAnnotation:(id<MKAnnotation>)annotation {
+    if ([(NSObject *)annotation isKindOfClass:[OlapicMapClusterAnnotation class]]) {
+        return [((OlapicMapClusterAnnotation *)annotation) annotationViewInMap:mapView];
+    }
     if ([annotation conformsToProtocol:@protocol(JPSThumbnailAnnotationProtocol)]) {
         return [((NSObject<JPSThumbnailAnnotationProtocol> *)annotation) annotationViewInMap:mapView];
     }
     return nil;
 }
+/**
+ *  The user moved or zoomed the map, so the clusters
+ *  need to be calculated again
+ *
+ *  @param mapView  The map
+ *  @param animated If the change was animated
+ */
+- (void)mapView:(MKMapView *)mapView regionDidChangeAnimated:(BOOL)animated {
+    [self updateClusters];
+    [self updateVisibleThumbnails];
+}
+/**
+ *  The map created the views for some annotations, so the
+ *  visible ones can start downloading their thumbnails
+ *
+ *  @param mapView The map
+ *  @param views   The new annotation views
+ */
+- (void)mapView:(MKMapView *)mapView didAddAnnotationViews:(NSArray *)views {
+    MKMapRect visibleRect = mapView.visibleMapRect;
+    for(int i = 0; i < [views count]; i++){
+        MKAnnotationView *view = [views objectAtIndex:i];
+        if(![view isKindOfClass:[JPSThumbnailAnnotationView class]]) continue;
+        if(MKMapRectContainsPoint(visibleRect, MKMapPointForCoordinate(view.annotation.coordinate))){
+            [(JPSThumbnailAnnotationView *)view loadImage];
+        }
+    }
+}
 /**
  *  Finish killing the map and its dependencies
  */
 -(void)dealloc{
-    [map removeAnnotations:annotationsObjects];
+    [map removeAnnotations:map.annotations];
     map.delegate = nil;
     [map removeFromSuperview];
     map = nil;
@@ -0,0 +1,131 @@
+//
+//  OlapicMapQuadTree.h
+//  OlaMap
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <MapKit/MapKit.h>
+/**
+ *  A point quadtree to find the items inside an area of the map without
+ *  looking at all of them.
+ *
+ *  The points are saved as MKMapPoint, so the areas are MKMapRect and the
+ *  tree matches what the map is showing. Each node keeps a few points
+ *  and, when it's full, it splits itself into four children.
+ */
+@interface OlapicMapQuadTree : NSObject{
+    /**
+     *  The area this node covers
+     */
+    MKMapRect boundary;
+    /**
+     *  How deep the node is on the tree (the root is 0)
+     */
+    NSUInteger depth;
+    /**
+     *  The points saved on this node
+     */
+    MKMapPoint *points;
+    /**
+     *  How many points fit on the points buffer
+     */
+    NSUInteger pointsCapacity;
+    /**
+     *  The items for each one of the points
+     */
+    NSMutableArray *items;
+    /**
+     *  The children, only when the node was split
+     */
+    OlapicMapQuadTree *northWest;
+    OlapicMapQuadTree *northEast;
+    OlapicMapQuadTree *southWest;
+    OlapicMapQuadTree *southEast;
+    /**
+     *  The number of items on this node and its children
+     */
+    NSUInteger count;
+}
+
+@property (nonatomic,readonly) MKMapRect boundary;
+@property (nonatomic,readonly) NSUInteger count;
+/**
+ *  Class constructor, for a tree that covers the whole world
+ *
+ *  @return An instance of this object (OlapicMapQuadTree)
+ */
+-(id)init;
+/**
+ *  Class constructor
+ *
+ *  @param rect The area the tree covers
+ *
+ *  @return An instance of this object (OlapicMapQuadTree)
+ */
+-(id)initWithMapRect:(MKMapRect)rect;
+/**
+ *  Add an item on a coordinate
+ *
+ *  @param item       The item to save
+ *  @param coordinate The item coordinate
+ *
+ *  @return YES if the coordinate is inside the tree area
+ */
+-(BOOL)insertItem:(id)item atCoordinate:(CLLocationCoordinate2D)coordinate;
+/**
+ *  Add an item on a map point
+ *
+ *  @param item  The item to save
+ *  @param point The item position
+ *
+ *  @return YES if the point is inside the tree area
+ */
+-(BOOL)insertItem:(id)item atPoint:(MKMapPoint)point;
+/**
+ *  Loop all the items inside an area
+ *
+ *  @param rect  The area to look on
+ *  @param block A callback for each item and its position
+ */
+-(void)enumerateItemsInMapRect:(MKMapRect)rect usingBlock:(void (^)(id item, MKMapPoint point))block;
+/**
+ *  Get all the items inside an area
+ *
+ *  @param rect The area to look on
+ *
+ *  @return An array with the items
+ */
+-(NSArray *)itemsInMapRect:(MKMapRect)rect;
+/**
+ *  Remove all the items from the tree
+ */
+-(void)removeAllItems;
+
+@end
@@ -0,0 +1,254 @@
+//
+//  OlapicMapQuadTree.m
+//  OlaMap
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+// The number of points a node keeps before splitting itself
+#define kQuadTreeNodeCapacity 8
+// After this depth the nodes don't split anymore (a lot of media on the same spot)
+#define kQuadTreeMaximumDepth 24
+
+#import "OlapicMapQuadTree.h"
+
+@interface OlapicMapQuadTree()
+/**
+ *  Class constructor, for the children nodes
+ *
+ *  @param rect       The area the node covers
+ *  @param nodeDepth  How deep the node is on the tree
+ *
+ *  @return An instance of this object (OlapicMapQuadTree)
+ */
+-(id)initWithMapRect:(MKMapRect)rect depth:(NSUInteger)nodeDepth;
+/**
+ *  Save a point on this node, making the buffer bigger if needed
+ *
+ *  @param item  The item to save
+ *  @param point The item position
+ */
+-(void)appendItem:(id)item atPoint:(MKMapPoint)point;
+/**
+ *  Create the four children and move the points of this
+ *  node to them
+ */
+-(void)subdivide;
+/**
+ *  Send an item to the child that covers its position
+ *
+ *  @param item  The item to save
+ *  @param point The item position
+ *
+ *  @return YES if one of the children took it
+ */
+-(BOOL)insertItemOnChildren:(id)item atPoint:(MKMapPoint)point;
+
+@end
+
+@implementation OlapicMapQuadTree
+@synthesize boundary,count;
+/**
+ *  Class constructor, for a tree that covers the whole world
+ *
+ *  @return An instance of this object (OlapicMapQuadTree)
+ */
+-(id)init{
+    return [self initWithMapRect:MKMapRectWorld depth:0];
+}
+/**
+ *  Class constructor
+ *
+ *  @param rect The area the tree covers
+ *
+ *  @return An instance of this object (OlapicMapQuadTree)
+ */
+-(id)initWithMapRect:(MKMapRect)rect{
+    return [self initWithMapRect:rect depth:0];
+}
+/**
+ *  Class constructor, for the children nodes
+ *
+ *  @param rect       The area the node covers
+ *  @param nodeDepth  How deep the node is on the tree
+ *
+ *  @return An instance of this object (OlapicMapQuadTree)
+ */
+-(id)initWithMapRect:(MKMapRect)rect depth:(NSUInteger)nodeDepth{
+    self = [super init];
+    if(self){
+        boundary = rect;
+        depth = nodeDepth;
+        pointsCapacity = kQuadTreeNodeCapacity;
+        points = malloc(sizeof(MKMapPoint) * pointsCapacity);
+        items = [[NSMutableArray alloc] initWithCapacity:kQuadTreeNodeCapacity];
+        count = 0;
+    }
+    return self;
+}
+/**
+ *  Add an item on a coordinate
+ *
+ *  @param item       The item to save
+ *  @param coordinate The item coordinate
+ *
+ *  @return YES if the coordinate is inside the tree area
+ */
+-(BOOL)insertItem:(id)item atCoordinate:(CLLocationCoordinate2D)coordinate{
+    if(!CLLocationCoordinate2DIsValid(coordinate)) return NO;
+    MKMapPoint point = MKMapPointForCoordinate(coordinate);
+    // The longitude 180 is exactly on the right edge, that is outside the world rect
+    point.x = MIN(point.x, MKMapRectGetMaxX(boundary) - 1);
+    point.y = MIN(point.y, MKMapRectGetMaxY(boundary) - 1);
+    return [self insertItem:item atPoint:point];
+}
+/**
+ *  Add an item on a map point
+ *
+ *  @param item  The item to save
+ *  @param point The item position
+ *
+ *  @return YES if the point is inside the tree area
+ */
+-(BOOL)insertItem:(id)item atPoint:(MKMapPoint)point{
+    if(!item || !MKMapRectContainsPoint(boundary, point)) return NO;
+    if(!northWest){
+        if([items count] < kQuadTreeNodeCapacity || depth >= kQuadTreeMaximumDepth){
+            [self appendItem:item atPoint:point];
+            count++;
+            return YES;
+        }
+        [self subdivide];
+    }
+    if([self insertItemOnChildren:item atPoint:point]){
+        count++;
+        return YES;
+    }
+    return NO;
+}
+/**
+ *  Save a point on this node, making the buffer bigger if needed
+ *
+ *  @param item  The item to save
+ *  @param point The item position
+ */
+-(void)appendItem:(id)item atPoint:(MKMapPoint)point{
+    if([items count] == pointsCapacity){
+        pointsCapacity *= 2;
+        points = realloc(points, sizeof(MKMapPoint) * pointsCapacity);
+    }
+    points[[items count]] = point;
+    [items addObject:item];
+}
+/**
+ *  Create the four children and move the points of this
+ *  node to them
+ */
+-(void)subdivide{
+    double halfWidth = boundary.size.width / 2.0;
+    double halfHeight = boundary.size.height / 2.0;
+    double x = boundary.origin.x;
+    double y = boundary.origin.y;
+    northWest = [[OlapicMapQuadTree alloc] initWithMapRect:MKMapRectMake(x, y, halfWidth, halfHeight) depth:depth + 1];
+    northEast = [[OlapicMapQuadTree alloc] initWithMapRect:MKMapRectMake(x + halfWidth, y, halfWidth, halfHeight) depth:depth + 1];
+    southWest = [[OlapicMapQuadTree alloc] initWithMapRect:MKMapRectMake(x, y + halfHeight, halfWidth, halfHeight) depth:depth + 1];
+    southEast = [[OlapicMapQuadTree alloc] initWithMapRect:MKMapRectMake(x + halfWidth, y + halfHeight, halfWidth, halfHeight) depth:depth + 1];
+    for(int i = 0; i < [items count]; i++){
+        [self insertItemOnChildren:[items objectAtIndex:i] atPoint:points[i]];
+    }
+    [items removeAllObjects];
+}
+/**
+ *  Send an item to the child that covers its position
+ *
+ *  @param item  The item to save
+ *  @param point The item position
+ *
+ *  @return YES if one of the children took it
+ */
+-(BOOL)insertItemOnChildren:(id)item atPoint:(MKMapPoint)point{
+    if([northWest insertItem:item atPoint:point]) return YES;
+    if([northEast insertItem:item atPoint:point]) return YES;
+    if([southWest insertItem:item atPoint:point]) return YES;
+    return [southEast insertItem:item atPoint:point];
+}
+/**
+ *  Loop all the items inside an area
+ *
+ *  @param rect  The area to look on
+ *  @param block A callback for each item and its position
+ */
+-(void)enumerateItemsInMapRect:(MKMapRect)rect usingBlock:(void (^)(id item, MKMapPoint point))block{
+    if(count == 0 || !MKMapRectIntersectsRect(boundary, rect)) return;
+    // When the node is completely inside, there's no need to check every point
+    BOOL inside = MKMapRectContainsRect(rect, boundary);
+    for(int i = 0; i < [items count]; i++){
+        if(inside || MKMapRectContainsPoint(rect, points[i])){
+            block([items objectAtIndex:i], points[i]);
+        }
+    }
+    if(northWest){
+        [northWest enumerateItemsInMapRect:rect usingBlock:block];
+        [northEast enumerateItemsInMapRect:rect usingBlock:block];
+        [southWest enumerateItemsInMapRect:rect usingBlock:block];
+        [southEast enumerateItemsInMapRect:rect usingBlock:block];
+    }
+}
+/**
+ *  Get all the items inside an area
+ *
+ *  @param rect The area to look on
+ *
+ *  @return An array with the items
+ */
+-(NSArray *)itemsInMapRect:(MKMapRect)rect{
+    NSMutableArray *found = [[NSMutableArray alloc] init];
+    [self enumerateItemsInMapRect:rect usingBlock:^(id item, MKMapPoint point){
+        [found addObject:item];
+    }];
+    return found;
+}
+/**
+ *  Remove all the items from the tree
+ */
+-(void)removeAllItems{
+    [items removeAllObjects];
+    northWest = nil;
+    northEast = nil;
+    southWest = nil;
+    southEast = nil;
+    count = 0;
+}
+/**
+ *  Free the points buffer
+ */
+-(void)dealloc{
+    free(points);
+}
+
+@end
@@ -0,0 +1,101 @@
+//
+//  OlapicMediaList+SpatialIndex.m
+//  OlaMap
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "OlapicMediaList+SpatialIndex.h"
+#import <objc/runtime.h>
+
+// The key for the index saved on the list
+static char kSpatialIndexKey;
+
+@implementation OlapicMediaList (SpatialIndex)
+/**
+ *  Get the spatial index of the list
+ *
+ *  @return The index object
+ */
+-(OlapicMediaSpatialIndex *)spatialIndex{
+    OlapicMediaSpatialIndex *index = objc_getAssociatedObject(self, &kSpatialIndexKey);
+    if(!index){
+        index = [[OlapicMediaSpatialIndex alloc] init];
+        objc_setAssociatedObject(self, &kSpatialIndexKey, index, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    }
+    return index;
+}
+/**
+ *  Add the media of a page the list loaded to the index
+ *
+ *  @param media An array of OlapicMediaEntity objects
+ */
+-(void)addMediaToSpatialIndex:(NSArray *)media{
+    [[self spatialIndex] addMedia:media];
+}
+/**
+ *  Remove all the media from the index, for when the list starts
+ *  fetching again from the first page
+ */
+-(void)resetSpatialIndex{
+    [[self spatialIndex] removeAllMedia];
+}
+/**
+ *  Get the loaded media inside a region
+ *
+ *  @param region The region to look on
+ *
+ *  @return An array of OlapicMediaEntity objects, sorted by distance to the region center
+ */
+-(NSArray *)mediaInRegion:(MKCoordinateRegion)region{
+    return [[self spatialIndex] mediaInRegion:region];
+}
+/**
+ *  Get the loaded media inside a circle
+ *
+ *  @param distance   The circle radius, in meters
+ *  @param coordinate The circle center
+ *
+ *  @return An array of OlapicMediaEntity objects, sorted by distance to the center
+ */
+-(NSArray *)mediaWithinDistance:(CLLocationDistance)distance ofCoordinate:(CLLocationCoordinate2D)coordinate{
+    return [[self spatialIndex] mediaWithinDistance:distance ofCoordinate:coordinate];
+}
+/**
+ *  Get the loaded media closest to a point
+ *
+ *  @param limit      The maximum number of media
+ *  @param coordinate The point
+ *
+ *  @return An array of OlapicMediaEntity objects, sorted by distance to the point
+ */
+-(NSArray *)nearestMedia:(NSUInteger)limit toCoordinate:(CLLocationCoordinate2D)coordinate{
+    return [[self spatialIndex] nearestMedia:limit toCoordinate:coordinate];
+}
+
+@end
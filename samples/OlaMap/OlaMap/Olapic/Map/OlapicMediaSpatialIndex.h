@@ -0,0 +1,120 @@
+//
+//  OlapicMediaSpatialIndex.h
+//  OlaMap
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <MapKit/MapKit.h>
+#import "OlapicMapQuadTree.h"
+
+@class OlapicMediaEntity;
+/**
+ *  A spatial index for media entities, to answer "what's on this area"
+ *  or "what's close to this point" without looping all the media.
+ *
+ *  The media are saved on a quadtree by their `location`, so a query
+ *  only visits the nodes around the area. The media without a valid
+ *  location are ignored, and the same media is never saved twice.
+ *  All the results are sorted by distance (closest first).
+ */
+@interface OlapicMediaSpatialIndex : NSObject{
+    /**
+     *  The quadtree with the media
+     */
+    OlapicMapQuadTree *tree;
+    /**
+     *  The media already on the index, to avoid duplicates
+     */
+    NSHashTable *indexedMedia;
+}
+
+@property (nonatomic,strong,readonly) OlapicMapQuadTree *tree;
+/**
+ *  Read the coordinate of a media entity
+ *
+ *  @param media The media entity
+ *
+ *  @return The coordinate or kCLLocationCoordinate2DInvalid if the media doesn't have a valid one
+ */
++(CLLocationCoordinate2D)coordinateForMedia:(OlapicMediaEntity *)media;
+/**
+ *  Add media entities to the index
+ *
+ *  @param media An array of OlapicMediaEntity objects
+ *
+ *  @return The number of media that were added
+ */
+-(NSUInteger)addMedia:(NSArray *)media;
+/**
+ *  Check if a media is on the index
+ *
+ *  @param media The media entity
+ *
+ *  @return YES if it was added
+ */
+-(BOOL)containsMedia:(OlapicMediaEntity *)media;
+/**
+ *  Get the number of media on the index
+ *
+ *  @return The number of media
+ */
+-(NSUInteger)count;
+/**
+ *  Remove all the media from the index
+ */
+-(void)removeAllMedia;
+/**
+ *  Get the media inside a region
+ *
+ *  @param region The region to look on
+ *
+ *  @return An array of OlapicMediaEntity objects, sorted by distance to the region center
+ */
+-(NSArray *)mediaInRegion:(MKCoordinateRegion)region;
+/**
+ *  Get the media inside a circle
+ *
+ *  @param distance   The circle radius, in meters
+ *  @param coordinate The circle center
+ *
+ *  @return An array of OlapicMediaEntity objects, sorted by distance to the center
+ */
+-(NSArray *)mediaWithinDistance:(CLLocationDistance)distance ofCoordinate:(CLLocationCoordinate2D)coordinate;
+/**
+ *  Get the media closest to a point
+ *
+ *  @param limit      The maximum number of media
+ *  @param coordinate The point
+ *
+ *  @return An array of OlapicMediaEntity objects, sorted by distance to the point
+ */
+-(NSArray *)nearestMedia:(NSUInteger)limit toCoordinate:(CLLocationCoordinate2D)coordinate;
+
+@end
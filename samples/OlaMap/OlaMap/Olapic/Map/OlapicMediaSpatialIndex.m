@@ -0,0 +1,258 @@
+//
+//  OlapicMediaSpatialIndex.m
+//  OlaMap
+//  https://github.com/Olapic/Olapic-SDK-iOS
+//
+//  Documentation
+//  http://docs.photorank.me/ios
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic, Inc. All rights reserved.
+//  https://olapic.com
+//
+//  The MIT License (MIT)
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in
+//  the Software without restriction, including without limitation the rights to
+//  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+//  the Software, and to permit persons to whom the Software is furnished to do so,
+//  subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+// The radius (in meters) of the first search for the closest media
+#define kSpatialIndexNearestInitialDistance 1000
+// Half the earth circumference, no point is farther than this
+#define kSpatialIndexMaximumDistance 20037508
+// The meters on a degree of latitude
+#define kSpatialIndexMetersPerDegree 111319.5
+
+#import "OlapicMediaSpatialIndex.h"
+#import <OlapicSDK/OlapicSDK.h>
+
+@interface OlapicMediaSpatialIndex()
+/**
+ *  Get the media inside a map rect, even if it crosses
+ *  the 180th meridian
+ *
+ *  @param rect The area to look on
+ *
+ *  @return An array of OlapicMediaEntity objects, unsorted
+ */
+-(NSArray *)mediaInMapRect:(MKMapRect)rect;
+/**
+ *  Sort a list of media by their distance to a point
+ *
+ *  @param media      An array of OlapicMediaEntity objects
+ *  @param coordinate The point
+ *  @param distance   If it's bigger than zero, the media farther than this (in meters) are removed
+ *
+ *  @return The sorted array
+ */
+-(NSArray *)sortMedia:(NSArray *)media byDistanceTo:(CLLocationCoordinate2D)coordinate withinDistance:(CLLocationDistance)distance;
+
+@end
+
+@implementation OlapicMediaSpatialIndex
+@synthesize tree;
+/**
+ *  Class constructor
+ *
+ *  @return An instance of this object (OlapicMediaSpatialIndex)
+ */
+-(id)init{
+    self = [super init];
+    if(self){
+        tree = [[OlapicMapQuadTree alloc] init];
+        indexedMedia = [NSHashTable hashTableWithOptions:(NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality)];
+    }
+    return self;
+}
+/**
+ *  Read the coordinate of a media entity
+ *
+ *  @param media The media entity
+ *
+ *  @return The coordinate or kCLLocationCoordinate2DInvalid if the media doesn't have a valid one
+ */
++(CLLocationCoordinate2D)coordinateForMedia:(OlapicMediaEntity *)media{
+    NSDictionary *mediaLocation = [media get:@"location"];
+    if(![mediaLocation isKindOfClass:[NSDictionary class]]) return kCLLocationCoordinate2DInvalid;
+    id latitude = [mediaLocation valueForKey:@"latitude"];
+    id longitude = [mediaLocation valueForKey:@"longitude"];
+    if(![latitude respondsToSelector:@selector(doubleValue)] || ![longitude respondsToSelector:@selector(doubleValue)]){
+        return kCLLocationCoordinate2DInvalid;
+    }
+    CLLocationCoordinate2D coordinate = CLLocationCoordinate2DMake([latitude doubleValue], [longitude doubleValue]);
+    return CLLocationCoordinate2DIsValid(coordinate) ? coordinate : kCLLocationCoordinate2DInvalid;
+}
+/**
+ *  Add media entities to the index
+ *
+ *  @param media An array of OlapicMediaEntity objects
+ *
+ *  @return The number of media that were added
+ */
+-(NSUInteger)addMedia:(NSArray *)media{
+    NSUInteger added = 0;
+    for(int i = 0; i < [media count]; i++){
+        OlapicMediaEntity *entity = [media objectAtIndex:i];
+        if([indexedMedia containsObject:entity]) continue;
+        CLLocationCoordinate2D coordinate = [OlapicMediaSpatialIndex coordinateForMedia:entity];
+        if(!CLLocationCoordinate2DIsValid(coordinate)) continue;
+        if([tree insertItem:entity atCoordinate:coordinate]){
+            [indexedMedia addObject:entity];
+            added++;
+        }
+    }
+    return added;
+}
+/**
+ *  Check if a media is on the index
+ *
+ *  @param media The media entity
+ *
+ *  @return YES if it was added
+ */
+-(BOOL)containsMedia:(OlapicMediaEntity *)media{
+    return [indexedMedia containsObject:media];
+}
+/**
+ *  Get the number of media on the index
+ *
+ *  @return The number of media
+ */
+-(NSUInteger)count{
+    return [tree count];
+}
+/**
+ *  Remove all the media from the index
+ */
+-(void)removeAllMedia{
+    [tree removeAllItems];
+    [indexedMedia removeAllObjects];
+}
+/**
+ *  Get the media inside a region
+ *
+ *  @param region The region to look on
+ *
+ *  @return An array of OlapicMediaEntity objects, sorted by distance to the region center
+ */
+-(NSArray *)mediaInRegion:(MKCoordinateRegion)region{
+    // The sides are placed from the center, so a side past the 180th meridian
+    // (on either side) goes out of the world and it's read on the other side
+    MKMapPoint centerPoint = MKMapPointForCoordinate(region.center);
+    MKMapPoint topPoint = MKMapPointForCoordinate(CLLocationCoordinate2DMake(MIN(90, region.center.latitude + (region.span.latitudeDelta / 2.0)), region.center.longitude));
+    MKMapPoint bottomPoint = MKMapPointForCoordinate(CLLocationCoordinate2DMake(MAX(-90, region.center.latitude - (region.span.latitudeDelta / 2.0)), region.center.longitude));
+    double width = (region.span.longitudeDelta / 360.0) * MKMapSizeWorld.width;
+    MKMapRect rect = MKMapRectMake(centerPoint.x - (width / 2.0), topPoint.y, width, bottomPoint.y - topPoint.y);
+    return [self sortMedia:[self mediaInMapRect:rect] byDistanceTo:region.center withinDistance:0];
+}
+/**
+ *  Get the media inside a circle
+ *
+ *  @param distance   The circle radius, in meters
+ *  @param coordinate The circle center
+ *
+ *  @return An array of OlapicMediaEntity objects, sorted by distance to the center
+ */
+-(NSArray *)mediaWithinDistance:(CLLocationDistance)distance ofCoordinate:(CLLocationCoordinate2D)coordinate{
+    if(!CLLocationCoordinate2DIsValid(coordinate) || distance <= 0) return [[NSArray alloc] init];
+    // The square around the circle, on map points. The scale grows with the latitude,
+    // so the one from the side closest to the pole covers the whole circle
+    MKMapPoint center = MKMapPointForCoordinate(coordinate);
+    CLLocationDegrees farthestLatitude = MIN(85, fabs(coordinate.latitude) + (distance / kSpatialIndexMetersPerDegree));
+    double pointsPerMeter = 1.0 / MKMetersPerMapPointAtLatitude(farthestLatitude);
+    double radius = distance * pointsPerMeter;
+    MKMapRect rect = MKMapRectMake(center.x - radius, center.y - radius, radius * 2.0, radius * 2.0);
+    return [self sortMedia:[self mediaInMapRect:rect] byDistanceTo:coordinate withinDistance:distance];
+}
+/**
+ *  Get the media closest to a point
+ *
+ *  @param limit      The maximum number of media
+ *  @param coordinate The point
+ *
+ *  @return An array of OlapicMediaEntity objects, sorted by distance to the point
+ */
+-(NSArray *)nearestMedia:(NSUInteger)limit toCoordinate:(CLLocationCoordinate2D)coordinate{
+    if(limit == 0 || [tree count] == 0 || !CLLocationCoordinate2DIsValid(coordinate)) return [[NSArray alloc] init];
+    // The circle grows until it has enough media. The results inside a circle are
+    // exact, so the first ones are the closest of the whole index
+    CLLocationDistance distance = kSpatialIndexNearestInitialDistance;
+    NSArray *found = nil;
+    while(YES){
+        found = [self mediaWithinDistance:distance ofCoordinate:coordinate];
+        if([found count] >= limit || distance >= kSpatialIndexMaximumDistance) break;
+        distance = MIN(distance * 4.0, kSpatialIndexMaximumDistance);
+    }
+    if([found count] <= limit) return found;
+    return [found subarrayWithRange:NSMakeRange(0, limit)];
+}
+/**
+ *  Get the media inside a map rect, even if it crosses
+ *  the 180th meridian
+ *
+ *  @param rect The area to look on
+ *
+ *  @return An array of OlapicMediaEntity objects, unsorted
+ */
+-(NSArray *)mediaInMapRect:(MKMapRect)rect{
+    NSMutableArray *found = [[NSMutableArray alloc] init];
+    void (^collect)(id item, MKMapPoint point) = ^(id item, MKMapPoint point){
+        [found addObject:item];
+    };
+    // A rect bigger than the world only needs to be read once
+    if(rect.size.width >= MKMapSizeWorld.width){
+        rect.origin.x = 0;
+        rect.size.width = MKMapSizeWorld.width;
+    }
+    // The part that's out of the world is moved to the other side
+    if(rect.origin.x < 0){
+        [tree enumerateItemsInMapRect:MKMapRectOffset(rect, MKMapSizeWorld.width, 0) usingBlock:collect];
+    }else if(MKMapRectGetMaxX(rect) > MKMapSizeWorld.width){
+        [tree enumerateItemsInMapRect:MKMapRectOffset(rect, -MKMapSizeWorld.width, 0) usingBlock:collect];
+    }
+    [tree enumerateItemsInMapRect:rect usingBlock:collect];
+    return found;
+}
+/**
+ *  Sort a list of media by their distance to a point
+ *
+ *  @param media      An array of OlapicMediaEntity objects
+ *  @param coordinate The point
+ *  @param distance   If it's bigger than zero, the media farther than this (in meters) are removed
+ *
+ *  @return The sorted array
+ */
+-(NSArray *)sortMedia:(NSArray *)media byDistanceTo:(CLLocationCoordinate2D)coordinate withinDistance:(CLLocationDistance)distance{
+    CLLocation *center = [[CLLocation alloc] initWithLatitude:coordinate.latitude longitude:coordinate.longitude];
+    NSMutableArray *distances = [[NSMutableArray alloc] initWithCapacity:[media count]];
+    NSMutableArray *sorted = [[NSMutableArray alloc] initWithCapacity:[media count]];
+    for(int i = 0; i < [media count]; i++){
+        OlapicMediaEntity *entity = [media objectAtIndex:i];
+        CLLocationCoordinate2D mediaCoordinate = [OlapicMediaSpatialIndex coordinateForMedia:entity];
+        CLLocation *location = [[CLLocation alloc] initWithLatitude:mediaCoordinate.latitude longitude:mediaCoordinate.longitude];
+        CLLocationDistance mediaDistance = [center distanceFromLocation:location];
+        if(distance > 0 && mediaDistance > distance) continue;
+        [distances addObject:@{@"media": entity, @"distance": @(mediaDistance)}];
+    }
+    [distances sortUsingDescriptors:@[[NSSortDescriptor sortDescriptorWithKey:@"distance" ascending:YES]]];
+    for(int i = 0; i < [distances count]; i++){
+        [sorted addObject:[[distances objectAtIndex:i] objectForKey:@"media"]];
+    }
+    return sorted;
+}
+
+@end
@@ -31,6 +31,11 @@
 //  THE SOFTWARE.
 
 #define kUploaderWidth 250
+// How much the image can be stretched before downloading a bigger size
+#define kImageUpscaleTolerance 1.1
+// How many times a failed size is requested again, and the wait before each retry (in seconds)
+#define kImageMaximumRetries 3
+#define kImageRetryDelay 2.0
 
 #import <QuartzCore/QuartzCore.h>
 #import "OlapicMediaViewController.h"
@@ -65,11 +70,43 @@
  */
 -(CGRect)centeredFrameForScrollView:(UIScrollView *)scroll andUIView:(UIView *)rView;
 /**
- *  Start downloading the full image.
- *  When it first loads, the image will have the thumbnail quality, but as
- *  soon as the full image is downloaded, it will replace it.
+ *  Start loading the image progressively.
+ *  When it first loads, the image will have the best quality already
+ *  downloaded (usually the thumbnail), and then it will be replaced by the
+ *  mobile, normal and original sizes, but only while the screen (and the
+ *  zoom) needs more pixels than the ones the current image has.
  */
 -(void)loadFullImage;
+/**
+ *  Check if the image on the screen is being stretched and there's
+ *  a bigger size that could be downloaded
+ *
+ *  @return If a bigger size is needed
+ */
+-(BOOL)needsBiggerImage;
+/**
+ *  Download the next size of the image, if it's needed and there
+ *  isn't one already being downloaded
+ */
+-(void)upgradeImageIfNeeded;
+/**
+ *  A bigger size (or the original) couldn't be downloaded: let the
+ *  user zoom what's on the screen and try again after a while
+ *
+ *  @param error The error from the download
+ */
+-(void)imageDownloadDidFail:(NSError *)error;
+/**
+ *  Replace the image on the zoom view with a new size
+ *
+ *  @param newImage The new image
+ */
+-(void)showImage:(UIImage *)newImage;
+/**
+ *  Instead of decoding the whole original, put a tiled version
+ *  of it on top of the image, so only the visible parts are decoded
+ */
+-(void)loadTiledImage;
 /**
  *  Resize the image proportionally
  */
@@ -119,7 +156,7 @@
 @end
 
 @implementation OlapicMediaViewController
-@synthesize mimage,image,zoomView,firstLoad,uploaderView,uploaderViewOpen,detail,uploaderArrow,uploaderArrowLine;
+@synthesize mimage,image,zoomView,firstLoad,uploaderView,uploaderViewOpen,detail,uploaderArrow,uploaderArrowLine,loadingImage,tiledImage;
 /**
  *  Class constructor
  *
@@ -127,10 +164,12 @@
  *
  *  @return An instance of this object (OlapicMediaViewController)
  */
--(id)initWithImage:(OlapicAsyncImageView *__weak)img{
+-(id)initWithImage:(OlapicAsyncImageView *)img{
     self = [super init];
     if(self){
-        mimage = img;
+        // The thumbnail can be reused by the gallery at any moment, so
+        // the screen works with its own copy of the media and images
+        mimage = [[OlapicAsyncImageView alloc] initWithAsyncImage:img];
         zoomView = [[UIScrollView alloc] initWithFrame:CGRectZero];
         uploaderView = [[UIView alloc] initWithFrame:CGRectZero];
         uploaderView.backgroundColor = [UIColor clearColor];
@@ -152,6 +191,8 @@
         [self.view addSubview:zoomView];
         [self.view addSubview:uploaderView];
         firstLoad = NO;
+        loadingImage = NO;
+        imageFailures = 0;
     }
     return self;
 }
@@ -180,7 +221,7 @@
         image.contentMode = UIViewContentModeScaleAspectFit;
         // Set the uploader detail view
         uploaderView.frame = CGRectMake(self.view.frame.size.width, 0, kUploaderWidth, self.view.frame.size.height);
-        // Start downloading the full image
+        // Start loading the image sizes the screen needs
         [self loadFullImage];
         // Set the gestures
         // - The swipe from the right edge to show the uploader detail view
@@ -334,7 +375,7 @@
  */
 -(void)resetZoom{
     if(self.view.frame.size.width < 1) return;
-    CGSize theSize = [mimage.fullImage size];
+    CGSize theSize = [[mimage bestImage] size];
     CGSize screenSize = zoomView.frame.size;
     CGFloat widthRatio = screenSize.width / theSize.width;
     CGFloat heightRatio = screenSize.height / theSize.height;
@@ -373,24 +414,130 @@
 	return frameToCenter;
 }
 /**
- *  Start downloading the full image.
- *  When it first loads, the image will have the thumbnail quality, but as
- *  soon as the full image is downloaded, it will replace it.
+ *  Start loading the image progressively.
+ *  When it first loads, the image will have the best quality already
+ *  downloaded (usually the thumbnail), and then it will be replaced by the
+ *  mobile, normal and original sizes, but only while the screen (and the
+ *  zoom) needs more pixels than the ones the current image has.
  */
 -(void)loadFullImage{
-    [mimage downloadFullImageAndDo:^(OlapicAsyncImageView *imageo){
-        [UIView beginAnimations:nil context:nil];
-        [UIView setAnimationDuration:0.30];
-        [UIView setAnimationDelegate:self];
-        image.image = imageo.fullImage;
-        image.frame = [self centeredFrameForScrollView:zoomView andUIView:image];
-        image.contentMode = UIViewContentModeScaleAspectFill;
-        [UIView commitAnimations];
-        [zoomView setUserInteractionEnabled:YES];
-        detail.image = image;
-        [self performSelector:@selector(resetZoom) withObject:nil afterDelay:0.30];
+    // A bigger size could be there already, if the thumbnail had one
+    if(mimage.fullImage){
+        [self showImage:mimage.fullImage];
+    }
+    [self upgradeImageIfNeeded];
+}
+/**
+ *  Check if the image on the screen is being stretched and there's
+ *  a bigger size that could be downloaded
+ *
+ *  @return If a bigger size is needed
+ */
+-(BOOL)needsBiggerImage{
+    // The thumbnail is never enough for this screen
+    if(!mimage.fullImage) return YES;
+    if(tiledImage || mimage.fullImageSize >= OlapicMediaImageSizeOriginal || !image.image) return NO;
+    CGFloat scale = [UIScreen mainScreen].scale;
+    // The frame already includes the zoom scale
+    CGSize needed = CGSizeMake(image.frame.size.width * scale, image.frame.size.height * scale);
+    CGSize original = mimage.media.originalSize;
+    if(original.width > 0 && original.height > 0){
+        needed = CGSizeMake(MIN(needed.width, original.width), MIN(needed.height, original.height));
+    }
+    CGSize available = CGSizeMake(image.image.size.width * image.image.scale, image.image.size.height * image.image.scale);
+    return needed.width > (available.width * kImageUpscaleTolerance) || needed.height > (available.height * kImageUpscaleTolerance);
+}
+/**
+ *  Download the next size of the image, if it's needed and there
+ *  isn't one already being downloaded
+ */
+-(void)upgradeImageIfNeeded{
+    if(loadingImage || ![self needsBiggerImage]){
+        if(mimage.fullImage) [zoomView setUserInteractionEnabled:YES];
+        return;
+    }
+    OlapicMediaImageSize nextSize = mimage.fullImage ? (mimage.fullImageSize + 1) : OlapicMediaImageSizeMobile;
+    if(nextSize >= OlapicMediaImageSizeOriginal){
+        [self loadTiledImage];
+        return;
+    }
+    loadingImage = YES;
+    // Once the screen is gone, the upgrades stop
+    __weak OlapicMediaViewController *weakSelf = self;
+    [mimage downloadFullImageWithSize:MAX(nextSize, OlapicMediaImageSizeMobile) andDo:^(OlapicAsyncImageView *imageo){
+        OlapicMediaViewController *strongSelf = weakSelf;
+        if(!strongSelf) return;
+        strongSelf.loadingImage = NO;
+        strongSelf->imageFailures = 0;
+        [strongSelf showImage:imageo.fullImage];
+        // Keep going while the screen needs more
+        [strongSelf upgradeImageIfNeeded];
+    } onFailure:^(NSError *error){
+        [weakSelf imageDownloadDidFail:error];
+    }];
+}
+/**
+ *  A bigger size (or the original) couldn't be downloaded: let the
+ *  user zoom what's on the screen and try again after a while
+ *
+ *  @param error The error from the download
+ */
+-(void)imageDownloadDidFail:(NSError *)error{
+    NSLog(@"ERROR ON THE IMAGE : %@",error);
+    loadingImage = NO;
+    [zoomView setUserInteractionEnabled:YES];
+    imageFailures++;
+    if(imageFailures > kImageMaximumRetries) return;
+    __weak OlapicMediaViewController *weakSelf = self;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(kImageRetryDelay * imageFailures * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+        [weakSelf upgradeImageIfNeeded];
+    });
+}
+/**
+ *  Instead of decoding the whole original, put a tiled version
+ *  of it on top of the image, so only the visible parts are decoded
+ */
+-(void)loadTiledImage{
+    loadingImage = YES;
+    OlapicTiledImageView *tiled = [[OlapicTiledImageView alloc] initWithFrame:image.bounds andMedia:mimage.media];
+    tiled.maximumScale = zoomView.maximumZoomScale;
+    tiled.autoresizingMask = UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight;
+    tiled.alpha = 0;
+    __weak OlapicMediaViewController *weakSelf = self;
+    [tiled loadOriginalAndDo:^(OlapicTiledImageView *view){
+        OlapicMediaViewController *strongSelf = weakSelf;
+        if(!strongSelf) return;
+        strongSelf.loadingImage = NO;
+        strongSelf->imageFailures = 0;
+        strongSelf.tiledImage = view;
+        view.frame = strongSelf.image.bounds;
+        [strongSelf.image addSubview:view];
+        [strongSelf.zoomView setUserInteractionEnabled:YES];
+        [UIView animateWithDuration:0.30 animations:^{
+            view.alpha = 1;
+        }];
+    } onFailure:^(NSError *error){
+        [weakSelf imageDownloadDidFail:error];
     }];
 }
+/**
+ *  Replace the image on the zoom view with a new size
+ *
+ *  @param newImage The new image
+ */
+-(void)showImage:(UIImage *)newImage{
+    if(!newImage || image.image == newImage) return;
+    [UIView beginAnimations:nil context:nil];
+    [UIView setAnimationDuration:0.30];
+    [UIView setAnimationDelegate:self];
+    image.image = newImage;
+    image.frame = [self centeredFrameForScrollView:zoomView andUIView:image];
+    image.contentMode = UIViewContentModeScaleAspectFill;
+    [UIView commitAnimations];
+    [zoomView setUserInteractionEnabled:YES];
+    detail.image = image;
+    [self performSelector:@selector(resetZoom) withObject:nil afterDelay:0.30];
+}
 
 -(void)toggleDetail{
     uploaderViewOpen = uploaderViewOpen ? NO : YES;
@@ -426,6 +573,7 @@
     [self readjustSize];
     [self resetZoom];
     [self resetUploaderViewPosition];
+    [self upgradeImageIfNeeded];
 }
 
 #pragma mark - Scroll view delegate
@@ -435,6 +583,13 @@
 - (void)scrollViewDidZoom:(UIScrollView *)scrollView {
     image.frame = [self centeredFrameForScrollView:scrollView andUIView:image];
 }
+/**
+ *  Once the zoom stops, check if the current size of the image is
+ *  enough for the new scale
+ */
+-(void)scrollViewDidEndZooming:(UIScrollView *)scrollView withView:(UIView *)view atScale:(CGFloat)scale{
+    [self upgradeImageIfNeeded];
+}
 /**
  * Make the zoom for the scroll view
  */
@@ -34,6 +34,7 @@
 #import <OlapicSDK/OlapicSDK.h>
 #import "OlapicAsyncImageView.h"
 #import "OlapicMediaViewController.h"
+#import "OlapicMediaList+SpatialIndex.h"
 
 @interface OlapicViewController()
 /**
@@ -93,6 +94,7 @@
         // Connect the SDK to our API using your OAuth method
         [[OlapicSDK sharedOlapicSDK] connectWithOAuthMethod:oauth onSuccess:^(OlapicCustomerEntity *customer) {
             list = [[OlapicCustomerMediaList alloc] initForCustomer:customer delegate:self sort:OlapicMediaListSortingTypePhotorank mediaPerPage:32];
+            [list resetSpatialIndex];
             [list startFetching];
         } onFailure:^(NSError *error) {
             UIAlertView *alert = [[UIAlertView alloc] initWithTitle:@"Error" message:error.description delegate:nil cancelButtonTitle:@"Accept" otherButtonTitles:nil];
@@ -155,7 +157,16 @@
  *  @param links     The links to the API from where this media objects were downloaded
  */
 -(void)OlapicMediaList:(OlapicMediaList *)mediaList didLoadMedia:(NSArray *)media withLinks:(NSDictionary *)links{
+    // Every page goes to the location index as it arrives
+    [mediaList addMediaToSpatialIndex:media];
+    // The next pages only add their media to the map that's already there
+    if(map){
+        [map addMapAnnotations:media];
+        return;
+    }
     map = [[OlapicMapObject alloc] init];
+    // The map reads the index of the list, so the media are only indexed once
+    map.spatialIndex = [mediaList spatialIndex];
     [map addOnView:self.view];
     [map setMapAnnotations:media andDelegate:self];
     [map setFrame:CGRectMake(0, 0, self.view.frame.size.width, self.view.frame.size.height)];
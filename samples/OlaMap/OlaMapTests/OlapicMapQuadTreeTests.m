@@ -0,0 +1,100 @@
+//
+//  OlapicMapQuadTreeTests.m
+//  OlaMapTests
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "OlapicMapQuadTree.h"
+
+@interface OlapicMapQuadTreeTests : XCTestCase
+
+@end
+
+@implementation OlapicMapQuadTreeTests
+/**
+ *  Get a map rect around a coordinate
+ *
+ *  @param coordinate The center
+ *  @param degrees    The latitude and longitude delta
+ *
+ *  @return The map rect
+ */
+-(MKMapRect)mapRectAround:(CLLocationCoordinate2D)coordinate degrees:(CLLocationDegrees)degrees{
+    MKMapPoint a = MKMapPointForCoordinate(CLLocationCoordinate2DMake(coordinate.latitude + degrees, coordinate.longitude - degrees));
+    MKMapPoint b = MKMapPointForCoordinate(CLLocationCoordinate2DMake(coordinate.latitude - degrees, coordinate.longitude + degrees));
+    return MKMapRectMake(MIN(a.x, b.x), MIN(a.y, b.y), fabs(b.x - a.x), fabs(b.y - a.y));
+}
+
+-(void)testFindsOnlyTheItemsInsideTheArea{
+    OlapicMapQuadTree *tree = [[OlapicMapQuadTree alloc] init];
+    XCTAssertTrue([tree insertItem:@"buenos aires" atCoordinate:CLLocationCoordinate2DMake(-34.60, -58.38)]);
+    XCTAssertTrue([tree insertItem:@"new york" atCoordinate:CLLocationCoordinate2DMake(40.71, -74.00)]);
+    XCTAssertTrue([tree insertItem:@"brooklyn" atCoordinate:CLLocationCoordinate2DMake(40.65, -73.95)]);
+    NSArray *items = [tree itemsInMapRect:[self mapRectAround:CLLocationCoordinate2DMake(40.70, -74.00) degrees:0.5]];
+    XCTAssertEqualObjects([NSSet setWithArray:items], ([NSSet setWithObjects:@"new york", @"brooklyn", nil]));
+    XCTAssertEqual(tree.count, (NSUInteger)3);
+}
+
+-(void)testSplitsWithoutLosingItems{
+    OlapicMapQuadTree *tree = [[OlapicMapQuadTree alloc] init];
+    NSUInteger total = 0;
+    for(int lat = -60; lat <= 60; lat += 4){
+        for(int lng = -170; lng <= 170; lng += 10){
+            [tree insertItem:@(total) atCoordinate:CLLocationCoordinate2DMake(lat, lng)];
+            total++;
+        }
+    }
+    XCTAssertEqual(tree.count, total);
+    XCTAssertEqual([[tree itemsInMapRect:MKMapRectWorld] count], total);
+    // One row of points: latitude 0, every 10 degrees of longitude
+    NSArray *equator = [tree itemsInMapRect:[self mapRectAround:CLLocationCoordinate2DMake(0, 0) degrees:1]];
+    XCTAssertEqual([equator count], (NSUInteger)1);
+}
+
+-(void)testManyItemsOnTheSamePoint{
+    OlapicMapQuadTree *tree = [[OlapicMapQuadTree alloc] init];
+    CLLocationCoordinate2D spot = CLLocationCoordinate2DMake(48.8584, 2.2945);
+    for(int i = 0; i < 100; i++){
+        XCTAssertTrue([tree insertItem:@(i) atCoordinate:spot]);
+    }
+    XCTAssertEqual([[tree itemsInMapRect:[self mapRectAround:spot degrees:0.01]] count], (NSUInteger)100);
+}
+
+-(void)testRejectsPointsOutsideTheBoundary{
+    MKMapRect area = [self mapRectAround:CLLocationCoordinate2DMake(0, 0) degrees:10];
+    OlapicMapQuadTree *tree = [[OlapicMapQuadTree alloc] initWithMapRect:area];
+    XCTAssertTrue([tree insertItem:@"inside" atCoordinate:CLLocationCoordinate2DMake(5, 5)]);
+    XCTAssertFalse([tree insertItem:@"outside" atCoordinate:CLLocationCoordinate2DMake(30, 30)]);
+    XCTAssertEqual(tree.count, (NSUInteger)1);
+}
+
+-(void)testEnumerationGivesThePoints{
+    OlapicMapQuadTree *tree = [[OlapicMapQuadTree alloc] init];
+    MKMapPoint point = MKMapPointForCoordinate(CLLocationCoordinate2DMake(10, 10));
+    [tree insertItem:@"item" atPoint:point];
+    __block NSUInteger found = 0;
+    [tree enumerateItemsInMapRect:MKMapRectWorld usingBlock:^(id item, MKMapPoint itemPoint){
+        found++;
+        XCTAssertEqualObjects(item, @"item");
+        XCTAssertEqualWithAccuracy(itemPoint.x, point.x, 0.001);
+        XCTAssertEqualWithAccuracy(itemPoint.y, point.y, 0.001);
+    }];
+    XCTAssertEqual(found, (NSUInteger)1);
+}
+
+-(void)testRemoveAllItems{
+    OlapicMapQuadTree *tree = [[OlapicMapQuadTree alloc] init];
+    for(int i = 0; i < 50; i++){
+        [tree insertItem:@(i) atCoordinate:CLLocationCoordinate2DMake(i, i)];
+    }
+    [tree removeAllItems];
+    XCTAssertEqual(tree.count, (NSUInteger)0);
+    XCTAssertEqual([[tree itemsInMapRect:MKMapRectWorld] count], (NSUInteger)0);
+    XCTAssertTrue([tree insertItem:@"again" atCoordinate:CLLocationCoordinate2DMake(1, 1)]);
+    XCTAssertEqual(tree.count, (NSUInteger)1);
+}
+
+@end
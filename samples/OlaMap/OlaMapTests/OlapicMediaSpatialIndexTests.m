@@ -0,0 +1,134 @@
+//
+//  OlapicMediaSpatialIndexTests.m
+//  OlaMapTests
+//
+//  Created by The Olapic Team on 10/18/26.
+//  Copyright (c) 2026 Olapic. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <OlapicSDK/OlapicSDK.h>
+#import "OlapicMediaSpatialIndex.h"
+
+@interface OlapicMediaSpatialIndexTests : XCTestCase
+
+@end
+
+@implementation OlapicMediaSpatialIndexTests
+/**
+ *  Create a media with a location
+ *
+ *  @param name      The media ID
+ *  @param latitude  The latitude
+ *  @param longitude The longitude
+ *
+ *  @return The media entity
+ */
+-(OlapicMediaEntity *)media:(NSString *)name latitude:(CLLocationDegrees)latitude longitude:(CLLocationDegrees)longitude{
+    return [[OlapicMediaEntity alloc] initWithData:@{@"id": name, @"location": @{@"latitude": @(latitude), @"longitude": @(longitude)}}];
+}
+/**
+ *  Get the IDs of a list of media
+ *
+ *  @param media An array of OlapicMediaEntity objects
+ *
+ *  @return An array of strings, in the same order
+ */
+-(NSArray *)namesOfMedia:(NSArray *)media{
+    NSMutableArray *names = [[NSMutableArray alloc] init];
+    for(int i = 0; i < [media count]; i++){
+        [names addObject:[[media objectAtIndex:i] get:@"id"]];
+    }
+    return names;
+}
+/**
+ *  Create an index with some cities of America
+ *
+ *  @return The index object
+ */
+-(OlapicMediaSpatialIndex *)americaIndex{
+    OlapicMediaSpatialIndex *index = [[OlapicMediaSpatialIndex alloc] init];
+    [index addMedia:@[[self media:@"new york" latitude:40.71 longitude:-74.00],
+                      [self media:@"brooklyn" latitude:40.65 longitude:-73.95],
+                      [self media:@"boston" latitude:42.36 longitude:-71.06],
+                      [self media:@"buenos aires" latitude:-34.60 longitude:-58.38],
+                      [self media:@"la plata" latitude:-34.92 longitude:-57.95]]];
+    return index;
+}
+/**
+ *  Create an index with some cities around the 180th meridian
+ *
+ *  @return The index object
+ */
+-(OlapicMediaSpatialIndex *)pacificIndex{
+    OlapicMediaSpatialIndex *index = [[OlapicMediaSpatialIndex alloc] init];
+    [index addMedia:@[[self media:@"suva" latitude:-18.14 longitude:178.44],
+                      [self media:@"nukualofa" latitude:-21.14 longitude:-175.20],
+                      [self media:@"apia" latitude:-13.83 longitude:-171.76],
+                      [self media:@"auckland" latitude:-36.85 longitude:174.76]]];
+    return index;
+}
+
+-(void)testIgnoresMediaWithoutLocationAndDuplicates{
+    OlapicMediaSpatialIndex *index = [[OlapicMediaSpatialIndex alloc] init];
+    OlapicMediaEntity *located = [self media:@"located" latitude:10 longitude:10];
+    OlapicMediaEntity *nowhere = [[OlapicMediaEntity alloc] initWithData:@{@"id": @"nowhere"}];
+    OlapicMediaEntity *invalid = [self media:@"invalid" latitude:120 longitude:10];
+    XCTAssertEqual([index addMedia:@[located, nowhere, invalid]], (NSUInteger)1);
+    XCTAssertEqual([index addMedia:@[located]], (NSUInteger)0);
+    XCTAssertEqual([index count], (NSUInteger)1);
+    XCTAssertTrue([index containsMedia:located]);
+    XCTAssertFalse([index containsMedia:nowhere]);
+    [index removeAllMedia];
+    XCTAssertEqual([index count], (NSUInteger)0);
+    XCTAssertFalse([index containsMedia:located]);
+}
+
+-(void)testMediaWithinDistance{
+    OlapicMediaSpatialIndex *index = [self americaIndex];
+    NSArray *found = [index mediaWithinDistance:100000 ofCoordinate:CLLocationCoordinate2DMake(-34.60, -58.38)];
+    XCTAssertEqualObjects([self namesOfMedia:found], (@[@"buenos aires", @"la plata"]));
+    found = [index mediaWithinDistance:3000 ofCoordinate:CLLocationCoordinate2DMake(40.66, -73.94)];
+    XCTAssertEqualObjects([self namesOfMedia:found], (@[@"brooklyn"]));
+    XCTAssertEqual([[index mediaWithinDistance:0 ofCoordinate:CLLocationCoordinate2DMake(40.66, -73.94)] count], (NSUInteger)0);
+    XCTAssertEqual([[index mediaWithinDistance:1000 ofCoordinate:kCLLocationCoordinate2DInvalid] count], (NSUInteger)0);
+}
+
+-(void)testNearestMedia{
+    OlapicMediaSpatialIndex *index = [self americaIndex];
+    NSArray *found = [index nearestMedia:2 toCoordinate:CLLocationCoordinate2DMake(40.66, -73.94)];
+    XCTAssertEqualObjects([self namesOfMedia:found], (@[@"brooklyn", @"new york"]));
+    // Asking for more than the index has returns all of them, the farthest last
+    found = [index nearestMedia:10 toCoordinate:CLLocationCoordinate2DMake(40.66, -73.94)];
+    XCTAssertEqual([found count], (NSUInteger)5);
+    XCTAssertEqualObjects([[found lastObject] get:@"id"], @"buenos aires");
+    XCTAssertEqual([[index nearestMedia:0 toCoordinate:CLLocationCoordinate2DMake(40.66, -73.94)] count], (NSUInteger)0);
+}
+
+-(void)testMediaInRegion{
+    OlapicMediaSpatialIndex *index = [self americaIndex];
+    NSArray *found = [index mediaInRegion:MKCoordinateRegionMake(CLLocationCoordinate2DMake(40.70, -74.00), MKCoordinateSpanMake(1, 1))];
+    XCTAssertEqualObjects([self namesOfMedia:found], (@[@"new york", @"brooklyn"]));
+    found = [index mediaInRegion:MKCoordinateRegionMake(CLLocationCoordinate2DMake(0, 0), MKCoordinateSpanMake(10, 10))];
+    XCTAssertEqual([found count], (NSUInteger)0);
+}
+
+-(void)testRegionAcrossTheAntimeridian{
+    OlapicMediaSpatialIndex *index = [self pacificIndex];
+    // From 170 to -170 degrees of longitude
+    NSArray *found = [index mediaInRegion:MKCoordinateRegionMake(CLLocationCoordinate2DMake(-18, 180), MKCoordinateSpanMake(10, 20))];
+    XCTAssertEqualObjects([self namesOfMedia:found], (@[@"suva", @"nukualofa", @"apia"]));
+    // The same area, centered on the other side
+    found = [index mediaInRegion:MKCoordinateRegionMake(CLLocationCoordinate2DMake(-18, -179.9), MKCoordinateSpanMake(10, 20))];
+    XCTAssertEqualObjects([NSSet setWithArray:[self namesOfMedia:found]], ([NSSet setWithObjects:@"suva", @"nukualofa", @"apia", nil]));
+}
+
+-(void)testDistanceQueriesAcrossTheAntimeridian{
+    OlapicMediaSpatialIndex *index = [self pacificIndex];
+    NSArray *found = [index mediaWithinDistance:1000000 ofCoordinate:CLLocationCoordinate2DMake(-18.14, 178.44)];
+    XCTAssertEqualObjects([self namesOfMedia:found], (@[@"suva", @"nukualofa"]));
+    found = [index nearestMedia:2 toCoordinate:CLLocationCoordinate2DMake(-20, -178)];
+    XCTAssertEqualObjects([self namesOfMedia:found], (@[@"nukualofa", @"suva"]));
+}
+
+@end